@@ -50,6 +50,8 @@ bool Board::init()
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
     ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Already initialized");
+    // Includes the creation of the devices by the factories
+    ESP_UTILS_PERF_HISTOGRAM_SCOPE_US("board.init_us");
     if (!_config.isValid()) {
 #if !ESP_PANEL_BOARD_USE_DEFAULT
         ESP_UTILS_CHECK_FALSE_RETURN(
@@ -69,6 +71,8 @@ bool Board::init()
     std::shared_ptr<drivers::Bus> lcd_bus = nullptr;
     std::shared_ptr<drivers::LCD> lcd_device = nullptr;
     if (isLCD_Used()) {
+        // Charge the memory allocated by each device to its own tag, see `esp_utils_mem_trace_print_info()`
+        ESP_UTILS_MEM_TRACE_TAG_SCOPE("LCD");
         auto &lcd_config = _config.lcd.value();
         ESP_UTILS_LOGD("Creating LCD (%s)", lcd_config.device_name);
 
@@ -108,6 +112,7 @@ bool Board::init()
     std::shared_ptr<drivers::Bus> touch_bus = nullptr;
     std::shared_ptr<drivers::Touch> touch_device = nullptr;
     if (isTouchUsed()) {
+        ESP_UTILS_MEM_TRACE_TAG_SCOPE("Touch");
         auto &touch_config = _config.touch.value();
         ESP_UTILS_LOGD("Creating touch (%s)", touch_config.device_name);
 
@@ -148,6 +153,7 @@ bool Board::init()
     // Create backlight device if it is used
     std::shared_ptr<drivers::Backlight> backlight = nullptr;
     if (isBacklightUsed()) {
+        ESP_UTILS_MEM_TRACE_TAG_SCOPE("Backlight");
         auto &backlight_config = _config.backlight.value();
         auto type = drivers::BacklightFactory::getConfigType(backlight_config.config);
         ESP_UTILS_LOGD("Creating backlight (%s[%d])", drivers::BacklightFactory::getTypeNameString(type).c_str(), type);
@@ -195,6 +201,7 @@ bool Board::init()
     // If the IO expander is already configured, it will not be created again
     std::shared_ptr<drivers::IO_Expander> io_expander = nullptr;
     if (isIO_ExpanderUsed() && getIO_Expander() == nullptr) {
+        ESP_UTILS_MEM_TRACE_TAG_SCOPE("IO_Expander");
         auto &expander_config = _config.io_expander.value();
         ESP_UTILS_LOGD("Creating IO Expander (%s)", expander_config.name);
 
@@ -264,6 +271,7 @@ bool Board::begin()
     // If the IO expander is already begun, it will not be begun again
     auto io_expander = getIO_Expander();
     if (io_expander != nullptr && !io_expander->isOverState(esp_expander::Base::State::BEGIN)) {
+        ESP_UTILS_MEM_TRACE_TAG_SCOPE("IO_Expander");
         ESP_UTILS_LOGD("Beginning IO Expander");
 
         if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_EXPANDER_BEGIN] != nullptr) {
@@ -290,6 +298,7 @@ bool Board::begin()
     // Begin the LCD if it is used
     auto lcd_device = getLCD();
     if (lcd_device != nullptr) {
+        ESP_UTILS_MEM_TRACE_TAG_SCOPE("LCD");
         ESP_UTILS_LOGD("Beginning LCD");
 
         if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_LCD_BEGIN] != nullptr) {
@@ -372,6 +381,7 @@ bool Board::begin()
     // Begin the touch if it is used
     auto touch_device = getTouch();
     if (touch_device != nullptr) {
+        ESP_UTILS_MEM_TRACE_TAG_SCOPE("Touch");
         ESP_UTILS_LOGD("Beginning touch");
 
         if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_TOUCH_BEGIN] != nullptr) {
@@ -409,6 +419,7 @@ bool Board::begin()
     // Begin the backlight if it is used
     auto backlight = getBacklight();
     if (backlight != nullptr) {
+        ESP_UTILS_MEM_TRACE_TAG_SCOPE("Backlight");
         ESP_UTILS_LOGD("Beginning backlight");
 
         if (config.stage_callbacks[BoardConfig::STAGE_CALLBACK_PRE_BACKLIGHT_BEGIN] != nullptr) {
@@ -184,6 +184,9 @@ const BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
     #ifdef ESP_PANEL_BOARD_LCD_FLAGS_ENABLE_IO_MULTIPLEX
                 .flags_enable_io_multiplex = ESP_PANEL_BOARD_LCD_FLAGS_ENABLE_IO_MULTIPLEX,
     #endif // ESP_PANEL_BOARD_LCD_FLAGS_ENABLE_IO_MULTIPLEX
+    #ifdef ESP_PANEL_BOARD_LCD_TE_IO
+                .te_gpio_num = ESP_PANEL_BOARD_LCD_TE_IO,
+    #endif // ESP_PANEL_BOARD_LCD_TE_IO
             },
         },
         .pre_process = {
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <string>
 #include "esp_panel_backlight_conf_internal.h"
 
@@ -148,9 +149,9 @@ protected:
     }
 
 private:
-    State _state = State::DEINIT;               ///< Current driver state
+    std::atomic<State> _state = State::DEINIT;  ///< Current driver state
     BasicAttributes _basic_attributes = {};     ///< Device basic attributes
-    int _brightness = 0;                        ///< Current brightness percent (0-100)
+    std::atomic<int> _brightness = 0;           ///< Current brightness percent (0-100)
 };
 
 } // namespace esp_panel::drivers
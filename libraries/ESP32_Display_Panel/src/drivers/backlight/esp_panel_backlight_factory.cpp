@@ -49,58 +49,43 @@ struct ConfigVisitor {
     }
 };
 
-#define TYPE_NAME_MAP_ITEM(type_name)                                      \
-    {                                                                      \
-        Backlight ##type_name::BASIC_ATTRIBUTES_DEFAULT.type, #type_name   \
+#define DEVICE_CREATOR(type_name) \
+    std::shared_ptr<Backlight> operator()(const Backlight ##type_name::Config &config) const \
+    { \
+        std::shared_ptr<Backlight> device = nullptr; \
+        ESP_UTILS_CHECK_EXCEPTION_RETURN( \
+            (device = utils::make_shared<Backlight ##type_name>(config)), nullptr, "Create " #type_name " failed" \
+        ); \
+        return device; \
     }
-
-const utils::unordered_map<int, utils::string> BacklightFactory::_type_name_map = {
-#if ESP_PANEL_DRIVERS_BACKLIGHT_ENABLE_SWITCH_GPIO
-    TYPE_NAME_MAP_ITEM(SwitchGPIO),
-#endif
-#if ESP_PANEL_DRIVERS_BACKLIGHT_ENABLE_SWITCH_EXPANDER
-    TYPE_NAME_MAP_ITEM(SwitchExpander),
-#endif
-#if ESP_PANEL_DRIVERS_BACKLIGHT_ENABLE_PWM_LEDC
-    TYPE_NAME_MAP_ITEM(PWM_LEDC),
-#endif
-#if ESP_PANEL_DRIVERS_BACKLIGHT_ENABLE_CUSTOM
-    TYPE_NAME_MAP_ITEM(Custom),
-#endif
-};
-
-#define DEVICE_CREATOR(type_name)                                                                           \
-    [](const Config &config) -> std::shared_ptr<Backlight> {                                                \
-        ESP_UTILS_LOG_TRACE_ENTER();                                                                        \
-        std::shared_ptr<Backlight> device = nullptr;                                                        \
-        ESP_UTILS_CHECK_FALSE_RETURN(std::holds_alternative<Backlight ##type_name::Config>(config), device, \
-            "Not a " #type_name " config"                                                         \
-        );                                                                                                  \
-        ESP_UTILS_CHECK_EXCEPTION_RETURN(                                                                   \
-            (device = utils::make_shared<Backlight ##type_name>(                                        \
-                std::get<Backlight ##type_name::Config>(config))                                            \
-            ), nullptr, "Create " #type_name " failed"                                                      \
-        );                                                                                                  \
-        ESP_UTILS_LOG_TRACE_EXIT();                                                                         \
-        return device;                                                                                      \
-    }
-#define TYPE_CREATOR_MAP_ITEM(type_name)                                                 \
-    {                                                                               \
-        Backlight ##type_name::BASIC_ATTRIBUTES_DEFAULT.type, DEVICE_CREATOR(type_name)   \
+#define DEVICE_CREATOR_DISABLED(type_name) \
+    std::shared_ptr<Backlight> operator()(const Backlight ##type_name::Config &config) const \
+    { \
+        ESP_UTILS_LOGE("Disabled type: " #type_name); \
+        return nullptr; \
     }
 
-const utils::unordered_map<int, BacklightFactory::FunctionDeviceConstructor> BacklightFactory::_type_constructor_map = {
+// Select the device class from the alternative held by the configuration, instead of looking it up at runtime
+struct DeviceCreatorVisitor {
 #if ESP_PANEL_DRIVERS_BACKLIGHT_USE_SWITCH_GPIO
-    TYPE_CREATOR_MAP_ITEM(SwitchGPIO),
+    DEVICE_CREATOR(SwitchGPIO)
+#else
+    DEVICE_CREATOR_DISABLED(SwitchGPIO)
 #endif
 #if ESP_PANEL_DRIVERS_BACKLIGHT_USE_SWITCH_EXPANDER
-    TYPE_CREATOR_MAP_ITEM(SwitchExpander),
+    DEVICE_CREATOR(SwitchExpander)
+#else
+    DEVICE_CREATOR_DISABLED(SwitchExpander)
 #endif
 #if ESP_PANEL_DRIVERS_BACKLIGHT_USE_PWM_LEDC
-    TYPE_CREATOR_MAP_ITEM(PWM_LEDC),
+    DEVICE_CREATOR(PWM_LEDC)
+#else
+    DEVICE_CREATOR_DISABLED(PWM_LEDC)
 #endif
 #if ESP_PANEL_DRIVERS_BACKLIGHT_USE_CUSTOM
-    TYPE_CREATOR_MAP_ITEM(Custom),
+    DEVICE_CREATOR(Custom)
+#else
+    DEVICE_CREATOR_DISABLED(Custom)
 #endif
 };
 
@@ -110,17 +95,11 @@ std::shared_ptr<Backlight> BacklightFactory::create(const Config &config)
 
     ESP_UTILS_LOGD("Param: config(@%p)", &config);
 
-    auto name = getTypeNameString(getConfigType(config)).c_str();
-
     auto type = getConfigType(config);
+    auto name = getTypeName(type);
     ESP_UTILS_LOGD("Get config type: %d(%s)", type, name);
 
-    auto it = _type_constructor_map.find(type);
-    ESP_UTILS_CHECK_FALSE_RETURN(
-        it != _type_constructor_map.end(), nullptr, "Disabled or unsupported type: %d(%s)", type, name
-    );
-
-    std::shared_ptr<Backlight> device = it->second(config);
+    std::shared_ptr<Backlight> device = std::visit(DeviceCreatorVisitor{}, config);
     ESP_UTILS_CHECK_NULL_RETURN(device, nullptr, "Create device(%s) failed", name);
 
     ESP_UTILS_LOG_TRACE_EXIT();
@@ -135,9 +114,30 @@ int BacklightFactory::getConfigType(const Config &config)
 
 utils::string BacklightFactory::getTypeNameString(int type)
 {
-    auto it = _type_name_map.find(type);
-    if (it != _type_name_map.end()) {
-        return it->second;
+    return getTypeName(type);
+}
+
+#define TYPE_NAME_CASE(type_name) \
+    case Backlight ##type_name::BASIC_ATTRIBUTES_DEFAULT.type: \
+        return #type_name;
+
+const char *BacklightFactory::getTypeName(int type)
+{
+    switch (type) {
+#if ESP_PANEL_DRIVERS_BACKLIGHT_ENABLE_SWITCH_GPIO
+    TYPE_NAME_CASE(SwitchGPIO)
+#endif
+#if ESP_PANEL_DRIVERS_BACKLIGHT_ENABLE_SWITCH_EXPANDER
+    TYPE_NAME_CASE(SwitchExpander)
+#endif
+#if ESP_PANEL_DRIVERS_BACKLIGHT_ENABLE_PWM_LEDC
+    TYPE_NAME_CASE(PWM_LEDC)
+#endif
+#if ESP_PANEL_DRIVERS_BACKLIGHT_ENABLE_CUSTOM
+    TYPE_NAME_CASE(Custom)
+#endif
+    default:
+        break;
     }
 
     return "Unknown";
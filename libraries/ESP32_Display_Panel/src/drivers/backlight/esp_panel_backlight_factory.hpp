@@ -6,9 +6,7 @@
 
 #pragma once
 
-#include <unordered_map>
 #include <memory>
-#include <string>
 #include <variant>
 #include "utils/esp_panel_utils_cxx.hpp"
 #include "esp_panel_backlight.hpp"
@@ -51,6 +49,9 @@ public:
      * @param[in] config The backlight configuration
      *
      * @return Shared pointer to the device if successful, `nullptr` otherwise
+     *
+     * @note The device class is selected from the configuration type at compile time, so only the backlights enabled
+     *       by `ESP_PANEL_DRIVERS_BACKLIGHT_USE_*` are referenced
      */
     static std::shared_ptr<Backlight> create(const Config &config);
 
@@ -74,18 +75,13 @@ public:
 
 private:
     /**
-     * @brief Map of bus types to their type names
+     * @brief Get the name of a backlight type
      *
-     * Maps each bus type to its type name string
-     */
-    static const utils::unordered_map<int, utils::string> _type_name_map;
-
-    /**
-     * @brief Map of bus types to their constructors and type names
+     * @param[in] type The backlight type (`ESP_PANEL_BACKLIGHT_TYPE_*`)
      *
-     * Maps each bus type to its constructor function
+     * @return Backlight type name if successful, `"Unknown"` otherwise
      */
-    static const utils::unordered_map<int, FunctionDeviceConstructor> _type_constructor_map;
+    static const char *getTypeName(int type);
 };
 
 } // namespace esp_panel::drivers
@@ -12,64 +12,53 @@
 
 namespace esp_panel::drivers {
 
-#define TYPE_NAME_MAP_ITEM(type_name)                                                 \
-    {                                                                               \
-        Bus ##type_name::BASIC_ATTRIBUTES_DEFAULT.type, #type_name   \
+#define DEVICE_CREATOR(type_name) \
+    std::shared_ptr<Bus> operator()(const Bus ##type_name::Config &config) const \
+    { \
+        std::shared_ptr<Bus> device = nullptr; \
+        ESP_UTILS_CHECK_EXCEPTION_RETURN( \
+            (device = utils::make_shared<Bus ##type_name>(config)), nullptr, "Create " #type_name " failed" \
+        ); \
+        return device; \
     }
-#define DEVICE_CREATOR(type_name)                                                                     \
-    [](const BusFactory::Config &config) -> std::shared_ptr<Bus> {                                                            \
-        ESP_UTILS_LOG_TRACE_ENTER();                                                                  \
-        std::shared_ptr<Bus> device = nullptr;                                                        \
-        ESP_UTILS_CHECK_FALSE_RETURN(std::holds_alternative<Bus ##type_name::Config>(config), device, \
-            "Bus config is not a " #type_name " config"                                               \
-        );                                                                                            \
-        ESP_UTILS_CHECK_EXCEPTION_RETURN(                                                             \
-            (device = utils::make_shared<Bus ##type_name>(                                        \
-                std::get<Bus ##type_name::Config>(config))                                            \
-            ), nullptr, "Create " #type_name " failed"                                                \
-        );                                                                                            \
-        ESP_UTILS_LOG_TRACE_EXIT();                                                                   \
-        return device;                                                                                \
-    }
-#define TYPE_CREATOR_MAP_ITEM(type_name)                                                 \
-    {                                                                               \
-        Bus ##type_name::BASIC_ATTRIBUTES_DEFAULT.type, DEVICE_CREATOR(type_name)   \
+#define DEVICE_CREATOR_DISABLED(type_name) \
+    std::shared_ptr<Bus> operator()(const Bus ##type_name::Config &config) const \
+    { \
+        ESP_UTILS_LOGE("Disabled type: " #type_name); \
+        return nullptr; \
     }
 
-const utils::unordered_map<int, utils::string> BusFactory::_type_name_map = {
-#if ESP_PANEL_DRIVERS_BUS_ENABLE_I2C
-    TYPE_NAME_MAP_ITEM(I2C),
-#endif
-#if ESP_PANEL_DRIVERS_BUS_ENABLE_SPI
-    TYPE_NAME_MAP_ITEM(SPI),
-#endif
-#if ESP_PANEL_DRIVERS_BUS_ENABLE_QSPI
-    TYPE_NAME_MAP_ITEM(QSPI),
-#endif
-#if ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
-    TYPE_NAME_MAP_ITEM(RGB),
-#endif
-#if ESP_PANEL_DRIVERS_BUS_ENABLE_MIPI_DSI
-    TYPE_NAME_MAP_ITEM(DSI),
-#endif
-};
-
-const utils::unordered_map<int, BusFactory::FunctionDeviceConstructor> BusFactory::_type_constructor_map = {
+// Select the device class from the alternative held by the configuration, instead of looking it up at runtime
+struct DeviceCreatorVisitor {
 #if ESP_PANEL_DRIVERS_BUS_USE_I2C
-    TYPE_CREATOR_MAP_ITEM(I2C),
+    DEVICE_CREATOR(I2C)
+#else
+    DEVICE_CREATOR_DISABLED(I2C)
 #endif
 #if ESP_PANEL_DRIVERS_BUS_USE_SPI
-    TYPE_CREATOR_MAP_ITEM(SPI),
+    DEVICE_CREATOR(SPI)
+#else
+    DEVICE_CREATOR_DISABLED(SPI)
 #endif
 #if ESP_PANEL_DRIVERS_BUS_USE_QSPI
-    TYPE_CREATOR_MAP_ITEM(QSPI),
+    DEVICE_CREATOR(QSPI)
+#else
+    DEVICE_CREATOR_DISABLED(QSPI)
 #endif
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
 #if ESP_PANEL_DRIVERS_BUS_USE_RGB
-    TYPE_CREATOR_MAP_ITEM(RGB),
+    DEVICE_CREATOR(RGB)
+#else
+    DEVICE_CREATOR_DISABLED(RGB)
 #endif
+#endif // ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_MIPI_DSI
 #if ESP_PANEL_DRIVERS_BUS_USE_MIPI_DSI
-    TYPE_CREATOR_MAP_ITEM(DSI),
+    DEVICE_CREATOR(DSI)
+#else
+    DEVICE_CREATOR_DISABLED(DSI)
 #endif
+#endif // ESP_PANEL_DRIVERS_BUS_ENABLE_MIPI_DSI
 };
 
 std::shared_ptr<Bus> BusFactory::create(const Config &config)
@@ -78,17 +67,11 @@ std::shared_ptr<Bus> BusFactory::create(const Config &config)
 
     ESP_UTILS_LOGD("Param: config(@%p)", &config);
 
-    auto name = getTypeNameString(getConfigType(config)).c_str();
-
     auto type = getConfigType(config);
+    auto name = getTypeName(type);
     ESP_UTILS_LOGD("Get config type: %d(%s)", type, name);
 
-    auto it = _type_constructor_map.find(type);
-    ESP_UTILS_CHECK_FALSE_RETURN(
-        it != _type_constructor_map.end(), nullptr, "Disabled or unsupported type: %d(%s)", type, name
-    );
-
-    std::shared_ptr<Bus> device = it->second(config);
+    std::shared_ptr<Bus> device = std::visit(DeviceCreatorVisitor{}, config);
     ESP_UTILS_CHECK_NULL_RETURN(device, nullptr, "Create device(%s) failed", name);
 
     ESP_UTILS_LOG_TRACE_EXIT();
@@ -129,9 +112,33 @@ int BusFactory::getConfigType(const Config &config)
 
 utils::string BusFactory::getTypeNameString(int type)
 {
-    auto it = _type_name_map.find(type);
-    if (it != _type_name_map.end()) {
-        return it->second;
+    return getTypeName(type);
+}
+
+#define TYPE_NAME_CASE(type_name) \
+    case Bus ##type_name::BASIC_ATTRIBUTES_DEFAULT.type: \
+        return #type_name;
+
+const char *BusFactory::getTypeName(int type)
+{
+    switch (type) {
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_I2C
+    TYPE_NAME_CASE(I2C)
+#endif
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_SPI
+    TYPE_NAME_CASE(SPI)
+#endif
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_QSPI
+    TYPE_NAME_CASE(QSPI)
+#endif
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
+    TYPE_NAME_CASE(RGB)
+#endif
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_MIPI_DSI
+    TYPE_NAME_CASE(DSI)
+#endif
+    default:
+        break;
     }
 
     return "Unknown";
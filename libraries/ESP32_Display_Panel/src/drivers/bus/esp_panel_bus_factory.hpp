@@ -5,9 +5,7 @@
  */
 #pragma once
 
-#include <unordered_map>
 #include <memory>
-#include <string>
 #include <variant>
 #include "soc/soc_caps.h"
 #include "utils/esp_panel_utils_cxx.hpp"
@@ -56,6 +54,9 @@ public:
      * @param[in] config The bus configuration
      *
      * @return Shared pointer to the device if successful, `nullptr` otherwise
+     *
+     * @note The device class is selected from the configuration type at compile time, so only the buses enabled by
+     *       `ESP_PANEL_DRIVERS_BUS_USE_*` are referenced
      */
     static std::shared_ptr<Bus> create(const Config &config);
 
@@ -79,18 +80,13 @@ public:
 
 private:
     /**
-     * @brief Map of bus types to their type names
+     * @brief Get the name of a bus type
      *
-     * Maps each bus type to its type name string
-     */
-    static const utils::unordered_map<int, utils::string> _type_name_map;
-
-    /**
-     * @brief Map of bus types to their constructors and type names
+     * @param[in] type The bus type (`ESP_PANEL_BUS_TYPE_*`)
      *
-     * Maps each bus type to its constructor function
+     * @return Bus type name if successful, `"Unknown"` otherwise
      */
-    static const utils::unordered_map<int, FunctionDeviceConstructor> _type_constructor_map;
+    static const char *getTypeName(int type);
 };
 
 } // namespace esp_panel::drivers
@@ -16,6 +16,7 @@
 #include "utils/esp_panel_utils_log.h"
 #include "esp_utils_helpers.h"
 #include "esp_lcd_panel_io_additions.h"
+#include "esp_lcd_panel_io_3wire_spi_wave.h"
 
 #define LCD_CMD_BYTES_MAX       (sizeof(uint32_t))  // Maximum number of bytes for LCD command
 #define LCD_PARAM_BYTES_MAX     (sizeof(uint32_t))  // Maximum number of bytes for LCD parameter
@@ -23,8 +24,6 @@
 #define DATA_DC_BIT_0           (0)     // DC bit = 0
 #define DATA_DC_BIT_1           (1)     // DC bit = 1
 #define DATA_NO_DC_BIT          (2)     // No DC bit
-#define WRITE_ORDER_LSB_MASK    (0x01)  // Bit mask for LSB first write order
-#define WRITE_ORDER_MSB_MASK    (0x80)  // Bit mask for MSB first write order
 
 /**
  * @brief Enumeration of SPI lines
@@ -48,16 +47,15 @@ typedef struct {
     panel_io_type_t sda_io_type;            /*!< IO type of SDA line */
     int sda_io_num;                         /*!< GPIO used for SDA line */
     esp_io_expander_handle_t io_expander;   /*!< IO expander handle, set to NULL if not used */
+    uint32_t expander_pin_mask;             /*!< Pins of IO expander used by the lines */
     uint32_t scl_half_period_us;            /*!< SCL half period in us */
     uint32_t lcd_cmd_bytes: 3;              /*!< Bytes of LCD command (1 ~ 4) */
     uint32_t cmd_dc_bit: 2;                 /*!< DC bit of command */
     uint32_t lcd_param_bytes: 3;            /*!< Bytes of LCD parameter (1 ~ 4) */
     uint32_t param_dc_bit: 2;               /*!< DC bit of parameter */
-    uint32_t write_order_mask: 8;           /*!< Bit mask of write order */
+    uint8_t line_state;                     /*!< Current levels of the lines, see `SPI_3WIRE_WAVE_*` */
+    spi_3wire_wave_config_t wave_config;    /*!< Line levels used to encode the packages */
     struct {
-        uint32_t cs_high_active: 1;         /*!< If this flag is enabled, CS line is high active */
-        uint32_t sda_scl_idle_high: 1;      /*!< If this flag is enabled, SDA and SCL line are high when idle */
-        uint32_t scl_active_rising_edge: 1; /*!< If this flag is enabled, SCL line is active on rising edge */
         uint32_t del_keep_cs_inactive: 1;   /*!< If this flag is enabled, keep CS line inactive even if panel_io is deleted */
     } flags;
 } esp_lcd_panel_io_3wire_spi_t;
@@ -109,14 +107,14 @@ esp_err_t esp_lcd_new_panel_io_3wire_spi(const esp_lcd_panel_io_3wire_spi_config
         panel_io->param_dc_bit = DATA_NO_DC_BIT;
         panel_io->cmd_dc_bit = DATA_NO_DC_BIT;
     }
-    panel_io->write_order_mask = io_config->flags.lsb_first ? WRITE_ORDER_LSB_MASK : WRITE_ORDER_MSB_MASK;
-    panel_io->flags.cs_high_active = io_config->flags.cs_high_active;
+    panel_io->wave_config.lsb_first = io_config->flags.lsb_first;
+    panel_io->wave_config.cs_high_active = io_config->flags.cs_high_active;
     panel_io->flags.del_keep_cs_inactive = io_config->flags.del_keep_cs_inactive;
-    panel_io->flags.sda_scl_idle_high = io_config->spi_mode & 0x1;
-    if (panel_io->flags.sda_scl_idle_high) {
-        panel_io->flags.scl_active_rising_edge = (io_config->spi_mode & 0x2) ? 1 : 0;
+    panel_io->wave_config.sda_scl_idle_high = io_config->spi_mode & 0x1;
+    if (panel_io->wave_config.sda_scl_idle_high) {
+        panel_io->wave_config.scl_active_rising_edge = (io_config->spi_mode & 0x2) ? 1 : 0;
     } else {
-        panel_io->flags.scl_active_rising_edge = (io_config->spi_mode & 0x2) ? 0 : 1;
+        panel_io->wave_config.scl_active_rising_edge = (io_config->spi_mode & 0x2) ? 0 : 1;
     }
 
     panel_io->base.rx_param = panel_io_rx_param;
@@ -160,12 +158,14 @@ esp_err_t esp_lcd_new_panel_io_3wire_spi(const esp_lcd_panel_io_3wire_spi_config
                           TAG, "Expander set dir failed");
     }
 
+    panel_io->expander_pin_mask = expander_pin_mask;
+
     // Set CS, SCL and SDA to idle level
-    uint32_t cs_idle_level = panel_io->flags.cs_high_active ? 0 : 1;
-    uint32_t sda_scl_idle_level = panel_io->flags.sda_scl_idle_high ? 1 : 0;
-    ESP_GOTO_ON_ERROR(set_line_level(panel_io, CS, cs_idle_level), err, TAG, "Set CS level failed");
-    ESP_GOTO_ON_ERROR(set_line_level(panel_io, SCL, sda_scl_idle_level), err, TAG, "Set SCL level failed");
-    ESP_GOTO_ON_ERROR(set_line_level(panel_io, SDA, sda_scl_idle_level), err, TAG, "Set SDA level failed");
+    uint8_t idle_state = spi_3wire_wave_get_idle_state(&panel_io->wave_config);
+    ESP_GOTO_ON_ERROR(set_line_level(panel_io, CS, idle_state & SPI_3WIRE_WAVE_CS), err, TAG, "Set CS level failed");
+    ESP_GOTO_ON_ERROR(set_line_level(panel_io, SCL, idle_state & SPI_3WIRE_WAVE_SCL), err, TAG, "Set SCL level failed");
+    ESP_GOTO_ON_ERROR(set_line_level(panel_io, SDA, idle_state & SPI_3WIRE_WAVE_SDA), err, TAG, "Set SDA level failed");
+    panel_io->line_state = idle_state;
 
     *ret_io = (esp_lcd_panel_io_handle_t)panel_io;
     return ESP_OK;
@@ -361,41 +361,86 @@ static void delay_us(uint32_t delay_us)
 }
 
 /**
- * @brief Write one byte to LCD panel
+ * @brief Get the pin of IO expander used by the line
+ *
+ * @param[in] panel_io Pointer to panel IO instance
+ * @param[in] line     Target line
+ *
+ * @return
+ *      - Pin mask, 0 if the line uses GPIO
+ */
+static uint32_t get_line_expander_pin(esp_lcd_panel_io_3wire_spi_t *panel_io, spi_line_t line)
+{
+    switch (line) {
+    case CS:
+        return (panel_io->cs_io_type == IO_TYPE_EXPANDER) ? panel_io->cs_io_num : 0;
+    case SCL:
+        return (panel_io->scl_io_type == IO_TYPE_EXPANDER) ? panel_io->scl_io_num : 0;
+    case SDA:
+        return (panel_io->sda_io_type == IO_TYPE_EXPANDER) ? panel_io->sda_io_num : 0;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Output the states of a waveform, each one is held for a half period of SCL
+ *
+ * The GPIO lines are set only when their levels change. The lines on the IO expander are set together with one write
+ * of the output register per state, and the register is read only once per waveform, instead of reading the direction
+ * and output registers for every level as `esp_io_expander_set_level()` does.
  *
  * @param[in] panel_io Pointer to panel IO instance
- * @param[in] dc_bit   DC bit
- * @param[in] data     8-bit data to write
+ * @param[in] states   States of the lines, see `SPI_3WIRE_WAVE_*`
+ * @param[in] count    Number of states
  *
  * @return
  *      - ESP_OK:              Success
  *      - ESP_ERR_INVALID_ARG: Invalid argument
  *      - Others:              Fail
  */
-static esp_err_t spi_write_byte(esp_lcd_panel_io_3wire_spi_t *panel_io, int dc_bit, uint8_t data)
+static esp_err_t spi_write_wave(esp_lcd_panel_io_3wire_spi_t *panel_io, const uint8_t *states, size_t count)
 {
-    uint16_t data_temp = data;
-    uint8_t data_bits = (dc_bit != DATA_NO_DC_BIT) ? 9 : 8;
-    uint16_t write_order_mask = panel_io->write_order_mask;
-    uint32_t scl_active_befor_level = panel_io->flags.scl_active_rising_edge ? 0 : 1;
-    uint32_t scl_active_after_level = !scl_active_befor_level;
-    uint32_t scl_half_period_us = panel_io->scl_half_period_us;
-
-    for (uint8_t i = 0; i < data_bits; i++) {
-        // Send DC bit first
-        if (data_bits == 9 && i == 0) {
-            ESP_RETURN_ON_ERROR(set_line_level(panel_io, SDA, dc_bit), TAG, "Set SDA level failed");
-        } else { // Then send data bit
-            // SDA set to data bit
-            ESP_RETURN_ON_ERROR(set_line_level(panel_io, SDA, data_temp & write_order_mask), TAG, "Set SDA level failed");
-            // Get next bit
-            data_temp = (write_order_mask == WRITE_ORDER_LSB_MASK) ? data_temp >> 1 : data_temp << 1;
+    static const spi_line_t lines[] = {CS, SCL, SDA};
+    static const uint8_t line_bits[] = {SPI_3WIRE_WAVE_CS, SPI_3WIRE_WAVE_SCL, SPI_3WIRE_WAVE_SDA};
+    esp_io_expander_handle_t expander = panel_io->io_expander;
+    uint32_t output_reg = 0;
+    bool use_expander_reg = false;
+
+    if (panel_io->expander_pin_mask) {
+        use_expander_reg = expander->read_output_reg && expander->write_output_reg;
+        if (use_expander_reg) {
+            ESP_RETURN_ON_ERROR(expander->read_output_reg(expander, &output_reg), TAG, "Read output reg failed");
         }
-        // Generate SCL active edge
-        ESP_RETURN_ON_ERROR(set_line_level(panel_io, SCL, scl_active_befor_level), TAG, "Set SCL level failed");
-        delay_us(scl_half_period_us);
-        ESP_RETURN_ON_ERROR(set_line_level(panel_io, SCL, scl_active_after_level), TAG, "Set SCL level failed");
-        delay_us(scl_half_period_us);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        uint8_t changed = states[i] ^ panel_io->line_state;
+        uint32_t new_output_reg = output_reg;
+
+        for (int j = 0; j < sizeof(lines) / sizeof(lines[0]); j++) {
+            if (!(changed & line_bits[j])) {
+                continue;
+            }
+            bool level = (states[i] & line_bits[j]) != 0;
+            uint32_t expander_pin = get_line_expander_pin(panel_io, lines[j]);
+            if (expander_pin && use_expander_reg) {
+                // Same rule as `esp_io_expander_set_level()`
+                if (level != (bool)expander->config.flags.output_high_bit_zero) {
+                    new_output_reg |= expander_pin;
+                } else {
+                    new_output_reg &= ~expander_pin;
+                }
+            } else {
+                ESP_RETURN_ON_ERROR(set_line_level(panel_io, lines[j], level), TAG, "Set line level failed");
+            }
+        }
+        if (new_output_reg != output_reg) {
+            ESP_RETURN_ON_ERROR(expander->write_output_reg(expander, new_output_reg), TAG, "Write output reg failed");
+            output_reg = new_output_reg;
+        }
+        panel_io->line_state = states[i];
+        delay_us(panel_io->scl_half_period_us);
     }
 
     return ESP_OK;
@@ -416,34 +461,21 @@ static esp_err_t spi_write_byte(esp_lcd_panel_io_3wire_spi_t *panel_io, int dc_b
 static esp_err_t spi_write_package(esp_lcd_panel_io_3wire_spi_t *panel_io, bool is_cmd, uint32_t data)
 {
     uint32_t data_bytes = is_cmd ? panel_io->lcd_cmd_bytes : panel_io->lcd_param_bytes;
-    uint32_t cs_idle_level = panel_io->flags.cs_high_active ? 0 : 1;
-    uint32_t sda_scl_idle_level = panel_io->flags.sda_scl_idle_high ? 1 : 0;
-    uint32_t scl_active_befor_level = panel_io->flags.scl_active_rising_edge ? 0 : 1;
-    uint32_t time_us = panel_io->scl_half_period_us;
     // Swap command bytes order due to different endianness
     uint32_t swap_data = SPI_SWAP_DATA_TX(data, data_bytes * 8);
     int data_dc_bit = is_cmd ? panel_io->cmd_dc_bit : panel_io->param_dc_bit;
+    uint8_t bytes[SPI_3WIRE_WAVE_BYTES_MAX] = {0};
+    uint8_t states[SPI_3WIRE_WAVE_STATES_MAX];
 
-    // CS active
-    ESP_RETURN_ON_ERROR(set_line_level(panel_io, CS, !cs_idle_level), TAG, "Set CS level failed");
-    delay_us(time_us);
-    ESP_RETURN_ON_ERROR(set_line_level(panel_io, SCL, scl_active_befor_level), TAG, "Set SCL level failed");
-    // Send data byte by byte
     for (int i = 0; i < data_bytes; i++) {
-        // Only set DC bit for the first byte
-        if (i == 0) {
-            ESP_RETURN_ON_ERROR(spi_write_byte(panel_io, data_dc_bit, swap_data & 0xff), TAG, "SPI write byte failed");
-        } else {
-            ESP_RETURN_ON_ERROR(spi_write_byte(panel_io, DATA_NO_DC_BIT, swap_data & 0xff), TAG, "SPI write byte failed");
-        }
+        bytes[i] = swap_data & 0xff;
         swap_data >>= 8;
     }
-    ESP_RETURN_ON_ERROR(set_line_level(panel_io, SCL, sda_scl_idle_level), TAG, "Set SCL level failed");
-    ESP_RETURN_ON_ERROR(set_line_level(panel_io, SDA, sda_scl_idle_level), TAG, "Set SDA level failed");
-    delay_us(time_us);
-    // CS inactive
-    ESP_RETURN_ON_ERROR(set_line_level(panel_io, CS, cs_idle_level), TAG, "Set CS level failed");
-    delay_us(time_us);
+    // Only set DC bit for the first byte
+    size_t count = spi_3wire_wave_encode(&panel_io->wave_config,
+                                         (data_dc_bit == DATA_NO_DC_BIT) ? SPI_3WIRE_WAVE_NO_DC_BIT : data_dc_bit,
+                                         bytes, data_bytes, states);
+    ESP_RETURN_ON_FALSE(count > 0, ESP_ERR_INVALID_ARG, TAG, "Encode package failed");
 
-    return ESP_OK;
+    return spi_write_wave(panel_io, states, count);
 }
@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_lcd_panel_io_3wire_spi_wave.h"
+
+uint8_t spi_3wire_wave_get_idle_state(const spi_3wire_wave_config_t *config)
+{
+    uint8_t state = config->cs_high_active ? 0 : SPI_3WIRE_WAVE_CS;
+    if (config->sda_scl_idle_high) {
+        state |= SPI_3WIRE_WAVE_SCL | SPI_3WIRE_WAVE_SDA;
+    }
+
+    return state;
+}
+
+size_t spi_3wire_wave_encode(const spi_3wire_wave_config_t *config, int dc_bit, const uint8_t *data, size_t data_size,
+                             uint8_t *states)
+{
+    if ((config == NULL) || (states == NULL) || ((data == NULL) && (data_size > 0)) ||
+            (data_size > SPI_3WIRE_WAVE_BYTES_MAX)) {
+        return 0;
+    }
+
+    uint8_t idle_state = spi_3wire_wave_get_idle_state(config);
+    uint8_t cs_active = config->cs_high_active ? SPI_3WIRE_WAVE_CS : 0;
+    uint8_t scl_before = config->scl_active_rising_edge ? 0 : SPI_3WIRE_WAVE_SCL;
+    uint8_t scl_after = scl_before ^ SPI_3WIRE_WAVE_SCL;
+    size_t count = 0;
+
+    // CS active, SCL and SDA stay idle
+    uint8_t idle_lines = idle_state & (SPI_3WIRE_WAVE_SCL | SPI_3WIRE_WAVE_SDA);
+    states[count++] = cs_active | idle_lines;
+
+    // DC bit and data bits, SDA is set together with the inactive edge and sampled at the active edge
+    int dc_bits = (dc_bit != SPI_3WIRE_WAVE_NO_DC_BIT) ? 1 : 0;
+    int bits = (int)data_size * 8 + dc_bits;
+    for (int i = 0; i < bits; i++) {
+        int bit = 0;
+        if (i < dc_bits) {
+            bit = (dc_bit != 0);
+        } else {
+            int data_bit = i - dc_bits;
+            int shift = config->lsb_first ? (data_bit % 8) : (7 - data_bit % 8);
+            bit = (data[data_bit / 8] >> shift) & 0x1;
+        }
+        uint8_t sda = bit ? SPI_3WIRE_WAVE_SDA : 0;
+        states[count++] = cs_active | scl_before | sda;
+        states[count++] = cs_active | scl_after | sda;
+    }
+
+    // SCL and SDA back to idle, then CS inactive
+    states[count++] = cs_active | idle_lines;
+    states[count++] = idle_state;
+
+    return count;
+}
@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bits of a waveform state, set if the line is high
+#define SPI_3WIRE_WAVE_CS           (1U << 0)
+#define SPI_3WIRE_WAVE_SCL          (1U << 1)
+#define SPI_3WIRE_WAVE_SDA          (1U << 2)
+
+// No DC bit is sent before the data
+#define SPI_3WIRE_WAVE_NO_DC_BIT    (-1)
+
+// Maximum number of data bytes in a package
+#define SPI_3WIRE_WAVE_BYTES_MAX    (4)
+// Maximum number of states of a package: CS active, two states per bit (with DC bit), SCL/SDA idle and CS inactive
+#define SPI_3WIRE_WAVE_STATES_MAX   (1 + 2 * (SPI_3WIRE_WAVE_BYTES_MAX * 8 + 1) + 2)
+
+/**
+ * @brief Line levels of the 3-wire SPI protocol
+ */
+typedef struct {
+    uint32_t cs_high_active: 1;         /*!< If this flag is enabled, CS line is high active */
+    uint32_t sda_scl_idle_high: 1;      /*!< If this flag is enabled, SDA and SCL line are high when idle */
+    uint32_t scl_active_rising_edge: 1; /*!< If this flag is enabled, SCL line is active on rising edge */
+    uint32_t lsb_first: 1;              /*!< If this flag is enabled, bits of a byte are sent LSB first */
+} spi_3wire_wave_config_t;
+
+/**
+ * @brief Encode a package as the states of the CS, SCL and SDA lines
+ *
+ * Each state is held for a half period of SCL. The SDA line changes together with the inactive edge of SCL, so each
+ * bit takes two states and the lines can be written together (e.g. with one write of an IO expander output register).
+ *
+ * @param[in]  config    Line levels of the protocol
+ * @param[in]  dc_bit    DC bit sent before the data (0 or 1), or `SPI_3WIRE_WAVE_NO_DC_BIT`
+ * @param[in]  data      Data bytes in the sending order
+ * @param[in]  data_size Number of data bytes, up to `SPI_3WIRE_WAVE_BYTES_MAX`
+ * @param[out] states    Buffer of at least `SPI_3WIRE_WAVE_STATES_MAX` states
+ *
+ * @return
+ *      - Number of encoded states, 0 if the arguments are invalid
+ */
+size_t spi_3wire_wave_encode(const spi_3wire_wave_config_t *config, int dc_bit, const uint8_t *data, size_t data_size,
+                             uint8_t *states);
+
+/**
+ * @brief Get the state of the lines when no package is sent
+ *
+ * @param[in] config Line levels of the protocol
+ *
+ * @return
+ *      - Idle state
+ */
+uint8_t spi_3wire_wave_get_idle_state(const spi_3wire_wave_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <cstring>
 #include "utils/esp_panel_utils_log.h"
 #include "esp_io_expander.hpp"
 #include "esp_panel_io_expander_conf_internal.h"
@@ -22,33 +23,37 @@ namespace esp_panel::drivers {
         ); \
         return device; \
     }
-#define MAP_ITEM(chip) \
+#define TABLE_ITEM(chip) \
     {#chip, DEVICE_CREATOR(chip)}
 
-const utils::unordered_map<utils::string, IO_ExpanderFactory::FunctionDeviceConstructor>
-IO_ExpanderFactory::_name_function_map = {
+const IO_ExpanderFactory::DeviceCreator IO_ExpanderFactory::_device_creators[] = {
 #if ESP_PANEL_DRIVERS_EXPANDER_USE_CH422G
-    MAP_ITEM(CH422G),
+    TABLE_ITEM(CH422G),
 #endif
 #if ESP_PANEL_DRIVERS_EXPANDER_USE_HT8574
-    MAP_ITEM(HT8574),
+    TABLE_ITEM(HT8574),
 #endif
 #if ESP_PANEL_DRIVERS_EXPANDER_USE_TCA95XX_8BIT
-    MAP_ITEM(TCA95XX_8BIT),
+    TABLE_ITEM(TCA95XX_8BIT),
 #endif
 #if ESP_PANEL_DRIVERS_EXPANDER_USE_TCA95XX_16BIT
-    MAP_ITEM(TCA95XX_16BIT),
+    TABLE_ITEM(TCA95XX_16BIT),
 #endif
+    {nullptr, nullptr},
 };
 
-std::shared_ptr<IO_Expander> IO_ExpanderFactory::create(utils::string name, const IO_Expander::Config &config)
+std::shared_ptr<IO_Expander> IO_ExpanderFactory::create(const char *name, const IO_Expander::Config &config)
 {
-    ESP_UTILS_LOGD("Param: name(%s), config(@%p)", name.c_str(), &config);
+    ESP_UTILS_CHECK_NULL_RETURN(name, nullptr, "Invalid name");
+    ESP_UTILS_LOGD("Param: name(%s), config(@%p)", name, &config);
 
-    auto it = _name_function_map.find(name);
-    ESP_UTILS_CHECK_FALSE_RETURN(it != _name_function_map.end(), nullptr, "Unknown controller: %s", name.c_str());
+    const DeviceCreator *creator = _device_creators;
+    while ((creator->name != nullptr) && (strcmp(creator->name, name) != 0)) {
+        creator++;
+    }
+    ESP_UTILS_CHECK_NULL_RETURN(creator->name, nullptr, "Unknown controller: %s", name);
 
-    std::shared_ptr<IO_Expander> device = it->second(config);
+    std::shared_ptr<IO_Expander> device = creator->function(config);
     ESP_UTILS_CHECK_NULL_RETURN(device, nullptr, "Create device failed");
 
     return device;
@@ -5,9 +5,7 @@
  */
 #pragma once
 
-#include <unordered_map>
 #include <memory>
-#include <string>
 #include "utils/esp_panel_utils_cxx.hpp"
 #include "esp_panel_io_expander.hpp"
 #include "esp_panel_io_expander_conf_internal.h"
@@ -33,14 +31,36 @@ public:
      * @param[in] name Name of the IO expander device to create
      * @param[in] config Configuration for the IO expander device
      * @return Shared pointer to the created IO expander device if successful, nullptr otherwise
+     * @note The name is looked up in a constant table which only contains the enabled chips
+     *       (`ESP_PANEL_DRIVERS_EXPANDER_USE_*`)
      */
-    static std::shared_ptr<IO_Expander> create(utils::string name, const IO_Expander::Config &config);
+    static std::shared_ptr<IO_Expander> create(const char *name, const IO_Expander::Config &config);
+
+    /**
+     * @brief Create a new IO expander device instance
+     *
+     * @param[in] name Name of the IO expander device to create
+     * @param[in] config Configuration for the IO expander device
+     * @return Shared pointer to the created IO expander device if successful, nullptr otherwise
+     */
+    static std::shared_ptr<IO_Expander> create(const utils::string &name, const IO_Expander::Config &config)
+    {
+        return create(name.c_str(), config);
+    }
 
 private:
     /**
-     * @brief Map of IO expander device names to their constructor functions
+     * @brief Item of the table associating IO expander device names with their constructor functions
+     */
+    struct DeviceCreator {
+        const char *name;
+        FunctionDeviceConstructor function;
+    };
+
+    /**
+     * @brief Constant table of the enabled IO expander devices, terminated by an item with a `nullptr` name
      */
-    static const utils::unordered_map<utils::string, FunctionDeviceConstructor> _name_function_map;
+    static const DeviceCreator _device_creators[];
 };
 
 } // namespace esp_panel::drivers
@@ -132,9 +132,11 @@ void LCD::Config::convertPartialToFull()
             .ver_res = config.ver_res,
             .init_cmds = config.init_cmds,
             .init_cmds_size = static_cast<unsigned int>(config.init_cmds_size),
+            .te_gpio_num = config.te_gpio_num,
             .flags = {
                 .mirror_by_cmd = config.flags_mirror_by_cmd,
                 .enable_io_multiplex = config.flags_enable_io_multiplex,
+                .use_te_signal = (config.te_gpio_num >= 0),
             },
         };
     }
@@ -190,6 +192,7 @@ void LCD::Config::printVendorConfig() const
             "\n\t\t-> [ver_res]: %d"
             "\n\t\t-> [init_cmds]: %p"
             "\n\t\t-> [init_cmds_size]: %d"
+            "\n\t\t-> [te_gpio_num]: %d"
 #if ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
             "\n\t\t-> [rgb_config]: %p"
 #endif // ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
@@ -203,6 +206,7 @@ void LCD::Config::printVendorConfig() const
             , config.ver_res
             , config.init_cmds
             , config.init_cmds_size
+            , config.te_gpio_num
 #if ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
             , config.rgb_config
 #endif // ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
@@ -220,12 +224,14 @@ void LCD::Config::printVendorConfig() const
             "\n\t\t\t-> [use_qspi_interface]: %d"
             "\n\t\t\t-> [use_rgb_interface]: %d"
             "\n\t\t\t-> [use_mipi_interface]: %d"
+            "\n\t\t\t-> [use_te_signal]: %d"
             , config.flags.mirror_by_cmd
             , config.flags.enable_io_multiplex
             , config.flags.use_spi_interface
             , config.flags.use_qspi_interface
             , config.flags.use_rgb_interface
             , config.flags.use_mipi_interface
+            , config.flags.use_te_signal
         );
     } else {
         auto &config = std::get<VendorPartialConfig>(vendor);
@@ -237,12 +243,14 @@ void LCD::Config::printVendorConfig() const
             "\n\t\t-> [init_cmds_size]: %d"
             "\n\t\t-> [flags_mirror_by_cmd]: %d"
             "\n\t\t-> [flags_enable_io_multiplex]: %d"
+            "\n\t\t-> [te_gpio_num]: %d"
             , config.hor_res
             , config.ver_res
             , config.init_cmds
             , config.init_cmds_size
             , config.flags_mirror_by_cmd
             , config.flags_enable_io_multiplex
+            , config.te_gpio_num
         );
     }
 
@@ -417,14 +425,12 @@ bool LCD::begin()
         goto end;
     }
 
-    /* For non-RGB bus, create Semaphore for `drawBitmap()` to wait for finish */
-    if ((bus_type != ESP_PANEL_BUS_TYPE_RGB) && (_interruption.draw_bitmap_finish_sem == nullptr)) {
-        _interruption.on_draw_bitmap_finish_sem_buffer = utils::make_shared<StaticSemaphore_t>();
-        ESP_UTILS_CHECK_NULL_RETURN(
-            _interruption.on_draw_bitmap_finish_sem_buffer, false, "Create draw bitmap finish semaphore failed"
+    /* For non-RGB bus, create flags for `drawBitmap()` to wait for finish */
+    if ((bus_type != ESP_PANEL_BUS_TYPE_RGB) && (_interruption.flags == nullptr)) {
+        ESP_UTILS_CHECK_EXCEPTION_RETURN(
+            _interruption.flags = utils::make_shared<utils::EventFlags>(), false,
+            "Create draw bitmap finish flags failed"
         );
-        _interruption.draw_bitmap_finish_sem =
-            xSemaphoreCreateBinaryStatic(_interruption.on_draw_bitmap_finish_sem_buffer.get());
     }
 
     /*  Register callback for different bus */
@@ -538,6 +544,7 @@ bool LCD::del()
 bool LCD::drawBitmap(int x_start, int y_start, int width, int height, const uint8_t *color_data, int timeout_ms)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+    ESP_UTILS_TRACE_SCOPE("LCD::drawBitmap");
 
     ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
 
@@ -587,21 +594,23 @@ bool LCD::drawBitmap(int x_start, int y_start, int width, int height, const uint
     }
 
     // Send data to the panel
+    ESP_UTILS_PERF_HISTOGRAM_SCOPE_US("lcd.draw_bitmap_us");
     ESP_UTILS_CHECK_ERROR_RETURN(
         esp_lcd_panel_draw_bitmap(refresh_panel, x_start, y_start, x_end, y_end, color_data), false,
         "Draw bitmap failed"
     );
+    ESP_UTILS_PERF_COUNTER_ADD("lcd.draw_bitmap", 1);
+    ESP_UTILS_PERF_COUNTER_ADD("lcd.bus_bytes", width * height * getColorBits() / 8);
 
     // For RGB bus, since `drawBitmap()` uses `memcpy()` instead of DMA operation, doesn't need to wait for finish
     if ((getBus()->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_RGB) &&
             (_interruption.on_draw_bitmap_finish != nullptr)) {
         _interruption.on_draw_bitmap_finish(_interruption.data.user_data);
     }
-    /* Otherwise, wait for the semaphore to be given by the callback function */
-    if ((_interruption.draw_bitmap_finish_sem != nullptr) && (timeout_ms != 0)) {
-        BaseType_t timeout_tick = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    /* Otherwise, wait for the flag to be set by the callback function */
+    if ((_interruption.flags != nullptr) && (timeout_ms != 0)) {
         ESP_UTILS_CHECK_FALSE_RETURN(
-            xSemaphoreTake(_interruption.draw_bitmap_finish_sem, timeout_tick) == pdTRUE, false,
+            _interruption.flags->wait(Interruption::FLAG_DRAW_BITMAP_FINISH, timeout_ms) != 0, false,
             "Draw bitmap wait for finish timeout"
         );
     }
@@ -1235,8 +1244,8 @@ IRAM_ATTR bool LCD::onDrawBitmapFinish(void *panel_io, void *edata, void *user_c
         need_yield =
             lcd_ptr->_interruption.on_draw_bitmap_finish(lcd_ptr->_interruption.data.user_data) ? pdTRUE : need_yield;
     }
-    if (lcd_ptr->_interruption.draw_bitmap_finish_sem != nullptr) {
-        xSemaphoreGiveFromISR(lcd_ptr->_interruption.draw_bitmap_finish_sem, &need_yield);
+    if (lcd_ptr->_interruption.flags != nullptr) {
+        lcd_ptr->_interruption.flags->setFromISR(Interruption::FLAG_DRAW_BITMAP_FINISH, &need_yield);
     }
 
     return (need_yield == pdTRUE);
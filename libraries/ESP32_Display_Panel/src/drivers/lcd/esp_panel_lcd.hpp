@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <variant>
 #include <map>
 #include <memory>
@@ -13,8 +14,8 @@
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_panel_vendor.h"
 #include "freertos/FreeRTOS.h"
-#include "freertos/semphr.h"
 #include "utils/esp_panel_utils_cxx.hpp"
+#include "utils/esp_panel_utils_sync.hpp"
 #include "drivers/bus/esp_panel_bus_factory.hpp"
 #include "port/esp_panel_lcd_vendor_types.h"
 #include "esp_panel_lcd_conf_internal.h"
@@ -163,6 +164,7 @@ public:
         int init_cmds_size = 0;                     /*!< Size of initialization commands array (in bytes) */
         bool flags_mirror_by_cmd = 1;               /*!< Enable mirroring via commands */
         bool flags_enable_io_multiplex = 0;         /*!< Enable IO pin multiplexing */
+        int te_gpio_num = -1;                       /*!< Tearing effect (TE) signal GPIO pin number (-1 if unused) */
     };
     using VendorFullConfig = esp_panel_lcd_vendor_config_t;
     using VendorConfig = std::variant<VendorPartialConfig, VendorFullConfig>;
@@ -887,11 +889,12 @@ private:
             void *user_data = nullptr;    /*!< User provided data */
         };
 
+        static constexpr uint32_t FLAG_DRAW_BITMAP_FINISH = (1U << 0);   /*!< Set when a bitmap transfer finishes */
+
         CallbackData data = {};                                           /*!< Callback data */
         FunctionDrawBitmapFinishCallback on_draw_bitmap_finish = nullptr; /*!< Draw completion callback */
         FunctionRefreshFinishCallback on_refresh_finish = nullptr;        /*!< Refresh completion callback */
-        SemaphoreHandle_t draw_bitmap_finish_sem = nullptr;              /*!< Draw completion semaphore */
-        std::shared_ptr<StaticSemaphore_t> on_draw_bitmap_finish_sem_buffer = nullptr; /*!< Semaphore buffer */
+        std::shared_ptr<utils::EventFlags> flags = nullptr;               /*!< Flags for `drawBitmap()` to wait */
     };
 
     /**
@@ -936,7 +939,7 @@ private:
     BasicAttributes _basic_attributes = {};     /*!< Basic device attributes */
     std::shared_ptr<Bus> _bus = nullptr;        /*!< Bus interface pointer */
     Config _config = {};                        /*!< Device configuration */
-    State _state = State::DEINIT;               /*!< Current driver state */
+    std::atomic<State> _state = State::DEINIT;  /*!< Current driver state */
     Transformation _transformation = {};        /*!< Coordinate transformation settings */
     Interruption _interruption = {};            /*!< Interrupt handling */
 };
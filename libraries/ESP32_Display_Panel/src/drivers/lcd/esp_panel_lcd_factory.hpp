@@ -5,9 +5,8 @@
  */
 #pragma once
 
-#include <unordered_map>
 #include <memory>
-#include <string>
+#include "utils/esp_panel_utils_log.h"
 #include "esp_panel_lcd.hpp"
 #include "esp_panel_lcd_axs15231b.hpp"
 #include "esp_panel_lcd_ek9716b.hpp"
@@ -60,17 +59,65 @@ public:
      *
      * @return Shared pointer to the created LCD device if successful, nullptr otherwise
      *
-     * @note This is a static factory method that creates LCD device instances based on the provided name
+     * @note This is a static factory method that creates LCD device instances based on the provided name. The name
+     *       is looked up in a constant table which only contains the enabled controllers (`ESP_PANEL_DRIVERS_LCD_USE_*`)
      */
     static std::shared_ptr<LCD> create(
-        utils::string name, const BusFactory::Config &bus_config, const LCD::Config &lcd_config
+        const char *name, const BusFactory::Config &bus_config, const LCD::Config &lcd_config
     );
 
+    /**
+     * @brief Create a new LCD device instance
+     *
+     * @param[in] name Name of the LCD device to create
+     * @param[in] bus_config Bus configuration
+     * @param[in] lcd_config LCD configuration
+     *
+     * @return Shared pointer to the created LCD device if successful, nullptr otherwise
+     */
+    static std::shared_ptr<LCD> create(
+        const utils::string &name, const BusFactory::Config &bus_config, const LCD::Config &lcd_config
+    )
+    {
+        return create(name.c_str(), bus_config, lcd_config);
+    }
+
+    /**
+     * @brief Create a new LCD device instance of a controller selected at compile time
+     *
+     * @tparam T LCD device class, e.g. `LCD_ST7701`
+     *
+     * @param[in] bus_config Bus configuration
+     * @param[in] lcd_config LCD configuration
+     *
+     * @return Shared pointer to the created LCD device if successful, nullptr otherwise
+     *
+     * @note Only the code of `T` is referenced, and no name lookup is performed
+     */
+    template <class T>
+    static std::shared_ptr<LCD> create(const BusFactory::Config &bus_config, const LCD::Config &lcd_config)
+    {
+        std::shared_ptr<LCD> device = nullptr;
+        ESP_UTILS_CHECK_EXCEPTION_RETURN(
+            (device = utils::make_shared<T>(bus_config, lcd_config)), nullptr, "Create %s failed",
+            T::BASIC_ATTRIBUTES_DEFAULT.name
+        );
+        return device;
+    }
+
 private:
     /**
-     * @brief Map of LCD device names to their constructor functions
+     * @brief Item of the table associating LCD device names with their constructor functions
+     */
+    struct DeviceCreator {
+        const char *name;
+        FunctionDeviceConstructor function;
+    };
+
+    /**
+     * @brief Constant table of the enabled LCD devices, terminated by an item with a `nullptr` name
      */
-    static const utils::unordered_map<utils::string, FunctionDeviceConstructor> _name_function_map;
+    static const DeviceCreator _device_creators[];
 };
 
 } // namespace esp_panel::drivers
@@ -25,6 +25,7 @@
 #include "utils/esp_panel_utils_log.h"
 #include "esp_utils_helpers.h"
 #include "esp_panel_lcd_vendor_types.h"
+#include "esp_lcd_te_sync.h"
 
 #define LCD_OPCODE_WRITE_CMD                (0x02ULL)
 #define LCD_OPCODE_READ_CMD                 (0x0BULL)
@@ -53,6 +54,8 @@ typedef struct {
     uint8_t colmod_val; // save surrent value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_lcd_window_cache_t window;  // last window sent to the panel
+    esp_lcd_te_sync_handle_t te_sync;
     struct {
         unsigned int use_qspi_interface: 1;
         unsigned int reset_level: 1;
@@ -110,9 +113,14 @@ esp_err_t esp_lcd_new_panel_axs15231b(const esp_lcd_panel_io_handle_t io, const
     axs15231b->reset_gpio_num = panel_dev_config->reset_gpio_num;
     axs15231b->flags.reset_level = panel_dev_config->flags.reset_active_high;
     if (panel_dev_config->vendor_config) {
-        axs15231b->init_cmds = ((esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds;
-        axs15231b->init_cmds_size = ((esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds_size;
-        axs15231b->flags.use_qspi_interface = ((esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config)->flags.use_qspi_interface;
+        esp_panel_lcd_vendor_config_t *vendor_config = (esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config;
+        axs15231b->init_cmds = vendor_config->init_cmds;
+        axs15231b->init_cmds_size = vendor_config->init_cmds_size;
+        axs15231b->flags.use_qspi_interface = vendor_config->flags.use_qspi_interface;
+        if (vendor_config->flags.use_te_signal) {
+            ESP_GOTO_ON_ERROR(esp_lcd_new_te_sync(vendor_config->te_gpio_num, vendor_config->ver_res, &axs15231b->te_sync), err,
+                              TAG, "create TE sync failed");
+        }
     }
     axs15231b->base.del = panel_axs15231b_del;
     axs15231b->base.reset = panel_axs15231b_reset;
@@ -133,6 +141,7 @@ err:
         if (panel_dev_config->reset_gpio_num >= 0) {
             gpio_reset_pin(panel_dev_config->reset_gpio_num);
         }
+        esp_lcd_te_sync_del(axs15231b->te_sync);
         free(axs15231b);
     }
     return ret;
@@ -165,6 +174,7 @@ static esp_err_t panel_axs15231b_del(esp_lcd_panel_t *panel)
     if (axs15231b->reset_gpio_num >= 0) {
         gpio_reset_pin(axs15231b->reset_gpio_num);
     }
+    esp_lcd_te_sync_del(axs15231b->te_sync);
     ESP_LOGD(TAG, "del axs15231b panel @%p", axs15231b);
     free(axs15231b);
     return ESP_OK;
@@ -188,6 +198,8 @@ static esp_err_t panel_axs15231b_reset(esp_lcd_panel_t *panel)
         vTaskDelay(pdMS_TO_TICKS(120)); // spec, wait at least 5m before sending new command
     }
 
+    esp_lcd_window_cache_invalidate(&axs15231b->window);
+
     return ESP_OK;
 }
 
@@ -240,6 +252,12 @@ static esp_err_t panel_axs15231b_init(esp_lcd_panel_t *panel)
     ESP_RETURN_ON_ERROR(tx_param(axs15231b, io, LCD_CMD_COLMOD, (uint8_t[]) {
         axs15231b->colmod_val,
     }, 1), TAG, "send command failed");
+    if (axs15231b->te_sync) {
+        // Only the V-Blanking information is output on the TE signal
+        ESP_RETURN_ON_ERROR(tx_param(axs15231b, io, LCD_CMD_TEON, (uint8_t[]) {
+            0x00,
+        }, 1), TAG, "send command failed");
+    }
 
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds = NULL;
     uint16_t init_cmds_size = 0;
@@ -276,6 +294,11 @@ static esp_err_t panel_axs15231b_init(esp_lcd_panel_t *panel)
     }
     ESP_LOGI(TAG, "send init commands success");
 
+    // The initialization commands may change the window and the MADCTL register
+    esp_lcd_window_cache_invalidate(&axs15231b->window);
+    esp_lcd_te_sync_set_mirror_y(axs15231b->te_sync, axs15231b->madctl_val & LCD_CMD_MY_BIT);
+    esp_lcd_te_sync_set_swap_xy(axs15231b->te_sync, axs15231b->madctl_val & LCD_CMD_MV_BIT);
+
     return ESP_OK;
 }
 
@@ -284,29 +307,36 @@ static esp_err_t panel_axs15231b_draw_bitmap(esp_lcd_panel_t *panel, int x_start
     axs15231b_panel_t *axs15231b = __containerof(panel, axs15231b_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
     esp_lcd_panel_io_handle_t io = axs15231b->io;
+    esp_err_t ret = ESP_OK;
 
     x_start += axs15231b->x_gap;
     x_end += axs15231b->x_gap;
     y_start += axs15231b->y_gap;
     y_end += axs15231b->y_gap;
 
-    // define an area of frame memory where MCU can access
-    tx_param(axs15231b, io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4);
-
-    if (0 == axs15231b->flags.use_qspi_interface) {
-        tx_param(axs15231b, io, LCD_CMD_RASET, (uint8_t[]) {
+    // define an area of frame memory where MCU can access, the panel keeps the last one so it's only sent when changed
+    bool send_caset = false;
+    bool send_raset = false;
+    esp_lcd_window_cache_update(&axs15231b->window, x_start, y_start, x_end, y_end, &send_caset, &send_raset);
+    if (send_caset) {
+        ESP_GOTO_ON_ERROR(tx_param(axs15231b, io, LCD_CMD_CASET, (uint8_t[]) {
+            (x_start >> 8) & 0xFF,
+            x_start & 0xFF,
+            ((x_end - 1) >> 8) & 0xFF,
+            (x_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
+    if ((0 == axs15231b->flags.use_qspi_interface) && send_raset) {
+        ESP_GOTO_ON_ERROR(tx_param(axs15231b, io, LCD_CMD_RASET, (uint8_t[]) {
             (y_start >> 8) & 0xFF,
             y_start & 0xFF,
             ((y_end - 1) >> 8) & 0xFF,
             (y_end - 1) & 0xFF,
-        }, 4);
+        }, 4), err, TAG, "send command failed");
     }
 
+    // write the rows just behind the scan line of the panel to avoid tearing
+    esp_lcd_te_sync_wait(axs15231b->te_sync, y_start - axs15231b->y_gap, y_end - axs15231b->y_gap);
     // transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * axs15231b->fb_bits_per_pixel / 8;
     if (y_start == 0) {
@@ -316,6 +346,10 @@ static esp_err_t panel_axs15231b_draw_bitmap(esp_lcd_panel_t *panel, int x_start
     }
 
     return ESP_OK;
+
+err:
+    esp_lcd_window_cache_invalidate(&axs15231b->window);
+    return ret;
 }
 
 static esp_err_t panel_axs15231b_invert_color(esp_lcd_panel_t *panel, bool invert_color_data)
@@ -349,6 +383,7 @@ static esp_err_t panel_axs15231b_mirror(esp_lcd_panel_t *panel, bool mirror_x, b
     tx_param(axs15231b, io, LCD_CMD_MADCTL, (uint8_t[]) {
         axs15231b->madctl_val
     }, 1);
+    esp_lcd_te_sync_set_mirror_y(axs15231b->te_sync, mirror_y);
     return ESP_OK;
 }
 
@@ -364,6 +399,7 @@ static esp_err_t panel_axs15231b_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
     tx_param(axs15231b, io, LCD_CMD_MADCTL, (uint8_t[]) {
         axs15231b->madctl_val
     }, 1);
+    esp_lcd_te_sync_set_swap_xy(axs15231b->te_sync, swap_axes);
     return ESP_OK;
 }
 
@@ -26,6 +26,7 @@
 #include "utils/esp_panel_utils_log.h"
 #include "esp_utils_helpers.h"
 #include "esp_panel_lcd_vendor_types.h"
+#include "esp_lcd_te_sync.h"
 
 #define LCD_OPCODE_WRITE_CMD        (0x02ULL)
 #define LCD_OPCODE_READ_CMD         (0x0BULL)
@@ -59,6 +60,8 @@ typedef struct {
     uint8_t colmod_val; // save current value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_lcd_window_cache_t window;  // last window sent to the panel
+    esp_lcd_te_sync_handle_t te_sync;
     struct {
         unsigned int use_qspi_interface: 1;
         unsigned int reset_level: 1;
@@ -123,6 +126,10 @@ esp_err_t esp_lcd_new_panel_spd2010(const esp_lcd_panel_io_handle_t io, const es
         spd2010->init_cmds = vendor_config->init_cmds;
         spd2010->init_cmds_size = vendor_config->init_cmds_size;
         spd2010->flags.use_qspi_interface = vendor_config->flags.use_qspi_interface;
+        if (vendor_config->flags.use_te_signal) {
+            ESP_GOTO_ON_ERROR(esp_lcd_new_te_sync(vendor_config->te_gpio_num, vendor_config->ver_res, &spd2010->te_sync), err,
+                              TAG, "create TE sync failed");
+        }
     }
     spd2010->flags.reset_level = panel_dev_config->flags.reset_active_high;
     spd2010->base.del = panel_spd2010_del;
@@ -144,6 +151,7 @@ err:
         if (panel_dev_config->reset_gpio_num >= 0) {
             gpio_reset_pin(panel_dev_config->reset_gpio_num);
         }
+        esp_lcd_te_sync_del(spd2010->te_sync);
         free(spd2010);
     }
     return ret;
@@ -176,6 +184,7 @@ static esp_err_t panel_spd2010_del(esp_lcd_panel_t *panel)
     if (spd2010->reset_gpio_num >= 0) {
         gpio_reset_pin(spd2010->reset_gpio_num);
     }
+    esp_lcd_te_sync_del(spd2010->te_sync);
     ESP_LOGD(TAG, "del spd2010 panel @%p", spd2010);
     free(spd2010);
     return ESP_OK;
@@ -197,6 +206,8 @@ static esp_err_t panel_spd2010_reset(esp_lcd_panel_t *panel)
         vTaskDelay(pdMS_TO_TICKS(20));
     }
 
+    esp_lcd_window_cache_invalidate(&spd2010->window);
+
     return ESP_OK;
 }
 
@@ -624,6 +635,12 @@ static esp_err_t panel_spd2010_init(esp_lcd_panel_t *panel)
     ESP_RETURN_ON_ERROR(tx_param(spd2010, io, LCD_CMD_COLMOD, (uint8_t[]) {
         spd2010->colmod_val,
     }, 1), TAG, "send command failed");
+    if (spd2010->te_sync) {
+        // Only the V-Blanking information is output on the TE signal
+        ESP_RETURN_ON_ERROR(tx_param(spd2010, io, LCD_CMD_TEON, (uint8_t[]) {
+            0x00,
+        }, 1), TAG, "send command failed");
+    }
 
     // vendor specific initialization, it can be different between manufacturers
     // should consult the LCD supplier for initialization sequence code
@@ -671,6 +688,10 @@ static esp_err_t panel_spd2010_init(esp_lcd_panel_t *panel)
     }
     ESP_LOGD(TAG, "send init commands success");
 
+    // The initialization commands may change the window and the MADCTL register
+    esp_lcd_window_cache_invalidate(&spd2010->window);
+    esp_lcd_te_sync_set_mirror_y(spd2010->te_sync, spd2010->madctl_val & BIT(0));
+
     return ESP_OK;
 }
 
@@ -679,30 +700,45 @@ static esp_err_t panel_spd2010_draw_bitmap(esp_lcd_panel_t *panel, int x_start,
     spd2010_panel_t *spd2010 = __containerof(panel, spd2010_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
     esp_lcd_panel_io_handle_t io = spd2010->io;
+    esp_err_t ret = ESP_OK;
 
     x_start += spd2010->x_gap;
     x_end += spd2010->x_gap;
     y_start += spd2010->y_gap;
     y_end += spd2010->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(tx_param(spd2010, io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(tx_param(spd2010, io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
+    // define an area of frame memory where MCU can access, the panel keeps the last one so it's only sent when changed
+    bool send_caset = false;
+    bool send_raset = false;
+    esp_lcd_window_cache_update(&spd2010->window, x_start, y_start, x_end, y_end, &send_caset, &send_raset);
+    if (send_caset) {
+        ESP_GOTO_ON_ERROR(tx_param(spd2010, io, LCD_CMD_CASET, (uint8_t[]) {
+            (x_start >> 8) & 0xFF,
+            x_start & 0xFF,
+            ((x_end - 1) >> 8) & 0xFF,
+            (x_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
+    if (send_raset) {
+        ESP_GOTO_ON_ERROR(tx_param(spd2010, io, LCD_CMD_RASET, (uint8_t[]) {
+            (y_start >> 8) & 0xFF,
+            y_start & 0xFF,
+            ((y_end - 1) >> 8) & 0xFF,
+            (y_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
+
+    // write the rows just behind the scan line of the panel to avoid tearing
+    esp_lcd_te_sync_wait(spd2010->te_sync, y_start - spd2010->y_gap, y_end - spd2010->y_gap);
     // transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * spd2010->fb_bits_per_pixel / 8;
     ESP_RETURN_ON_ERROR(tx_color(spd2010, io, LCD_CMD_RAMWR, color_data, len), TAG, "send color failed");
 
     return ESP_OK;
+
+err:
+    esp_lcd_window_cache_invalidate(&spd2010->window);
+    return ret;
 }
 
 static esp_err_t panel_spd2010_invert_color(esp_lcd_panel_t *panel, bool invert_color_data)
@@ -736,6 +772,7 @@ static esp_err_t panel_spd2010_mirror(esp_lcd_panel_t *panel, bool mirror_x, boo
     ESP_RETURN_ON_ERROR(tx_param(spd2010, io, LCD_CMD_MADCTL, (uint8_t[]) {
         spd2010->madctl_val
     }, 1), TAG, "send command failed");
+    esp_lcd_te_sync_set_mirror_y(spd2010->te_sync, mirror_y);
     return ESP_OK;
 }
 
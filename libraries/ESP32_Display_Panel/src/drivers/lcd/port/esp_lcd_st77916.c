@@ -26,6 +26,7 @@
 #include "utils/esp_panel_utils_log.h"
 #include "esp_utils_helpers.h"
 #include "esp_panel_lcd_vendor_types.h"
+#include "esp_lcd_te_sync.h"
 
 #define LCD_OPCODE_WRITE_CMD        (0x02ULL)
 #define LCD_OPCODE_READ_CMD         (0x0BULL)
@@ -57,6 +58,8 @@ typedef struct {
     uint8_t colmod_val; // save surrent value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_lcd_window_cache_t window;  // last window sent to the panel
+    esp_lcd_te_sync_handle_t te_sync;
     struct {
         unsigned int use_qspi_interface: 1;
         unsigned int reset_level: 1;
@@ -116,6 +119,10 @@ esp_err_t esp_lcd_new_panel_st77916(const esp_lcd_panel_io_handle_t io, const es
         st77916->init_cmds = vendor_config->init_cmds;
         st77916->init_cmds_size = vendor_config->init_cmds_size;
         st77916->flags.use_qspi_interface = vendor_config->flags.use_qspi_interface;
+        if (vendor_config->flags.use_te_signal) {
+            ESP_GOTO_ON_ERROR(esp_lcd_new_te_sync(vendor_config->te_gpio_num, vendor_config->ver_res, &st77916->te_sync), err,
+                              TAG, "create TE sync failed");
+        }
     }
     st77916->base.del = panel_st77916_del;
     st77916->base.reset = panel_st77916_reset;
@@ -136,6 +143,7 @@ err:
         if (panel_dev_config->reset_gpio_num >= 0) {
             gpio_reset_pin(panel_dev_config->reset_gpio_num);
         }
+        esp_lcd_te_sync_del(st77916->te_sync);
         free(st77916);
     }
     return ret;
@@ -168,6 +176,7 @@ static esp_err_t panel_st77916_del(esp_lcd_panel_t *panel)
     if (st77916->reset_gpio_num >= 0) {
         gpio_reset_pin(st77916->reset_gpio_num);
     }
+    esp_lcd_te_sync_del(st77916->te_sync);
     ESP_LOGD(TAG, "del st77916 panel @%p", st77916);
     free(st77916);
     return ESP_OK;
@@ -189,6 +198,8 @@ static esp_err_t panel_st77916_reset(esp_lcd_panel_t *panel)
         vTaskDelay(pdMS_TO_TICKS(120));
     }
 
+    esp_lcd_window_cache_invalidate(&st77916->window);
+
     return ESP_OK;
 }
 
@@ -426,6 +437,12 @@ static esp_err_t panel_st77916_init(esp_lcd_panel_t *panel)
     ESP_RETURN_ON_ERROR(tx_param(st77916, io, LCD_CMD_COLMOD, (uint8_t[]) {
         st77916->colmod_val,
     }, 1), TAG, "send command failed");
+    if (st77916->te_sync) {
+        // Only the V-Blanking information is output on the TE signal
+        ESP_RETURN_ON_ERROR(tx_param(st77916, io, LCD_CMD_TEON, (uint8_t[]) {
+            0x00,
+        }, 1), TAG, "send command failed");
+    }
 
     // vendor specific initialization, it can be different between manufacturers
     // should consult the LCD supplier for initialization sequence code
@@ -471,6 +488,11 @@ static esp_err_t panel_st77916_init(esp_lcd_panel_t *panel)
     }
     ESP_LOGD(TAG, "send init commands success");
 
+    // The initialization commands may change the window and the MADCTL register
+    esp_lcd_window_cache_invalidate(&st77916->window);
+    esp_lcd_te_sync_set_mirror_y(st77916->te_sync, st77916->madctl_val & LCD_CMD_MY_BIT);
+    esp_lcd_te_sync_set_swap_xy(st77916->te_sync, st77916->madctl_val & LCD_CMD_MV_BIT);
+
     return ESP_OK;
 }
 
@@ -479,30 +501,45 @@ static esp_err_t panel_st77916_draw_bitmap(esp_lcd_panel_t *panel, int x_start,
     st77916_panel_t *st77916 = __containerof(panel, st77916_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
     esp_lcd_panel_io_handle_t io = st77916->io;
+    esp_err_t ret = ESP_OK;
 
     x_start += st77916->x_gap;
     x_end += st77916->x_gap;
     y_start += st77916->y_gap;
     y_end += st77916->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(tx_param(st77916, io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(tx_param(st77916, io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
+    // define an area of frame memory where MCU can access, the panel keeps the last one so it's only sent when changed
+    bool send_caset = false;
+    bool send_raset = false;
+    esp_lcd_window_cache_update(&st77916->window, x_start, y_start, x_end, y_end, &send_caset, &send_raset);
+    if (send_caset) {
+        ESP_GOTO_ON_ERROR(tx_param(st77916, io, LCD_CMD_CASET, (uint8_t[]) {
+            (x_start >> 8) & 0xFF,
+            x_start & 0xFF,
+            ((x_end - 1) >> 8) & 0xFF,
+            (x_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
+    if (send_raset) {
+        ESP_GOTO_ON_ERROR(tx_param(st77916, io, LCD_CMD_RASET, (uint8_t[]) {
+            (y_start >> 8) & 0xFF,
+            y_start & 0xFF,
+            ((y_end - 1) >> 8) & 0xFF,
+            (y_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
+
+    // write the rows just behind the scan line of the panel to avoid tearing
+    esp_lcd_te_sync_wait(st77916->te_sync, y_start - st77916->y_gap, y_end - st77916->y_gap);
     // transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * st77916->fb_bits_per_pixel / 8;
     tx_color(st77916, io, LCD_CMD_RAMWR, color_data, len);
 
     return ESP_OK;
+
+err:
+    esp_lcd_window_cache_invalidate(&st77916->window);
+    return ret;
 }
 
 static esp_err_t panel_st77916_invert_color(esp_lcd_panel_t *panel, bool invert_color_data)
@@ -538,6 +575,7 @@ static esp_err_t panel_st77916_mirror(esp_lcd_panel_t *panel, bool mirror_x, boo
     ESP_RETURN_ON_ERROR(tx_param(st77916, io, LCD_CMD_MADCTL, (uint8_t[]) {
         st77916->madctl_val
     }, 1), TAG, "send command failed");
+    esp_lcd_te_sync_set_mirror_y(st77916->te_sync, mirror_y);
     return ret;
 }
 
@@ -553,6 +591,7 @@ static esp_err_t panel_st77916_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
     ESP_RETURN_ON_ERROR(tx_param(st77916, io, LCD_CMD_MADCTL, (uint8_t[]) {
         st77916->madctl_val
     }, 1), TAG, "send command failed");
+    esp_lcd_te_sync_set_swap_xy(st77916->te_sync, swap_axes);
     return ESP_OK;
 }
 
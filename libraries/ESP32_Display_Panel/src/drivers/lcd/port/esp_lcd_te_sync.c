@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+
+#include "esp_lcd_te_sync.h"
+
+#define TE_PERIOD_FILTER_SHIFT  (3)     // Weight of a new period is 1/8
+#define TE_LOST_PERIODS         (4)     // The TE signal is considered lost after this number of periods
+#define TE_REMEASURE_REJECTS    (4)     // The period is measured again after this number of consecutive skipped pulses
+
+void esp_lcd_window_cache_invalidate(esp_lcd_window_cache_t *cache)
+{
+    cache->is_valid = false;
+}
+
+void esp_lcd_window_cache_update(esp_lcd_window_cache_t *cache, int x_start, int y_start, int x_end, int y_end,
+                                 bool *send_caset, bool *send_raset)
+{
+    *send_caset = !cache->is_valid || (cache->x_start != x_start) || (cache->x_end != x_end);
+    *send_raset = !cache->is_valid || (cache->y_start != y_start) || (cache->y_end != y_end);
+
+    cache->x_start = x_start;
+    cache->x_end = x_end;
+    cache->y_start = y_start;
+    cache->y_end = y_end;
+    cache->is_valid = true;
+}
+
+void esp_lcd_te_timing_init(esp_lcd_te_timing_t *timing, int ver_res)
+{
+    *timing = (esp_lcd_te_timing_t) {
+        .ver_res = ver_res,
+    };
+}
+
+void esp_lcd_te_timing_on_pulse(esp_lcd_te_timing_t *timing, int64_t now_us)
+{
+    if (timing->last_te_us > 0) {
+        int64_t delta = now_us - timing->last_te_us;
+        if (timing->period_us == 0) {
+            timing->period_us = delta;
+        } else if ((delta > timing->period_us / 2) && (delta < (int64_t)timing->period_us * 2)) {
+            timing->period_us += (delta - (int64_t)timing->period_us) >> TE_PERIOD_FILTER_SHIFT;
+            timing->reject_cnt = 0;
+        } else if (++timing->reject_cnt >= TE_REMEASURE_REJECTS) {
+            // Skip the missed or glitched pulses, unless so many are skipped that the measured period must be wrong,
+            // e.g. because of a glitch or a missed pulse at startup
+            timing->period_us = delta;
+            timing->reject_cnt = 0;
+        }
+    }
+    timing->last_te_us = now_us;
+}
+
+static int64_t get_row_time(const esp_lcd_te_timing_t *timing, int row)
+{
+    return (int64_t)row * timing->period_us / timing->ver_res;
+}
+
+uint32_t esp_lcd_te_timing_get_wait_us(const esp_lcd_te_timing_t *timing, int64_t now_us, int y_start, int y_end)
+{
+    int64_t period = timing->period_us;
+    if ((period == 0) || (timing->ver_res <= 0) || (now_us - timing->last_te_us > period * TE_LOST_PERIODS)) {
+        return 0;
+    }
+
+    // Rows of the scan, the written area of the swapped axes is a column range, so it is handled as a whole frame
+    int scan_start = y_start;
+    int scan_end = y_end;
+    if (timing->flags.swap_xy) {
+        scan_start = 0;
+        scan_end = timing->ver_res;
+    } else if (timing->flags.mirror_y) {
+        scan_start = timing->ver_res - y_end;
+        scan_end = timing->ver_res - y_start;
+    }
+    scan_start = (scan_start < 0) ? 0 : scan_start;
+    scan_end = (scan_end > timing->ver_res) ? timing->ver_res : scan_end;
+
+    int64_t phase = (now_us - timing->last_te_us) % period;
+    if ((scan_end - scan_start) * 2 > timing->ver_res) {
+        // Start together with the scan and stay ahead of it
+        return (phase == 0) ? 0 : period - phase;
+    }
+
+    // The scan line has passed the rows, and the rows are written before the next frame scans the first of them
+    // The range may end in the next frame, then it also covers the start of the current frame
+    int64_t earliest = get_row_time(timing, scan_end);
+    int64_t latest = period + get_row_time(timing, scan_start) - get_row_time(timing, scan_end - scan_start);
+    if (phase >= earliest) {
+        return (phase <= latest) ? 0 : period - phase + earliest;
+    }
+
+    return (phase + period <= latest) ? 0 : earliest - phase;
+}
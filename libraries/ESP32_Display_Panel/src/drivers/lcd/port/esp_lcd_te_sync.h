@@ -0,0 +1,162 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Last window (CASET/RASET) sent to the panel
+ *
+ * The panel keeps the window until it is reset, so unchanged window commands can be dropped.
+ */
+typedef struct {
+    int x_start;    /*!< First column, included */
+    int x_end;      /*!< Last column, excluded */
+    int y_start;    /*!< First row, included */
+    int y_end;      /*!< Last row, excluded */
+    bool is_valid;  /*!< Set if the window is known */
+} esp_lcd_window_cache_t;
+
+/**
+ * @brief Timing of the tearing effect (TE) signal
+ *
+ * The TE pulse is sent at the start of each frame, then the panel scans the rows from the top at a constant rate.
+ */
+typedef struct {
+    int64_t last_te_us;     /*!< Time of the last TE pulse, 0 if no pulse is received */
+    uint32_t period_us;     /*!< Filtered frame period, 0 if unknown */
+    int ver_res;            /*!< Number of scanned rows */
+    uint8_t reject_cnt;     /*!< Number of consecutive pulses skipped as missed or glitched */
+    struct {
+        unsigned int mirror_y: 1;   /*!< Rows are written from the bottom (MADCTL MY) */
+        unsigned int swap_xy: 1;    /*!< Rows and columns are swapped (MADCTL MV) */
+    } flags;
+} esp_lcd_te_timing_t;
+
+/**
+ * @brief TE synchronization handle, driven by a GPIO interrupt
+ */
+typedef struct esp_lcd_te_sync_t *esp_lcd_te_sync_handle_t;
+
+/**
+ * @brief Forget the window, e.g. after the panel is reset
+ *
+ * @param[in] cache Window cache
+ */
+void esp_lcd_window_cache_invalidate(esp_lcd_window_cache_t *cache);
+
+/**
+ * @brief Update the window and check which window commands should be sent
+ *
+ * @param[in]  cache      Window cache
+ * @param[in]  x_start    First column, included
+ * @param[in]  y_start    First row, included
+ * @param[in]  x_end      Last column, excluded
+ * @param[in]  y_end      Last row, excluded
+ * @param[out] send_caset Set if CASET should be sent
+ * @param[out] send_raset Set if RASET should be sent
+ */
+void esp_lcd_window_cache_update(esp_lcd_window_cache_t *cache, int x_start, int y_start, int x_end, int y_end,
+                                 bool *send_caset, bool *send_raset);
+
+/**
+ * @brief Initialize the TE timing
+ *
+ * @param[in] timing  TE timing
+ * @param[in] ver_res Number of scanned rows
+ */
+void esp_lcd_te_timing_init(esp_lcd_te_timing_t *timing, int ver_res);
+
+/**
+ * @brief Record a TE pulse
+ *
+ * The pulses far from the measured period are skipped. If several of them come in a row, the measured period is
+ * considered wrong and is measured again.
+ *
+ * @param[in] timing TE timing
+ * @param[in] now_us Time of the pulse
+ */
+void esp_lcd_te_timing_on_pulse(esp_lcd_te_timing_t *timing, int64_t now_us);
+
+/**
+ * @brief Get the time to wait before the rows can be written without tearing
+ *
+ * The rows are written just behind the scan line: after it has passed them, and early enough to be finished before the
+ * next frame scans them. Areas higher than half of the panel are written from the start of a frame instead.
+ *
+ * @param[in] timing  TE timing
+ * @param[in] now_us  Current time
+ * @param[in] y_start First row, included
+ * @param[in] y_end   Last row, excluded
+ *
+ * @return
+ *      - Time to wait in microseconds, 0 if the rows can be written now or if there is no TE signal
+ */
+uint32_t esp_lcd_te_timing_get_wait_us(const esp_lcd_te_timing_t *timing, int64_t now_us, int y_start, int y_end);
+
+/**
+ * @brief Create a TE synchronization handle, the pulses are received with a GPIO interrupt
+ *
+ * @note  The GPIO ISR service is installed if it isn't yet
+ *
+ * @param[in]  te_gpio_num GPIO connected to the TE signal
+ * @param[in]  ver_res     Number of scanned rows
+ * @param[out] ret_te      Returned handle
+ *
+ * @return
+ *      - ESP_OK:              Success
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_NO_MEM:      No memory
+ *      - Others:              Fail
+ */
+esp_err_t esp_lcd_new_te_sync(int te_gpio_num, int ver_res, esp_lcd_te_sync_handle_t *ret_te);
+
+/**
+ * @brief Delete a TE synchronization handle
+ *
+ * @param[in] te Handle, can be NULL
+ *
+ * @return
+ *      - ESP_OK: Success
+ */
+esp_err_t esp_lcd_te_sync_del(esp_lcd_te_sync_handle_t te);
+
+/**
+ * @brief Set if the rows are written from the bottom (MADCTL MY)
+ *
+ * @param[in] te       Handle, nothing is done if NULL
+ * @param[in] mirror_y Rows are written from the bottom
+ */
+void esp_lcd_te_sync_set_mirror_y(esp_lcd_te_sync_handle_t te, bool mirror_y);
+
+/**
+ * @brief Set if the rows and columns are swapped (MADCTL MV)
+ *
+ * @param[in] te      Handle, nothing is done if NULL
+ * @param[in] swap_xy Rows and columns are swapped
+ */
+void esp_lcd_te_sync_set_swap_xy(esp_lcd_te_sync_handle_t te, bool swap_xy);
+
+/**
+ * @brief Block until the rows can be written without tearing
+ *
+ * @param[in] te      Handle, nothing is done if NULL
+ * @param[in] y_start First row, included
+ * @param[in] y_end   Last row, excluded
+ */
+void esp_lcd_te_sync_wait(esp_lcd_te_sync_handle_t te, int y_start, int y_end);
+
+#ifdef __cplusplus
+}
+#endif
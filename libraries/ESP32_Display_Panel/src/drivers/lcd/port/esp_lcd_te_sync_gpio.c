@@ -0,0 +1,159 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "driver/gpio.h"
+#include "esp_check.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+
+#include "utils/esp_panel_utils_log.h"
+#include "esp_lcd_te_sync.h"
+
+// The esp_timer task may wake up the waiting task a bit late, so the end of a wait is spent spinning
+#define TE_WAIT_SPIN_US     (100)
+
+struct esp_lcd_te_sync_t {
+    int gpio_num;
+    esp_lcd_te_timing_t timing;
+    portMUX_TYPE lock;
+    esp_timer_handle_t wait_timer;
+    SemaphoreHandle_t wait_sem;
+};
+
+static const char *TAG = "lcd_te_sync";
+
+static void te_isr_handler(void *arg)
+{
+    struct esp_lcd_te_sync_t *te = (struct esp_lcd_te_sync_t *)arg;
+
+    portENTER_CRITICAL_ISR(&te->lock);
+    esp_lcd_te_timing_on_pulse(&te->timing, esp_timer_get_time());
+    portEXIT_CRITICAL_ISR(&te->lock);
+}
+
+static void te_wait_timer_cb(void *arg)
+{
+    struct esp_lcd_te_sync_t *te = (struct esp_lcd_te_sync_t *)arg;
+
+    xSemaphoreGive(te->wait_sem);
+}
+
+esp_err_t esp_lcd_new_te_sync(int te_gpio_num, int ver_res, esp_lcd_te_sync_handle_t *ret_te)
+{
+    ESP_RETURN_ON_FALSE(GPIO_IS_VALID_GPIO(te_gpio_num) && (ver_res > 0) && ret_te, ESP_ERR_INVALID_ARG, TAG,
+                        "Invalid argument");
+
+    esp_err_t ret = ESP_OK;
+    struct esp_lcd_te_sync_t *te = calloc(1, sizeof(struct esp_lcd_te_sync_t));
+    ESP_RETURN_ON_FALSE(te, ESP_ERR_NO_MEM, TAG, "No memory");
+    te->gpio_num = te_gpio_num;
+    te->lock = (portMUX_TYPE)portMUX_INITIALIZER_UNLOCKED;
+    esp_lcd_te_timing_init(&te->timing, ver_res);
+
+    te->wait_sem = xSemaphoreCreateBinary();
+    ESP_GOTO_ON_FALSE(te->wait_sem, ESP_ERR_NO_MEM, err, TAG, "Create semaphore failed");
+    ESP_GOTO_ON_ERROR(esp_timer_create(&((esp_timer_create_args_t) {
+        .callback = te_wait_timer_cb,
+        .arg = te,
+        .name = "lcd_te_wait",
+    }), &te->wait_timer), err, TAG, "Create timer failed");
+
+    ESP_GOTO_ON_ERROR(gpio_config(&((gpio_config_t) {
+        .pin_bit_mask = BIT64(te_gpio_num),
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_POSEDGE,
+    })), err, TAG, "GPIO config failed");
+    // The service may be installed by other drivers
+    ret = gpio_install_isr_service(0);
+    ESP_GOTO_ON_FALSE((ret == ESP_OK) || (ret == ESP_ERR_INVALID_STATE), ret, err, TAG, "Install ISR service failed");
+    ESP_GOTO_ON_ERROR(gpio_isr_handler_add(te_gpio_num, te_isr_handler, te), err, TAG, "Add ISR handler failed");
+
+    *ret_te = te;
+    return ESP_OK;
+
+err:
+    gpio_reset_pin(te_gpio_num);
+    if (te->wait_timer) {
+        esp_timer_delete(te->wait_timer);
+    }
+    if (te->wait_sem) {
+        vSemaphoreDelete(te->wait_sem);
+    }
+    free(te);
+    return ret;
+}
+
+esp_err_t esp_lcd_te_sync_del(esp_lcd_te_sync_handle_t te)
+{
+    if (te == NULL) {
+        return ESP_OK;
+    }
+
+    gpio_isr_handler_remove(te->gpio_num);
+    gpio_reset_pin(te->gpio_num);
+    esp_timer_stop(te->wait_timer);
+    esp_timer_delete(te->wait_timer);
+    vSemaphoreDelete(te->wait_sem);
+    free(te);
+
+    return ESP_OK;
+}
+
+void esp_lcd_te_sync_set_mirror_y(esp_lcd_te_sync_handle_t te, bool mirror_y)
+{
+    if (te == NULL) {
+        return;
+    }
+
+    portENTER_CRITICAL(&te->lock);
+    te->timing.flags.mirror_y = mirror_y;
+    portEXIT_CRITICAL(&te->lock);
+}
+
+void esp_lcd_te_sync_set_swap_xy(esp_lcd_te_sync_handle_t te, bool swap_xy)
+{
+    if (te == NULL) {
+        return;
+    }
+
+    portENTER_CRITICAL(&te->lock);
+    te->timing.flags.swap_xy = swap_xy;
+    portEXIT_CRITICAL(&te->lock);
+}
+
+void esp_lcd_te_sync_wait(esp_lcd_te_sync_handle_t te, int y_start, int y_end)
+{
+    if (te == NULL) {
+        return;
+    }
+
+    int64_t now_us = esp_timer_get_time();
+    portENTER_CRITICAL(&te->lock);
+    esp_lcd_te_timing_t timing = te->timing;
+    portEXIT_CRITICAL(&te->lock);
+
+    uint32_t wait_us = esp_lcd_te_timing_get_wait_us(&timing, now_us, y_start, y_end);
+    if (wait_us == 0) {
+        return;
+    }
+
+    // Block on a one-shot timer, which isn't limited to whole ticks, then spin until the target time.
+    // If the timer is already used by another task, only spin.
+    int64_t target_us = now_us + wait_us;
+    if ((wait_us > TE_WAIT_SPIN_US) && (esp_timer_start_once(te->wait_timer, wait_us - TE_WAIT_SPIN_US) == ESP_OK)) {
+        xSemaphoreTake(te->wait_sem, portMAX_DELAY);
+    }
+    now_us = esp_timer_get_time();
+    if (now_us < target_us) {
+        esp_rom_delay_us(target_us - now_us);
+    }
+}
@@ -49,6 +49,9 @@ typedef struct {
      */
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     unsigned int init_cmds_size;    /*!< Number of commands in above array */
+    int te_gpio_num;                /*!< GPIO connected to the tearing effect (TE) signal of the panel.
+                                     *   Only used if `flags.use_te_signal` is set
+                                     */
 
 #if SOC_LCD_RGB_SUPPORTED
     const esp_lcd_rgb_panel_config_t *rgb_config;       /*!< RGB panel configuration. */
@@ -77,6 +80,10 @@ typedef struct {
         unsigned int use_qspi_interface: 1;         /*!< Set to 1 if use QSPI interface */
         unsigned int use_rgb_interface: 1;          /*!< Set to 1 if use RGB interface */
         unsigned int use_mipi_interface: 1;         /*!< Set to 1 if using MIPI interface */
+        unsigned int use_te_signal: 1;              /*!< Set to 1 to write the pixels just behind the scan line of the panel
+                                                     *   using its TE signal on `te_gpio_num`, to avoid tearing.
+                                                     *   This flag is only valid for the SPD2010, ST77916 and AXS15231B.
+                                                     */
     } flags;
 } esp_panel_lcd_vendor_config_t;
 
@@ -176,7 +176,6 @@ bool Touch::init()
             interruption = utils::make_shared<Interruption>(), false, "Create interruption failed"
         );
 
-        interruption->on_active_sem = xSemaphoreCreateBinaryStatic(&interruption->on_active_sem_buffer);
         interruption->data.touch_ptr = this;
 
         auto &device_config = getDeviceFullConfig();
@@ -208,8 +207,8 @@ bool Touch::del()
     }
 
     _transformation = {};
-    _points.clear();
-    _buttons.clear();
+    resetPoints();
+    resetButtons();
     _interruption = nullptr;
 
     setState(State::DEINIT);
@@ -283,6 +282,7 @@ bool Touch::mirrorY(bool en)
 bool Touch::readRawData(int points_num, int buttons_num, int timeout_ms)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+    ESP_UTILS_TRACE_SCOPE("Touch::readRawData");
 
     ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
 
@@ -291,15 +291,17 @@ bool Touch::readRawData(int points_num, int buttons_num, int timeout_ms)
     // Wait for the interruption if it is enabled, then read the raw data
     if (isInterruptEnabled()  && (timeout_ms != 0)) {
         ESP_UTILS_LOGD("Wait for interruption");
-        BaseType_t timeout_ticks = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
-        if (xSemaphoreTake(_interruption->on_active_sem, timeout_ticks) != pdTRUE) {
+        if (_interruption->flags.wait(Interruption::FLAG_ACTIVE, timeout_ms) == 0) {
             ESP_UTILS_LOGD("Wait timeout");
             return true;
         }
     }
 
-    // Read the raw data
+    // Read the raw data, only one task at a time may update the snapshots
+    std::lock_guard<std::mutex> lock(_resource_mutex);
+    ESP_UTILS_PERF_HISTOGRAM_SCOPE_US("touch.read_us");
     ESP_UTILS_CHECK_ERROR_RETURN(esp_lcd_touch_read_data(touch_panel), false, "Read data failed");
+    ESP_UTILS_PERF_COUNTER_ADD("touch.read", 1);
 
     // Get the points
     ESP_UTILS_CHECK_FALSE_RETURN(readRawDataPoints(points_num), false, "Read points failed");
@@ -321,13 +323,10 @@ int Touch::getPoints(TouchPoint points[], uint8_t num)
     ESP_UTILS_LOGD("Param: points(@%p), num(%d)", points, num);
     ESP_UTILS_CHECK_FALSE_RETURN((num == 0) || (points != nullptr), -1, "Invalid points or num");
 
+    auto snapshot = _points.load();
     int i = 0;
-    std::unique_lock lock(_resource_mutex);
-    for (auto &point : _points) {
-        if (i >= num) {
-            break;
-        }
-        points[i++] = point;
+    for (; (i < snapshot.num) && (i < num); i++) {
+        points[i] = snapshot.points[i];
     }
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
@@ -342,8 +341,8 @@ bool Touch::getPoints(utils::vector<TouchPoint> &points)
     ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
 
     ESP_UTILS_LOGD("Param: points(@%p)", &points);
-    std::unique_lock lock(_resource_mutex);
-    points = _points;
+    auto snapshot = _points.load();
+    points.assign(snapshot.points, snapshot.points + snapshot.num);
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -357,8 +356,8 @@ bool Touch::getPoints(std::vector<TouchPoint> &points)
     ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
 
     ESP_UTILS_LOGD("Param: points(@%p)", &points);
-    std::unique_lock lock(_resource_mutex);
-    points = std::vector<TouchPoint>(_points.begin(), _points.end());
+    auto snapshot = _points.load();
+    points.assign(snapshot.points, snapshot.points + snapshot.num);
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -374,13 +373,10 @@ int Touch::getButtons(TouchButton buttons[], uint8_t num)
     ESP_UTILS_LOGD("Param: buttons(@%p), num(%d)", buttons, num);
     ESP_UTILS_CHECK_FALSE_RETURN((num == 0) || (buttons != nullptr), false, "Invalid buttons or num");
 
-    std::unique_lock lock(_resource_mutex);
+    auto snapshot = _buttons.load();
     int i = 0;
-    for (auto &button : _buttons) {
-        if (i >= num) {
-            break;
-        }
-        buttons[i++] = button;
+    for (; (i < snapshot.num) && (i < num); i++) {
+        buttons[i] = TouchButton(i, snapshot.states[i]);
     }
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
@@ -395,8 +391,11 @@ bool Touch::getButtons(utils::vector<TouchButton> &buttons)
     ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
 
     ESP_UTILS_LOGD("Param: buttons(%p)", &buttons);
-    std::unique_lock lock(_resource_mutex);
-    buttons = _buttons;
+    auto snapshot = _buttons.load();
+    buttons.clear();
+    for (int i = 0; i < snapshot.num; i++) {
+        buttons.emplace_back(i, snapshot.states[i]);
+    }
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -410,8 +409,11 @@ bool Touch::getButtons(std::vector<TouchButton> &buttons)
     ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
 
     ESP_UTILS_LOGD("Param: buttons(@%p)", &buttons);
-    std::unique_lock lock(_resource_mutex);
-    buttons = std::vector<TouchButton>(_buttons.begin(), _buttons.end());
+    auto snapshot = _buttons.load();
+    buttons.clear();
+    for (int i = 0; i < snapshot.num; i++) {
+        buttons.emplace_back(i, snapshot.states[i]);
+    }
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -425,23 +427,12 @@ int Touch::getButtonState(int index)
     ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
 
     ESP_UTILS_LOGD("Param: index(%d)", index);
-    bool is_found = false;
-    TouchButton ret_button = {};
-
-    std::unique_lock lock(_resource_mutex);
-    for (auto &button : _buttons) {
-        if (button.first == index) {
-            is_found = true;
-            ret_button = button;
-            break;
-        }
-    }
-
-    ESP_UTILS_CHECK_FALSE_RETURN(is_found, -1, "Index not found");
+    auto snapshot = _buttons.load();
+    ESP_UTILS_CHECK_FALSE_RETURN((index >= 0) && (index < snapshot.num), -1, "Index not found");
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
-    return ret_button.second;
+    return snapshot.states[index];
 }
 
 int Touch::readPoints(TouchPoint points[], int num, int timeout_ms)
@@ -567,29 +558,29 @@ bool Touch::readRawDataPoints(int points_num)
     }
     ESP_UTILS_LOGD("Try to read %d points", points_num);
 
-    utils::vector<uint16_t> x(points_num);
-    utils::vector<uint16_t> y(points_num);
-    utils::vector<uint16_t> strength(points_num);
-    auto x_buf = x.data();
-    auto y_buf = y.data();
-    auto strength_buf = strength.data();
+    uint16_t x_buf[POINTS_MAX_NUM] = {};
+    uint16_t y_buf[POINTS_MAX_NUM] = {};
+    uint16_t strength_buf[POINTS_MAX_NUM] = {};
     uint8_t ret_points_num = 0;
 
     // Get the point coordinates from the raw data
     esp_lcd_touch_get_coordinates(touch_panel, x_buf, y_buf, strength_buf, &ret_points_num, points_num);
     ESP_UTILS_LOGD("Get %d points number", ret_points_num);
 
-    // Update the points
-    std::unique_lock lock(_resource_mutex);
-    _points.clear();
-    for (int i = 0; i < ret_points_num; i++) {
-        _points.emplace_back(static_cast<int>(x_buf[i]), static_cast<int>(y_buf[i]), static_cast<int>(strength_buf[i]));
+    // Publish the points, readers copy them without taking the mutex
+    PointsSnapshot snapshot = {};
+    snapshot.num = std::min(static_cast<int>(ret_points_num), points_num);
+    for (int i = 0; i < snapshot.num; i++) {
+        snapshot.points[i] = TouchPoint(
+                                 static_cast<int>(x_buf[i]), static_cast<int>(y_buf[i]), static_cast<int>(strength_buf[i])
+                             );
     }
-    lock.unlock();
+    _points.store(snapshot);
+    ESP_UTILS_PERF_COUNTER_ADD("touch.points", snapshot.num);
 
 #if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
-    for (auto &point : _points) {
-        point.print();
+    for (int i = 0; i < snapshot.num; i++) {
+        snapshot.points[i].print();
     }
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
 
@@ -622,7 +613,7 @@ bool Touch::readRawDataButtons(int buttons_num)
     ESP_UTILS_LOGD("Try to read %d buttons", buttons_num);
 
     // Get the buttons state from the raw data
-    utils::vector<TouchButton> buttons;
+    ButtonsSnapshot snapshot = {};
     uint8_t button_state = 0;
 
     for (int i = 0; i < buttons_num; i++) {
@@ -634,16 +625,15 @@ bool Touch::readRawDataButtons(int buttons_num)
         }
         ESP_UTILS_CHECK_ERROR_RETURN(ret, false, "Get button(%d) state failed", i);
 
-        buttons.emplace_back(i, button_state);
+        snapshot.states[snapshot.num++] = button_state;
     }
 
-    std::unique_lock lock(_resource_mutex);
-    _buttons = std::move(buttons);
-    lock.unlock();
+    // Publish the buttons, readers copy them without taking the mutex
+    _buttons.store(snapshot);
 
 #if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
-    for (auto &button : _buttons) {
-        ESP_UTILS_LOGD("Button(%d): %d", button.first, button.second);
+    for (int i = 0; i < snapshot.num; i++) {
+        ESP_UTILS_LOGD("Button(%d): %d", i, snapshot.states[i]);
     }
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
 
@@ -672,9 +662,7 @@ void Touch::onInterruptActive(PanelHandle panel)
     if (interruption->on_active_callback != nullptr) {
         need_yield = interruption->on_active_callback(interruption->data.user_data) ? pdTRUE : need_yield;
     }
-    if (interruption->on_active_sem != nullptr) {
-        xSemaphoreGiveFromISR(interruption->on_active_sem, &need_yield);
-    }
+    interruption->flags.setFromISR(Interruption::FLAG_ACTIVE, &need_yield);
     if (need_yield == pdTRUE) {
         portYIELD_FROM_ISR();
     }
@@ -6,14 +6,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <thread>
 #include <variant>
 #include <vector>
 #include <memory>
 #include <mutex>
 #include "freertos/FreeRTOS.h"
-#include "freertos/semphr.h"
 #include "utils/esp_panel_utils_cxx.hpp"
+#include "utils/esp_panel_utils_sync.hpp"
 #include "drivers/bus/esp_panel_bus_factory.hpp"
 #include "port/esp_lcd_touch.h"
 #include "esp_panel_touch_conf_internal.h"
@@ -471,7 +473,8 @@ public:
      */
     void resetPoints()
     {
-        _points.clear();
+        std::lock_guard<std::mutex> lock(_resource_mutex);
+        _points.store({});
     }
 
     /**
@@ -479,7 +482,8 @@ public:
      */
     void resetButtons()
     {
-        _buttons.clear();
+        std::lock_guard<std::mutex> lock(_resource_mutex);
+        _buttons.store({});
     }
 
     /**
@@ -697,10 +701,27 @@ private:
             void *user_data = nullptr;     /*!< User provided data */
         };
 
+        static constexpr uint32_t FLAG_ACTIVE = (1U << 0);       /*!< Set by the interrupt, cleared by `readRawData()` */
+
         CallbackData data = {};                                 /*!< Callback data */
         FunctionInterruptCallback on_active_callback = nullptr; /*!< Interrupt callback function */
-        SemaphoreHandle_t on_active_sem = nullptr;              /*!< Semaphore for interrupt sync */
-        StaticSemaphore_t on_active_sem_buffer = {};            /*!< Static buffer for semaphore */
+        utils::EventFlags flags;                                /*!< Flags for interrupt sync */
+    };
+
+    /**
+     * @brief Snapshot of the touch points, published through a sequence lock
+     */
+    struct PointsSnapshot {
+        int num = 0;                            /*!< Number of valid points */
+        TouchPoint points[POINTS_MAX_NUM];      /*!< Touch points */
+    };
+
+    /**
+     * @brief Snapshot of the touch buttons, the index of each button is its position in `states`
+     */
+    struct ButtonsSnapshot {
+        int num = 0;                                            /*!< Number of valid buttons */
+        uint8_t states[std::max(BUTTONS_MAX_NUM, 1)] = {};      /*!< Button states */
     };
 
     DeviceFullConfig &getDeviceFullConfig();
@@ -711,12 +732,11 @@ private:
     BasicAttributes _basic_attributes = {};                 /*!< Basic device attributes */
     std::shared_ptr<Bus> _bus = nullptr;                    /*!< Bus interface pointer */
     Config _config = {};                                    /*!< Device configuration */
-    State _state = State::DEINIT;                           /*!< Current driver state */
+    std::atomic<State> _state = State::DEINIT;              /*!< Current driver state */
     Transformation _transformation = {};                    /*!< Coordinate transformation settings */
-    // note: Use std::mutex instead of std::shared_mutex (IDF-12208)
-    std::mutex _resource_mutex;                             /*!< Resource access mutex */
-    utils::vector<TouchPoint> _points;                      /*!< Touch points buffer */
-    utils::vector<TouchButton> _buttons;                    /*!< Touch buttons buffer */
+    std::mutex _resource_mutex;                             /*!< Serializes the writers of the snapshots */
+    utils::SeqLock<PointsSnapshot> _points;                 /*!< Touch points, read without locking */
+    utils::SeqLock<ButtonsSnapshot> _buttons;               /*!< Touch buttons, read without locking */
     std::shared_ptr<Interruption> _interruption = nullptr;  /*!< Interrupt handling */
 };
 
@@ -5,9 +5,8 @@
  */
 #pragma once
 
-#include <unordered_map>
 #include <memory>
-#include <string>
+#include "utils/esp_panel_utils_log.h"
 #include "esp_panel_touch_conf_internal.h"
 #include "esp_panel_touch.hpp"
 #include "esp_panel_touch_axs15231b.hpp"
@@ -51,20 +50,64 @@ public:
      * @param[in] bus_config Bus configuration
      * @param[in] touch_config Touch configuration
      * @return Smart pointer to the created touch device instance, nullptr if creation fails
-     * @note The bus pointer must be valid and initialized before calling this function
+     * @note The name is looked up in a constant table which only contains the enabled controllers
+     *       (`ESP_PANEL_DRIVERS_TOUCH_USE_*`)
      */
     static std::shared_ptr<Touch> create(
-        utils::string name, const BusFactory::Config &bus_config, const Touch::Config &touch_config
+        const char *name, const BusFactory::Config &bus_config, const Touch::Config &touch_config
     );
 
+    /**
+     * @brief Create a touch screen device instance
+     *
+     * @param[in] name Device name identifier (e.g., "GT911", "XPT2046", etc.)
+     * @param[in] bus_config Bus configuration
+     * @param[in] touch_config Touch configuration
+     * @return Smart pointer to the created touch device instance, nullptr if creation fails
+     */
+    static std::shared_ptr<Touch> create(
+        const utils::string &name, const BusFactory::Config &bus_config, const Touch::Config &touch_config
+    )
+    {
+        return create(name.c_str(), bus_config, touch_config);
+    }
+
+    /**
+     * @brief Create a touch screen device instance of a controller selected at compile time
+     *
+     * @tparam T Touch device class (e.g., `TouchGT911`)
+     * @param[in] bus_config Bus configuration
+     * @param[in] touch_config Touch configuration
+     * @return Smart pointer to the created touch device instance, nullptr if creation fails
+     * @note Only the code of `T` is referenced, and no name lookup is performed
+     */
+    template <class T>
+    static std::shared_ptr<Touch> create(const BusFactory::Config &bus_config, const Touch::Config &touch_config)
+    {
+        std::shared_ptr<Touch> device = nullptr;
+        ESP_UTILS_CHECK_EXCEPTION_RETURN(
+            (device = utils::make_shared<T>(bus_config, touch_config)), nullptr, "Create %s failed",
+            T::BASIC_ATTRIBUTES_DEFAULT.name
+        );
+        return device;
+    }
+
 private:
     /**
-     * @brief Map associating device names with their creation functions
+     * @brief Item of the table associating device names with their creation functions
+     */
+    struct DeviceCreator {
+        const char *name;
+        FunctionCreateDevice function;
+    };
+
+    /**
+     * @brief Constant table of the enabled touch devices
      *
-     * Static map storing the mapping between touch device names and their corresponding
-     * creation functions. Each supported touch controller must be registered in this map.
+     * Each supported touch controller must be registered in this table, which is terminated by an item with a
+     * `nullptr` name.
      */
-    static const utils::unordered_map<utils::string, FunctionCreateDevice> _name_function_map;
+    static const DeviceCreator _device_creators[];
 };
 
 } // namespace esp_panel::drivers
@@ -0,0 +1,239 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+/**
+ * The task notification slot used by `EventFlags` as doorbell. Slot `0` is left to the application (e.g. the LVGL
+ * port), so the task notification doorbell is only used when `CONFIG_FREERTOS_TASK_NOTIFICATION_ARRAY_ENTRIES > 1`,
+ * otherwise a binary semaphore is used instead.
+ */
+#if defined(configTASK_NOTIFICATION_ARRAY_ENTRIES) && (configTASK_NOTIFICATION_ARRAY_ENTRIES > 1)
+#define ESP_PANEL_UTILS_EVENT_FLAGS_USE_TASK_NOTIFY     (1)
+#define ESP_PANEL_UTILS_EVENT_FLAGS_NOTIFY_INDEX        (configTASK_NOTIFICATION_ARRAY_ENTRIES - 1)
+#else
+#define ESP_PANEL_UTILS_EVENT_FLAGS_USE_TASK_NOTIFY     (0)
+#endif
+
+namespace esp_panel::utils {
+
+/**
+ * @brief Sequence lock protecting a small snapshot of trivially copyable data
+ *
+ * Readers never block and never delay the writer, they retry when a write happened during the copy. The payload is
+ * stored as relaxed atomic words, so a torn copy is only ever discarded, never observed.
+ *
+ * @note Only one writer at a time is allowed, concurrent writers must be serialized by the caller
+ */
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock only supports trivially copyable data");
+
+public:
+    SeqLock()
+    {
+        store(T{});
+    }
+
+    SeqLock(const SeqLock &) = delete;
+    SeqLock &operator=(const SeqLock &) = delete;
+
+    void store(const T &value)
+    {
+        uint32_t words[WORD_NUM] = {};
+        std::memcpy(words, &value, sizeof(T));
+
+        uint32_t seq = _seq.load(std::memory_order_relaxed);
+        _seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < WORD_NUM; i++) {
+            _words[i].store(words[i], std::memory_order_relaxed);
+        }
+        _seq.store(seq + 2, std::memory_order_release);
+    }
+
+    T load() const
+    {
+        uint32_t words[WORD_NUM];
+        uint32_t seq_begin = 0;
+        uint32_t seq_end = 0;
+        do {
+            seq_begin = _seq.load(std::memory_order_acquire);
+            for (size_t i = 0; i < WORD_NUM; i++) {
+                words[i] = _words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            seq_end = _seq.load(std::memory_order_relaxed);
+        } while ((seq_begin & 1) || (seq_begin != seq_end));
+
+        T value;
+        std::memcpy(&value, words, sizeof(T));
+
+        return value;
+    }
+
+    /**
+     * @brief Get the number of completed writes, can be used to detect new data without copying it
+     */
+    uint32_t getVersion() const
+    {
+        return _seq.load(std::memory_order_acquire) >> 1;
+    }
+
+private:
+    static constexpr size_t WORD_NUM = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    std::atomic<uint32_t> _seq{0};
+    std::atomic<uint32_t> _words[WORD_NUM];
+};
+
+/**
+ * @brief Atomic event flags which can be set from ISR and waited by one task
+ *
+ * Setting flags never blocks. The waiting task is woken by a task notification (or a binary semaphore, see
+ * `ESP_PANEL_UTILS_EVENT_FLAGS_USE_TASK_NOTIFY`), the flags themselves are the source of truth, so spurious or stale
+ * wakeups are simply ignored.
+ *
+ * @note Only one task may wait on the same flags at a time
+ */
+class EventFlags {
+public:
+    EventFlags()
+    {
+#if !ESP_PANEL_UTILS_EVENT_FLAGS_USE_TASK_NOTIFY
+        _doorbell = xSemaphoreCreateBinaryStatic(&_doorbell_buffer);
+#endif
+    }
+
+    ~EventFlags()
+    {
+#if !ESP_PANEL_UTILS_EVENT_FLAGS_USE_TASK_NOTIFY
+        vSemaphoreDelete(_doorbell);
+#endif
+    }
+
+    EventFlags(const EventFlags &) = delete;
+    EventFlags &operator=(const EventFlags &) = delete;
+
+    /**
+     * @brief Set flags from task context
+     */
+    void set(uint32_t bits)
+    {
+        _bits.fetch_or(bits, std::memory_order_release);
+#if ESP_PANEL_UTILS_EVENT_FLAGS_USE_TASK_NOTIFY
+        TaskHandle_t waiter = _waiter.load(std::memory_order_acquire);
+        if (waiter != nullptr) {
+            xTaskNotifyGiveIndexed(waiter, ESP_PANEL_UTILS_EVENT_FLAGS_NOTIFY_INDEX);
+        }
+#else
+        xSemaphoreGive(_doorbell);
+#endif
+    }
+
+    /**
+     * @brief Set flags from ISR context
+     *
+     * @param[in]  bits       Flags to set
+     * @param[out] need_yield Set to `pdTRUE` if a higher priority task is woken
+     */
+    __attribute__((always_inline)) inline void setFromISR(uint32_t bits, BaseType_t *need_yield)
+    {
+        _bits.fetch_or(bits, std::memory_order_release);
+#if ESP_PANEL_UTILS_EVENT_FLAGS_USE_TASK_NOTIFY
+        TaskHandle_t waiter = _waiter.load(std::memory_order_acquire);
+        if (waiter != nullptr) {
+            vTaskNotifyGiveIndexedFromISR(waiter, ESP_PANEL_UTILS_EVENT_FLAGS_NOTIFY_INDEX, need_yield);
+        }
+#else
+        xSemaphoreGiveFromISR(_doorbell, need_yield);
+#endif
+    }
+
+    void clear(uint32_t bits)
+    {
+        _bits.fetch_and(~bits, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the flags which are currently set among `bits`, without clearing them
+     */
+    uint32_t test(uint32_t bits) const
+    {
+        return _bits.load(std::memory_order_acquire) & bits;
+    }
+
+    /**
+     * @brief Clear and return the flags which are currently set among `bits`, without waiting
+     */
+    uint32_t fetchClear(uint32_t bits)
+    {
+        return _bits.fetch_and(~bits, std::memory_order_acquire) & bits;
+    }
+
+    /**
+     * @brief Wait until any flag of `bits` is set, then clear and return them
+     *
+     * @param[in] bits       Flags to wait for
+     * @param[in] timeout_ms Timeout in milliseconds, `-1` means waiting forever
+     *
+     * @return The flags which were set, `0` on timeout
+     */
+    uint32_t wait(uint32_t bits, int timeout_ms)
+    {
+        uint32_t ret_bits = fetchClear(bits);
+        if ((ret_bits != 0) || (timeout_ms == 0)) {
+            return ret_bits;
+        }
+
+        TickType_t start_tick = xTaskGetTickCount();
+        TickType_t timeout_tick = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+        TickType_t wait_tick = timeout_tick;
+#if ESP_PANEL_UTILS_EVENT_FLAGS_USE_TASK_NOTIFY
+        _waiter.store(xTaskGetCurrentTaskHandle(), std::memory_order_release);
+#endif
+        // Check the flags again after the waiter is published, so a flag set in between is not missed
+        while ((ret_bits = fetchClear(bits)) == 0) {
+#if ESP_PANEL_UTILS_EVENT_FLAGS_USE_TASK_NOTIFY
+            ulTaskNotifyTakeIndexed(ESP_PANEL_UTILS_EVENT_FLAGS_NOTIFY_INDEX, pdTRUE, wait_tick);
+#else
+            xSemaphoreTake(_doorbell, wait_tick);
+#endif
+            if (timeout_tick == portMAX_DELAY) {
+                continue;
+            }
+            TickType_t elapsed_tick = xTaskGetTickCount() - start_tick;
+            if (elapsed_tick >= timeout_tick) {
+                ret_bits = fetchClear(bits);
+                break;
+            }
+            wait_tick = timeout_tick - elapsed_tick;
+        }
+#if ESP_PANEL_UTILS_EVENT_FLAGS_USE_TASK_NOTIFY
+        _waiter.store(nullptr, std::memory_order_release);
+#endif
+
+        return ret_bits;
+    }
+
+private:
+    std::atomic<uint32_t> _bits{0};
+#if ESP_PANEL_UTILS_EVENT_FLAGS_USE_TASK_NOTIFY
+    std::atomic<TaskHandle_t> _waiter{nullptr};
+#else
+    SemaphoreHandle_t _doorbell = nullptr;
+    StaticSemaphore_t _doorbell_buffer = {};
+#endif
+};
+
+} // namespace esp_panel::utils
@@ -128,6 +128,40 @@ TEST_CASE("Test common board with default config", "[board][common][default]")
     }
 }
 
+#if ESP_UTILS_CONF_MEM_TRACE_ENABLE
+#define TEST_LEAK_LOOP_NUM  (3)
+
+TEST_CASE("Test common board init and delete without leaks", "[board][common][default][leak]")
+{
+    const char *tags[] = {"LCD", "Touch", "Backlight", "IO_Expander"};
+
+    for (int i = 0; i < TEST_LEAK_LOOP_NUM; i++) {
+        ESP_LOGI(TAG, "Leak check loop %d", i);
+
+        shared_ptr<Board> board = make_shared<Board>();
+        TEST_ASSERT_NOT_NULL_MESSAGE(board, "Create board object failed");
+
+        board_common_init(board.get());
+        bool has_touch = (board->getTouch() != nullptr);
+        TEST_ASSERT_TRUE_MESSAGE(board->del(), "Board delete failed");
+        board = nullptr;
+        if (has_touch) {
+            gpio_uninstall_isr_service();
+        }
+
+        // Every device must release all the memory it allocated through `esp_utils` once the board is deleted
+        for (auto tag : tags) {
+            esp_utils_mem_trace_tag_info_t info = {};
+            esp_utils_mem_trace_get_tag_info(tag, &info);
+            if (info.live_bytes != 0) {
+                esp_utils_mem_trace_print_info();
+            }
+            TEST_ASSERT_EQUAL_MESSAGE(0, info.live_bytes, tag);
+        }
+    }
+}
+#endif // ESP_UTILS_CONF_MEM_TRACE_ENABLE
+
 #define CREATE_TEST_CASE(board_name) \
     TEST_CASE("Test common board with " #board_name " external config", "[board][common][external]") \
     { \
@@ -0,0 +1,202 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdio>
+#include <vector>
+#include "unity.h"
+#include "esp_lcd_panel_io_3wire_spi_wave.h"
+
+#define TEST_DATA_PATTERN       (0xA5C3961EUL)
+#define TEST_INIT_CMD_NUM       (300)   // Typical number of packages in the vendor init table of an RGB panel
+
+static uint8_t get_cs_active(const spi_3wire_wave_config_t &config)
+{
+    return config.cs_high_active ? SPI_3WIRE_WAVE_CS : 0;
+}
+
+static uint8_t get_scl_active(const spi_3wire_wave_config_t &config)
+{
+    return config.scl_active_rising_edge ? SPI_3WIRE_WAVE_SCL : 0;
+}
+
+/**
+ * Decode the waveform as the panel samples it. SDA is sampled on the active edges of SCL while CS is active. The
+ * decoding fails if SDA changes at an active edge, if CS is activated more than once or if the lines don't end idle.
+ */
+static bool decode_wave(const spi_3wire_wave_config_t &config, const uint8_t *states, size_t count,
+                        std::vector<int> &bits)
+{
+    uint8_t prev = spi_3wire_wave_get_idle_state(&config);
+    bool is_started = false;
+    bool is_ended = false;
+
+    for (size_t i = 0; i < count; i++) {
+        uint8_t state = states[i];
+        bool cs_active = (state & SPI_3WIRE_WAVE_CS) == get_cs_active(config);
+        bool prev_cs_active = (prev & SPI_3WIRE_WAVE_CS) == get_cs_active(config);
+
+        if (cs_active && !prev_cs_active) {
+            if (is_started) {
+                return false;
+            }
+            is_started = true;
+        } else if (!cs_active && prev_cs_active) {
+            is_ended = true;
+        }
+        if (cs_active && prev_cs_active) {
+            bool scl_edge = ((state ^ prev) & SPI_3WIRE_WAVE_SCL) != 0;
+            bool is_active_edge = scl_edge && ((state & SPI_3WIRE_WAVE_SCL) == get_scl_active(config));
+            if (is_active_edge) {
+                if ((state ^ prev) & SPI_3WIRE_WAVE_SDA) {
+                    return false;
+                }
+                bits.push_back((state & SPI_3WIRE_WAVE_SDA) ? 1 : 0);
+            }
+        }
+        prev = state;
+    }
+
+    return is_started && is_ended && (prev == spi_3wire_wave_get_idle_state(&config));
+}
+
+static std::vector<int> get_expected_bits(const spi_3wire_wave_config_t &config, int dc_bit, const uint8_t *data,
+        size_t data_size)
+{
+    std::vector<int> bits;
+    if (dc_bit != SPI_3WIRE_WAVE_NO_DC_BIT) {
+        bits.push_back(dc_bit);
+    }
+    for (size_t i = 0; i < data_size; i++) {
+        for (int j = 0; j < 8; j++) {
+            int shift = config.lsb_first ? j : (7 - j);
+            bits.push_back((data[i] >> shift) & 0x1);
+        }
+    }
+    return bits;
+}
+
+/* Transactions of an IO expander when all the lines are on it: one read of the output register, then one write per change */
+static int count_expander_transactions(const spi_3wire_wave_config_t &config, const uint8_t *states, size_t count)
+{
+    uint8_t prev = spi_3wire_wave_get_idle_state(&config);
+    int transactions = 1;
+    for (size_t i = 0; i < count; i++) {
+        if (states[i] != prev) {
+            transactions++;
+        }
+        prev = states[i];
+    }
+    return transactions;
+}
+
+/**
+ * Transactions of the previous implementation, which called `esp_io_expander_set_level()` for each line change.
+ * Every call reads the direction and output registers, then writes the output register if it changes.
+ */
+static int count_legacy_transactions(const spi_3wire_wave_config_t &config, int dc_bit, const uint8_t *data,
+                                     size_t data_size)
+{
+    uint8_t state = spi_3wire_wave_get_idle_state(&config);
+    int transactions = 0;
+    auto set_line = [&](uint8_t line, bool level) {
+        uint8_t new_state = level ? (state | line) : (state & ~line);
+        transactions += (new_state != state) ? 3 : 2;
+        state = new_state;
+    };
+    uint8_t idle_state = spi_3wire_wave_get_idle_state(&config);
+    bool scl_before = !config.scl_active_rising_edge;
+
+    set_line(SPI_3WIRE_WAVE_CS, config.cs_high_active);
+    set_line(SPI_3WIRE_WAVE_SCL, scl_before);
+    for (int bit : get_expected_bits(config, dc_bit, data, data_size)) {
+        set_line(SPI_3WIRE_WAVE_SDA, bit);
+        set_line(SPI_3WIRE_WAVE_SCL, scl_before);
+        set_line(SPI_3WIRE_WAVE_SCL, !scl_before);
+    }
+    set_line(SPI_3WIRE_WAVE_SCL, idle_state & SPI_3WIRE_WAVE_SCL);
+    set_line(SPI_3WIRE_WAVE_SDA, idle_state & SPI_3WIRE_WAVE_SDA);
+    set_line(SPI_3WIRE_WAVE_CS, idle_state & SPI_3WIRE_WAVE_CS);
+
+    return transactions;
+}
+
+/* Same as `esp_lcd_new_panel_io_3wire_spi()` */
+static spi_3wire_wave_config_t get_config(int spi_mode, bool cs_high_active, bool lsb_first)
+{
+    spi_3wire_wave_config_t config = {};
+    config.cs_high_active = cs_high_active;
+    config.lsb_first = lsb_first;
+    config.sda_scl_idle_high = spi_mode & 0x1;
+    if (config.sda_scl_idle_high) {
+        config.scl_active_rising_edge = (spi_mode & 0x2) ? 1 : 0;
+    } else {
+        config.scl_active_rising_edge = (spi_mode & 0x2) ? 0 : 1;
+    }
+    return config;
+}
+
+TEST_CASE("Test 3-wire SPI waveform decoding of all the modes", "[bus][3wire_spi][wave]")
+{
+    uint8_t data[SPI_3WIRE_WAVE_BYTES_MAX];
+    uint8_t states[SPI_3WIRE_WAVE_STATES_MAX];
+    const int dc_bits[] = {SPI_3WIRE_WAVE_NO_DC_BIT, 0, 1};
+
+    for (int i = 0; i < SPI_3WIRE_WAVE_BYTES_MAX; i++) {
+        data[i] = (TEST_DATA_PATTERN >> (i * 8)) & 0xff;
+    }
+    for (int spi_mode = 0; spi_mode < 4; spi_mode++) {
+        for (int flags = 0; flags < 4; flags++) {
+            spi_3wire_wave_config_t config = get_config(spi_mode, flags & 0x1, flags & 0x2);
+            for (int dc_bit : dc_bits) {
+                for (size_t data_size = 1; data_size <= SPI_3WIRE_WAVE_BYTES_MAX; data_size++) {
+                    size_t count = spi_3wire_wave_encode(&config, dc_bit, data, data_size, states);
+                    TEST_ASSERT_GREATER_THAN(0, count);
+                    TEST_ASSERT_LESS_OR_EQUAL(SPI_3WIRE_WAVE_STATES_MAX, count);
+
+                    std::vector<int> bits;
+                    TEST_ASSERT_TRUE(decode_wave(config, states, count, bits));
+                    std::vector<int> expected = get_expected_bits(config, dc_bit, data, data_size);
+                    TEST_ASSERT_EQUAL(expected.size(), bits.size());
+                    TEST_ASSERT_EQUAL_INT_ARRAY(expected.data(), bits.data(), expected.size());
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Test 3-wire SPI waveform with invalid arguments", "[bus][3wire_spi][wave]")
+{
+    spi_3wire_wave_config_t config = get_config(0, false, false);
+    uint8_t data[SPI_3WIRE_WAVE_BYTES_MAX + 1] = {};
+    uint8_t states[SPI_3WIRE_WAVE_STATES_MAX];
+
+    TEST_ASSERT_EQUAL(0, spi_3wire_wave_encode(nullptr, 0, data, 1, states));
+    TEST_ASSERT_EQUAL(0, spi_3wire_wave_encode(&config, 0, data, 1, nullptr));
+    TEST_ASSERT_EQUAL(0, spi_3wire_wave_encode(&config, 0, nullptr, 1, states));
+    TEST_ASSERT_EQUAL(0, spi_3wire_wave_encode(&config, 0, data, sizeof(data), states));
+}
+
+TEST_CASE("Test 3-wire SPI transactions through IO expander", "[bus][3wire_spi][wave]")
+{
+    uint8_t states[SPI_3WIRE_WAVE_STATES_MAX];
+    int transactions = 0;
+    int legacy_transactions = 0;
+
+    // 9-bit packages with a DC bit, as used by most RGB panels
+    for (int spi_mode = 0; spi_mode < 4; spi_mode++) {
+        spi_3wire_wave_config_t config = get_config(spi_mode, false, false);
+        transactions = 0;
+        legacy_transactions = 0;
+        for (int i = 0; i < TEST_INIT_CMD_NUM; i++) {
+            uint8_t data = i & 0xff;
+            size_t count = spi_3wire_wave_encode(&config, i & 0x1, &data, 1, states);
+            transactions += count_expander_transactions(config, states, count);
+            legacy_transactions += count_legacy_transactions(config, i & 0x1, &data, 1);
+        }
+        printf("SPI mode %d: %d packages, %d transactions (previously %d)\n", spi_mode, TEST_INIT_CMD_NUM,
+               transactions, legacy_transactions);
+        TEST_ASSERT_LESS_OR_EQUAL(legacy_transactions / 3, transactions);
+    }
+}
@@ -0,0 +1,262 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdint>
+#include <cstdio>
+#include "unity.h"
+#include "esp_lcd_te_sync.h"
+
+#define TEST_LCD_H_RES          (360)
+#define TEST_LCD_V_RES          (360)
+#define TEST_LCD_BIT_PER_PIXEL  (16)
+#define TEST_TE_PERIOD_US       (16667)     // 60 Hz
+#define TEST_TE_OFFSET_US       (1234)      // Time of the first TE pulse
+
+#define TEST_BUS_BYTES_PER_US   (20)        // QSPI at 40 MHz
+#define TEST_BUS_TRANS_US       (10)        // Setup time of a transaction
+#define TEST_BUS_CMD_SIZE       (4)         // Command header of the QSPI panels
+#define TEST_BUS_PARAM_SIZE     (4)         // Parameters of CASET/RASET
+
+#define TEST_STRIPE_ROWS        (36)        // Rows rendered at once by LVGL, 1/10 of the screen
+#define TEST_FRAME_NUM          (120)
+#define TEST_RENDER_US_MIN      (300)
+#define TEST_RENDER_US_MAX      (1500)
+
+typedef struct {
+    bool use_te;
+    bool use_window_cache;
+    bool mirror_y;
+} test_sim_config_t;
+
+typedef struct {
+    int tear_num;
+    int stripe_num;
+    int cmd_bytes;
+    int64_t wait_us;
+    int64_t total_us;
+} test_sim_result_t;
+
+static uint32_t test_rand(uint32_t *seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return (*seed >> 16) & 0x7fff;
+}
+
+static int64_t get_row_scan_us(int row)
+{
+    return (int64_t)row * TEST_TE_PERIOD_US / TEST_LCD_V_RES;
+}
+
+/* Index of the first frame which shows a row written at the given time */
+static int64_t get_shown_frame(int row, int64_t write_us)
+{
+    int64_t delta = write_us - TEST_TE_OFFSET_US - get_row_scan_us(row);
+    return (delta <= 0) ? 0 : (delta + TEST_TE_PERIOD_US - 1) / TEST_TE_PERIOD_US;
+}
+
+/**
+ * Send the stripes of the frames as `draw_bitmap()` of the QSPI panels does: CASET, RASET, then the pixels. The panel
+ * scans the rows from the top at a constant rate and sends a TE pulse at the start of each frame. A stripe tears if its
+ * rows are first shown by different frames.
+ */
+static test_sim_result_t simulate(const test_sim_config_t &config)
+{
+    test_sim_result_t result = {};
+    esp_lcd_te_timing_t timing;
+    esp_lcd_window_cache_t window = {};
+    // The period is measured during the first frame
+    int64_t now_us = TEST_TE_OFFSET_US + TEST_TE_PERIOD_US;
+    int64_t next_te_us = TEST_TE_OFFSET_US;
+    uint32_t seed = 1;
+    const int row_bytes = TEST_LCD_H_RES * TEST_LCD_BIT_PER_PIXEL / 8;
+
+    esp_lcd_te_timing_init(&timing, TEST_LCD_V_RES);
+    timing.flags.mirror_y = config.mirror_y;
+    auto receive_te = [&]() {
+        while (next_te_us <= now_us) {
+            esp_lcd_te_timing_on_pulse(&timing, next_te_us);
+            next_te_us += TEST_TE_PERIOD_US;
+        }
+    };
+    auto send_cmd = [&](int param_size) {
+        now_us += TEST_BUS_TRANS_US + (TEST_BUS_CMD_SIZE + param_size) / TEST_BUS_BYTES_PER_US;
+        result.cmd_bytes += TEST_BUS_CMD_SIZE + param_size;
+    };
+
+    for (int frame = 0; frame < TEST_FRAME_NUM; frame++) {
+        for (int y_start = 0; y_start < TEST_LCD_V_RES; y_start += TEST_STRIPE_ROWS) {
+            int y_end = y_start + TEST_STRIPE_ROWS;
+            now_us += TEST_RENDER_US_MIN + test_rand(&seed) % (TEST_RENDER_US_MAX - TEST_RENDER_US_MIN);
+
+            bool send_caset = true;
+            bool send_raset = true;
+            if (config.use_window_cache) {
+                esp_lcd_window_cache_update(&window, 0, y_start, TEST_LCD_H_RES, y_end, &send_caset, &send_raset);
+            }
+            if (send_caset) {
+                send_cmd(TEST_BUS_PARAM_SIZE);
+            }
+            if (send_raset) {
+                send_cmd(TEST_BUS_PARAM_SIZE);
+            }
+            if (config.use_te) {
+                receive_te();
+                uint32_t wait_us = esp_lcd_te_timing_get_wait_us(&timing, now_us, y_start, y_end);
+                now_us += wait_us;
+                result.wait_us += wait_us;
+            }
+            send_cmd(0);
+
+            // Rows are written in order, mirrored rows are scanned from the bottom
+            int64_t first_frame = INT64_MAX;
+            int64_t last_frame = INT64_MIN;
+            for (int y = y_start; y < y_end; y++) {
+                now_us += row_bytes / TEST_BUS_BYTES_PER_US;
+                int row = config.mirror_y ? (TEST_LCD_V_RES - 1 - y) : y;
+                int64_t shown_frame = get_shown_frame(row, now_us);
+                first_frame = (shown_frame < first_frame) ? shown_frame : first_frame;
+                last_frame = (shown_frame > last_frame) ? shown_frame : last_frame;
+            }
+            result.tear_num += (first_frame != last_frame) ? 1 : 0;
+            result.stripe_num++;
+        }
+    }
+    result.total_us = now_us;
+
+    return result;
+}
+
+static void print_result(const char *name, const test_sim_result_t &result)
+{
+    printf("%s: %d/%d stripes torn, %d command bytes/frame, %.2f ms/frame (%.2f ms waiting)\n", name,
+           result.tear_num, result.stripe_num, result.cmd_bytes / TEST_FRAME_NUM,
+           (double)result.total_us / TEST_FRAME_NUM / 1000, (double)result.wait_us / TEST_FRAME_NUM / 1000);
+}
+
+TEST_CASE("Test LCD window cache", "[lcd][te_sync]")
+{
+    esp_lcd_window_cache_t cache = {};
+    bool send_caset = false;
+    bool send_raset = false;
+
+    esp_lcd_window_cache_update(&cache, 0, 0, 360, 36, &send_caset, &send_raset);
+    TEST_ASSERT_TRUE(send_caset && send_raset);
+    esp_lcd_window_cache_update(&cache, 0, 0, 360, 36, &send_caset, &send_raset);
+    TEST_ASSERT_FALSE(send_caset || send_raset);
+    esp_lcd_window_cache_update(&cache, 0, 36, 360, 72, &send_caset, &send_raset);
+    TEST_ASSERT_TRUE(!send_caset && send_raset);
+    esp_lcd_window_cache_update(&cache, 10, 36, 20, 72, &send_caset, &send_raset);
+    TEST_ASSERT_TRUE(send_caset && !send_raset);
+
+    esp_lcd_window_cache_invalidate(&cache);
+    esp_lcd_window_cache_update(&cache, 10, 36, 20, 72, &send_caset, &send_raset);
+    TEST_ASSERT_TRUE(send_caset && send_raset);
+}
+
+TEST_CASE("Test LCD TE timing", "[lcd][te_sync]")
+{
+    esp_lcd_te_timing_t timing;
+    esp_lcd_te_timing_init(&timing, TEST_LCD_V_RES);
+
+    // No signal, no wait
+    TEST_ASSERT_EQUAL_UINT32(0, esp_lcd_te_timing_get_wait_us(&timing, 1000, 0, TEST_STRIPE_ROWS));
+    esp_lcd_te_timing_on_pulse(&timing, TEST_TE_OFFSET_US);
+    TEST_ASSERT_EQUAL_UINT32(0, esp_lcd_te_timing_get_wait_us(&timing, TEST_TE_OFFSET_US, 0, TEST_STRIPE_ROWS));
+
+    // The period is measured, the glitches are skipped
+    int64_t te_us = TEST_TE_OFFSET_US + TEST_TE_PERIOD_US;
+    esp_lcd_te_timing_on_pulse(&timing, te_us);
+    TEST_ASSERT_EQUAL_UINT32(TEST_TE_PERIOD_US, timing.period_us);
+    esp_lcd_te_timing_on_pulse(&timing, te_us + 100);
+    TEST_ASSERT_EQUAL_UINT32(TEST_TE_PERIOD_US, timing.period_us);
+    te_us += 100 + TEST_TE_PERIOD_US;
+    esp_lcd_te_timing_on_pulse(&timing, te_us);
+    TEST_ASSERT_EQUAL_UINT32(TEST_TE_PERIOD_US, timing.period_us);
+
+    // The top rows are written once the scan has passed them
+    uint32_t earliest_us = get_row_scan_us(TEST_STRIPE_ROWS);
+    TEST_ASSERT_EQUAL_UINT32(earliest_us, esp_lcd_te_timing_get_wait_us(&timing, te_us, 0, TEST_STRIPE_ROWS));
+    TEST_ASSERT_EQUAL_UINT32(0, esp_lcd_te_timing_get_wait_us(&timing, te_us + earliest_us, 0, TEST_STRIPE_ROWS));
+    // Too late to be finished before the next scan
+    TEST_ASSERT_EQUAL_UINT32(1000 + earliest_us,
+                             esp_lcd_te_timing_get_wait_us(&timing, te_us + TEST_TE_PERIOD_US - 1000, 0,
+                                     TEST_STRIPE_ROWS));
+    // The bottom rows are still behind the previous scan at the start of the frame
+    TEST_ASSERT_EQUAL_UINT32(0, esp_lcd_te_timing_get_wait_us(&timing, te_us + 1, TEST_LCD_V_RES - TEST_STRIPE_ROWS,
+                             TEST_LCD_V_RES));
+
+    // Mirrored top rows are scanned last
+    TEST_ASSERT_EQUAL_UINT32(0, esp_lcd_te_timing_get_wait_us(&timing, te_us + 14000, 0, TEST_STRIPE_ROWS));
+    timing.flags.mirror_y = 1;
+    TEST_ASSERT_EQUAL_UINT32(TEST_TE_PERIOD_US - 14000,
+                             esp_lcd_te_timing_get_wait_us(&timing, te_us + 14000, 0, TEST_STRIPE_ROWS));
+    timing.flags.mirror_y = 0;
+
+    // Large and swapped areas are written from the next TE pulse
+    TEST_ASSERT_EQUAL_UINT32(TEST_TE_PERIOD_US - 1000,
+                             esp_lcd_te_timing_get_wait_us(&timing, te_us + 1000, 0, TEST_LCD_V_RES));
+    timing.flags.swap_xy = 1;
+    TEST_ASSERT_EQUAL_UINT32(TEST_TE_PERIOD_US - 1000,
+                             esp_lcd_te_timing_get_wait_us(&timing, te_us + 1000, 0, TEST_STRIPE_ROWS));
+    timing.flags.swap_xy = 0;
+
+    // The signal is lost
+    TEST_ASSERT_EQUAL_UINT32(0, esp_lcd_te_timing_get_wait_us(&timing, te_us + TEST_TE_PERIOD_US * 5, 0,
+                             TEST_STRIPE_ROWS));
+}
+
+TEST_CASE("Test LCD TE period measured again", "[lcd][te_sync]")
+{
+    esp_lcd_te_timing_t timing;
+    int64_t te_us = TEST_TE_OFFSET_US;
+
+    // A glitch at startup gives a too short first period
+    esp_lcd_te_timing_init(&timing, TEST_LCD_V_RES);
+    esp_lcd_te_timing_on_pulse(&timing, te_us);
+    te_us += 100;
+    esp_lcd_te_timing_on_pulse(&timing, te_us);
+    TEST_ASSERT_EQUAL_UINT32(100, timing.period_us);
+    for (int i = 0; i < 4; i++) {
+        te_us += TEST_TE_PERIOD_US;
+        esp_lcd_te_timing_on_pulse(&timing, te_us);
+    }
+    TEST_ASSERT_EQUAL_UINT32(TEST_TE_PERIOD_US, timing.period_us);
+
+    // A missed pulse at startup gives a too long first period, the real one is at the limit of the skipped pulses
+    esp_lcd_te_timing_init(&timing, TEST_LCD_V_RES);
+    esp_lcd_te_timing_on_pulse(&timing, te_us);
+    te_us += TEST_TE_PERIOD_US * 2;
+    esp_lcd_te_timing_on_pulse(&timing, te_us);
+    for (int i = 0; i < 4; i++) {
+        te_us += TEST_TE_PERIOD_US;
+        esp_lcd_te_timing_on_pulse(&timing, te_us);
+    }
+    TEST_ASSERT_EQUAL_UINT32(TEST_TE_PERIOD_US, timing.period_us);
+
+    // A single missed pulse is skipped
+    te_us += TEST_TE_PERIOD_US * 2;
+    esp_lcd_te_timing_on_pulse(&timing, te_us);
+    TEST_ASSERT_EQUAL_UINT32(TEST_TE_PERIOD_US, timing.period_us);
+    te_us += TEST_TE_PERIOD_US;
+    esp_lcd_te_timing_on_pulse(&timing, te_us);
+    TEST_ASSERT_EQUAL_UINT32(TEST_TE_PERIOD_US, timing.period_us);
+    TEST_ASSERT_EQUAL_UINT8(0, timing.reject_cnt);
+}
+
+TEST_CASE("Test LCD stripes written behind the scan line", "[lcd][te_sync]")
+{
+    test_sim_result_t legacy = simulate({false, false, false});
+    test_sim_result_t synced = simulate({true, true, false});
+    test_sim_result_t mirrored = simulate({true, true, true});
+
+    print_result("Without TE", legacy);
+    print_result("With TE", synced);
+    print_result("With TE, mirrored", mirrored);
+    TEST_ASSERT_GREATER_THAN(0, legacy.tear_num);
+    TEST_ASSERT_EQUAL(0, synced.tear_num);
+    TEST_ASSERT_EQUAL(0, mirrored.tear_num);
+    // Only RASET is sent for the full width stripes
+    TEST_ASSERT_LESS_THAN(legacy.cmd_bytes, synced.cmd_bytes);
+}
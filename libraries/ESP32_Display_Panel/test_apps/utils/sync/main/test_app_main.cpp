@@ -0,0 +1,38 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include "sdkconfig.h"
+#include "unity.h"
+#if !CONFIG_IDF_TARGET_LINUX
+#include "unity_test_utils.h"
+
+// Some resources are lazy allocated by pthread and newlib, the threadhold is left for that case
+#define TEST_MEMORY_LEAK_THRESHOLD (300)
+
+void setUp(void)
+{
+    unity_utils_record_free_mem();
+}
+
+void tearDown(void)
+{
+    esp_reent_cleanup();    //clean up some of the newlib's lazy allocations
+    unity_utils_evaluate_leaks_direct(TEST_MEMORY_LEAK_THRESHOLD);
+}
+#else
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+#endif
+
+extern "C" void app_main(void)
+{
+    printf("Utils sync test\r\n");
+    unity_run_menu();
+}
@@ -0,0 +1,316 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "unity.h"
+#include "utils/esp_panel_utils_sync.hpp"
+
+using namespace esp_panel::utils;
+
+#define TEST_TASK_STACK_SIZE        (4 * 1024)
+#define TEST_TASK_PRIORITY          (5)
+#define TEST_SNAPSHOT_WORD_NUM      (15)
+#define TEST_SNAPSHOT_WRITE_NUM     (20000)
+#define TEST_SNAPSHOT_READER_NUM    (2)
+#define TEST_EVENT_NUM              (1000)
+#define TEST_EVENT_TIMEOUT_MS       (1000)
+
+static int64_t get_time_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()
+           ).count();
+}
+
+/* Every word of a consistent snapshot is derived from `seq`, so a torn copy is detected by the readers */
+struct TestSnapshot {
+    uint32_t seq;
+    uint32_t words[TEST_SNAPSHOT_WORD_NUM];
+};
+
+static TestSnapshot make_snapshot(uint32_t seq)
+{
+    TestSnapshot snapshot = {};
+    snapshot.seq = seq;
+    for (int i = 0; i < TEST_SNAPSHOT_WORD_NUM; i++) {
+        snapshot.words[i] = seq * (i + 1);
+    }
+    return snapshot;
+}
+
+static bool is_snapshot_valid(const TestSnapshot &snapshot)
+{
+    for (int i = 0; i < TEST_SNAPSHOT_WORD_NUM; i++) {
+        if (snapshot.words[i] != snapshot.seq * (i + 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Mutex protected snapshot, used as the baseline of the sequence lock */
+class MutexSnapshot {
+public:
+    void store(const TestSnapshot &value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _value = value;
+    }
+
+    TestSnapshot load()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _value;
+    }
+
+private:
+    std::mutex _mutex;
+    TestSnapshot _value = {};
+};
+
+template <typename Snapshot>
+struct SnapshotTestContext {
+    Snapshot snapshot;
+    SemaphoreHandle_t done_sem = nullptr;
+    std::atomic<bool> writing{true};
+    std::atomic<uint32_t> read_num{0};
+    std::atomic<uint32_t> error_num{0};
+};
+
+template <typename Snapshot>
+static void snapshot_writer_task(void *arg)
+{
+    auto context = static_cast<SnapshotTestContext<Snapshot> *>(arg);
+
+    for (uint32_t seq = 1; seq <= TEST_SNAPSHOT_WRITE_NUM; seq++) {
+        context->snapshot.store(make_snapshot(seq));
+        if ((seq % 64) == 0) {
+            taskYIELD();
+        }
+    }
+    context->writing = false;
+
+    xSemaphoreGive(context->done_sem);
+    vTaskDelete(NULL);
+}
+
+template <typename Snapshot>
+static void snapshot_reader_task(void *arg)
+{
+    auto context = static_cast<SnapshotTestContext<Snapshot> *>(arg);
+    uint32_t last_seq = 0;
+    uint32_t read_num = 0;
+
+    while (context->writing) {
+        TestSnapshot snapshot = context->snapshot.load();
+        if (!is_snapshot_valid(snapshot) || (snapshot.seq < last_seq)) {
+            context->error_num++;
+        }
+        last_seq = snapshot.seq;
+        if ((++read_num % 256) == 0) {
+            taskYIELD();
+        }
+    }
+    context->read_num += read_num;
+
+    xSemaphoreGive(context->done_sem);
+    vTaskDelete(NULL);
+}
+
+template <typename Snapshot>
+static void run_snapshot_test(const char *name)
+{
+    auto context = new SnapshotTestContext<Snapshot>();
+    TEST_ASSERT_NOT_NULL(context);
+    context->done_sem = xSemaphoreCreateCounting(TEST_SNAPSHOT_READER_NUM + 1, 0);
+    TEST_ASSERT_NOT_NULL(context->done_sem);
+
+    int64_t start_us = get_time_us();
+    for (int i = 0; i < TEST_SNAPSHOT_READER_NUM; i++) {
+        TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(
+                              snapshot_reader_task<Snapshot>, "reader", TEST_TASK_STACK_SIZE, context,
+                              TEST_TASK_PRIORITY, NULL
+                          ));
+    }
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(
+                          snapshot_writer_task<Snapshot>, "writer", TEST_TASK_STACK_SIZE, context, TEST_TASK_PRIORITY,
+                          NULL
+                      ));
+    for (int i = 0; i < TEST_SNAPSHOT_READER_NUM + 1; i++) {
+        TEST_ASSERT_EQUAL(pdTRUE, xSemaphoreTake(context->done_sem, portMAX_DELAY));
+    }
+    int64_t elapsed_us = get_time_us() - start_us;
+
+    printf(
+        "%s: %d writes, %d reads in %d us, %d errors\n", name, TEST_SNAPSHOT_WRITE_NUM,
+        static_cast<int>(context->read_num), static_cast<int>(elapsed_us), static_cast<int>(context->error_num)
+    );
+    TEST_ASSERT_EQUAL(0, context->error_num.load());
+    TEST_ASSERT_EQUAL(TEST_SNAPSHOT_WRITE_NUM, context->snapshot.load().seq);
+
+    // Wait for the deleted tasks to be cleaned up by the idle task
+    vTaskDelay(pdMS_TO_TICKS(10));
+    vSemaphoreDelete(context->done_sem);
+    delete context;
+}
+
+TEST_CASE("Test SeqLock with a writer and concurrent readers", "[utils][sync][seqlock]")
+{
+    run_snapshot_test<SeqLock<TestSnapshot>>("SeqLock");
+    run_snapshot_test<MutexSnapshot>("Mutex");
+}
+
+TEST_CASE("Test SeqLock basic functions", "[utils][sync][seqlock]")
+{
+    SeqLock<TestSnapshot> snapshot;
+    TEST_ASSERT_EQUAL(0, snapshot.load().seq);
+
+    uint32_t version = snapshot.getVersion();
+    snapshot.store(make_snapshot(42));
+    TEST_ASSERT_EQUAL(version + 1, snapshot.getVersion());
+    TestSnapshot value = snapshot.load();
+    TEST_ASSERT_EQUAL(42, value.seq);
+    TEST_ASSERT_TRUE(is_snapshot_valid(value));
+}
+
+TEST_CASE("Test EventFlags basic functions", "[utils][sync][event_flags]")
+{
+    EventFlags flags;
+
+    flags.set((1U << 0) | (1U << 2));
+    TEST_ASSERT_EQUAL((1U << 2), flags.test(1U << 2));
+    flags.clear(1U << 2);
+    TEST_ASSERT_EQUAL(0, flags.test(1U << 2));
+    TEST_ASSERT_EQUAL((1U << 0), flags.fetchClear((1U << 0) | (1U << 1)));
+    TEST_ASSERT_EQUAL(0, flags.test(UINT32_MAX));
+
+    // Flags set before waiting are returned immediately
+    flags.set(1U << 1);
+    TEST_ASSERT_EQUAL((1U << 1), flags.wait((1U << 1), 0));
+    TEST_ASSERT_EQUAL(0, flags.wait((1U << 1), 0));
+
+    // Stale wakeups don't end the wait early
+#if ESP_PANEL_UTILS_EVENT_FLAGS_USE_TASK_NOTIFY
+    xTaskNotifyGiveIndexed(xTaskGetCurrentTaskHandle(), ESP_PANEL_UTILS_EVENT_FLAGS_NOTIFY_INDEX);
+#endif
+    flags.set(1U << 3);
+    int64_t start_us = get_time_us();
+    TEST_ASSERT_EQUAL(0, flags.wait((1U << 0), 20));
+    int64_t elapsed_us = get_time_us() - start_us;
+    TEST_ASSERT_GREATER_OR_EQUAL(20 * 1000 - 1000, elapsed_us);
+    TEST_ASSERT_EQUAL((1U << 3), flags.test(1U << 3));
+}
+
+struct EventTestContext {
+    EventFlags request;
+    EventFlags response;
+    SemaphoreHandle_t request_sem = nullptr;
+    SemaphoreHandle_t response_sem = nullptr;
+    SemaphoreHandle_t done_sem = nullptr;
+    bool use_flags = true;
+    std::atomic<int64_t> set_time_us{0};
+    int64_t latency_sum_us = 0;
+    int64_t latency_max_us = 0;
+    int received_num = 0;
+};
+
+static void event_consumer_task(void *arg)
+{
+    auto context = static_cast<EventTestContext *>(arg);
+
+    for (int i = 0; i < TEST_EVENT_NUM; i++) {
+        bool received = context->use_flags ?
+                        (context->request.wait((1U << 0), TEST_EVENT_TIMEOUT_MS) != 0) :
+                        (xSemaphoreTake(context->request_sem, pdMS_TO_TICKS(TEST_EVENT_TIMEOUT_MS)) == pdTRUE);
+        if (!received) {
+            break;
+        }
+        int64_t latency_us = get_time_us() - context->set_time_us.load();
+        context->latency_sum_us += latency_us;
+        context->latency_max_us = std::max(context->latency_max_us, latency_us);
+        context->received_num++;
+        if (context->use_flags) {
+            context->response.set(1U << 0);
+        } else {
+            xSemaphoreGive(context->response_sem);
+        }
+    }
+
+    xSemaphoreGive(context->done_sem);
+    vTaskDelete(NULL);
+}
+
+static void event_producer_task(void *arg)
+{
+    auto context = static_cast<EventTestContext *>(arg);
+
+    for (int i = 0; i < TEST_EVENT_NUM; i++) {
+        context->set_time_us = get_time_us();
+        if (context->use_flags) {
+            context->request.set(1U << 0);
+            if (context->response.wait((1U << 0), TEST_EVENT_TIMEOUT_MS) == 0) {
+                break;
+            }
+        } else {
+            xSemaphoreGive(context->request_sem);
+            if (xSemaphoreTake(context->response_sem, pdMS_TO_TICKS(TEST_EVENT_TIMEOUT_MS)) != pdTRUE) {
+                break;
+            }
+        }
+    }
+
+    xSemaphoreGive(context->done_sem);
+    vTaskDelete(NULL);
+}
+
+static void run_event_test(bool use_flags)
+{
+    auto context = new EventTestContext();
+    TEST_ASSERT_NOT_NULL(context);
+    context->use_flags = use_flags;
+    context->request_sem = xSemaphoreCreateBinary();
+    context->response_sem = xSemaphoreCreateBinary();
+    context->done_sem = xSemaphoreCreateCounting(2, 0);
+    TEST_ASSERT_TRUE(
+        (context->request_sem != nullptr) && (context->response_sem != nullptr) && (context->done_sem != nullptr)
+    );
+
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(
+                          event_consumer_task, "consumer", TEST_TASK_STACK_SIZE, context, TEST_TASK_PRIORITY, NULL
+                      ));
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(
+                          event_producer_task, "producer", TEST_TASK_STACK_SIZE, context, TEST_TASK_PRIORITY - 1, NULL
+                      ));
+    for (int i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL(pdTRUE, xSemaphoreTake(context->done_sem, portMAX_DELAY));
+    }
+
+    printf(
+        "%s: %d events, latency avg %d us, max %d us\n", use_flags ? "EventFlags" : "Semaphore",
+        context->received_num, static_cast<int>(context->latency_sum_us / std::max(context->received_num, 1)),
+        static_cast<int>(context->latency_max_us)
+    );
+    TEST_ASSERT_EQUAL(TEST_EVENT_NUM, context->received_num);
+
+    // Wait for the deleted tasks to be cleaned up by the idle task
+    vTaskDelay(pdMS_TO_TICKS(10));
+    vSemaphoreDelete(context->request_sem);
+    vSemaphoreDelete(context->response_sem);
+    vSemaphoreDelete(context->done_sem);
+    delete context;
+}
+
+TEST_CASE("Test EventFlags with a producer and a consumer", "[utils][sync][event_flags]")
+{
+    run_event_test(true);
+    run_event_test(false);
+}
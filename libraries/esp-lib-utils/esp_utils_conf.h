@@ -46,6 +46,24 @@
  */
 #define ESP_UTILS_CONF_LOG_BUFFER_SIZE                      (256)
 
+/**
+ * @brief Set to 1 to enable deferred logging (C++ only).
+ *
+ * If enabled, log calls only record the format string, a timestamp and the raw arguments into a per-thread lock-free
+ * ring buffer. The messages are formatted and printed later by `esp_utils::LogDeferred::getInstance().flush()` or the
+ * drain task started by `startDrainTask()`.
+ */
+#define ESP_UTILS_CONF_LOG_DEFERRED_ENABLE                  (0)
+#if ESP_UTILS_CONF_LOG_DEFERRED_ENABLE
+
+    #define ESP_UTILS_CONF_LOG_DEFERRED_THREAD_NUM          (8)     /*!< Maximum number of threads with their own ring */
+    #define ESP_UTILS_CONF_LOG_DEFERRED_RECORD_NUM          (32)    /*!< Number of records in each ring */
+    #define ESP_UTILS_CONF_LOG_DEFERRED_PAYLOAD_SIZE        (64)    /*!< Bytes reserved for arguments in each record */
+    #define ESP_UTILS_CONF_LOG_DEFERRED_DRAIN_INTERVAL_MS   (100)   /*!< Default interval of the drain task */
+    #define ESP_UTILS_CONF_LOG_DEFERRED_DRAIN_TASK_PRIORITY (1)     /*!< Priority of the drain task */
+
+#endif // ESP_UTILS_CONF_LOG_DEFERRED_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////// Memory Configurations /////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -64,6 +82,8 @@
  *  - ESP_UTILS_MEM_ALLOC_TYPE_MICROPYTHON: Use the MicroPython memory allocation functions (m_malloc, m_free)
  *  - ESP_UTILS_MEM_ALLOC_TYPE_CUSTOM:      Use custom memory allocation functions (ESP_UTILS_MEM_ALLOC_CUSTOM_MALLOC,
  *                                          ESP_UTILS_MEM_ALLOC_CUSTOM_FREE)
+ *  - ESP_UTILS_MEM_ALLOC_TYPE_POOL:        Use the size-class pool allocator with thread-local caches for small sizes,
+ *                                          larger sizes are forwarded to `malloc()`
  */
 #define ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE                   (ESP_UTILS_MEM_ALLOC_TYPE_STDLIB)
 #if ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_ESP
@@ -77,8 +97,60 @@
     #define ESP_UTILS_CONF_MEM_GEN_ALLOC_CUSTOM_MALLOC      malloc
     #define ESP_UTILS_CONF_MEM_GEN_ALLOC_CUSTOM_FREE        free
 
+#elif ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_POOL
+
+    #define ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_SLAB_SIZE     (4096)  /*!< Bytes requested from `malloc()` per slab */
+    #define ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_CACHE_NUM     (16)    /*!< Free blocks cached per size class and thread */
+
 #endif // ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE
 
+/**
+ * Memory tracing for general memory allocation.
+ *
+ * If enabled, every general allocation is charged to the tag of the calling thread (see
+ * `esp_utils_mem_trace_set_tag()`) and to its call site. This adds a small header to each allocation.
+ */
+#define ESP_UTILS_CONF_MEM_TRACE_ENABLE                     (0)
+#if ESP_UTILS_CONF_MEM_TRACE_ENABLE
+
+    #define ESP_UTILS_CONF_MEM_TRACE_TAG_NUM                (16)    /*!< Maximum number of tags */
+    #define ESP_UTILS_CONF_MEM_TRACE_SITE_NUM               (64)    /*!< Maximum number of allocation sites */
+
+#endif // ESP_UTILS_CONF_MEM_TRACE_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////// Perf Configurations //////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * Performance counters.
+ *
+ * If enabled, libraries publish counters, gauges and histograms (render time, flushed pixels, bus bytes, etc) into a
+ * statically allocated registry, which can be read by `esp_utils_perf_get_snapshot()` or printed as text or CSV by
+ * `esp_utils_perf_print()`.
+ */
+#define ESP_UTILS_CONF_PERF_ENABLE                          (0)
+#if ESP_UTILS_CONF_PERF_ENABLE
+
+    #define ESP_UTILS_CONF_PERF_METRIC_NUM                  (32)    /*!< Maximum number of metrics */
+    #define ESP_UTILS_CONF_PERF_HISTOGRAM_BUCKET_NUM        (8)     /*!< Maximum number of bounded histogram buckets */
+
+#endif // ESP_UTILS_CONF_PERF_ENABLE
+
+/**
+ * Trace event recorder.
+ *
+ * If enabled, libraries record begin/end events of the rendering pipeline (LVGL refresh, flush, bus transfers, touch
+ * reads, etc) into per-task ring buffers, which can be dumped as a Chrome trace JSON file by `esp_utils_trace_dump()`
+ * and opened by Perfetto (https://ui.perfetto.dev).
+ */
+#define ESP_UTILS_CONF_TRACE_ENABLE                         (0)
+#if ESP_UTILS_CONF_TRACE_ENABLE
+
+    #define ESP_UTILS_CONF_TRACE_THREAD_NUM                 (4)     /*!< Maximum number of traced tasks */
+    #define ESP_UTILS_CONF_TRACE_EVENT_NUM                  (512)   /*!< Number of events kept for each task */
+
+#endif // ESP_UTILS_CONF_TRACE_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////// File Version ///////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -93,7 +165,7 @@
  *   3. Even if the patch version is not consistent, it will not affect normal functionality.
  */
 #define ESP_UTILS_CONF_FILE_VERSION_MAJOR 1
-#define ESP_UTILS_CONF_FILE_VERSION_MINOR 1
+#define ESP_UTILS_CONF_FILE_VERSION_MINOR 2
 #define ESP_UTILS_CONF_FILE_VERSION_PATCH 0
 
 // *INDENT-ON*
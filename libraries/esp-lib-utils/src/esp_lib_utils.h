@@ -18,3 +18,9 @@
 
 /* Memory */
 #include "memory/esp_utils_mem.h"
+#include "memory/esp_utils_mem_pool.h"
+#include "memory/esp_utils_mem_trace.h"
+
+/* Perf */
+#include "perf/esp_utils_perf.h"
+#include "perf/esp_utils_trace.h"
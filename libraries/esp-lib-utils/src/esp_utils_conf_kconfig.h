@@ -46,6 +46,56 @@
     #endif
 #endif
 
+#ifndef ESP_UTILS_CONF_LOG_DEFERRED_ENABLE
+    #ifdef CONFIG_ESP_UTILS_CONF_LOG_DEFERRED_ENABLE
+        #define ESP_UTILS_CONF_LOG_DEFERRED_ENABLE   CONFIG_ESP_UTILS_CONF_LOG_DEFERRED_ENABLE
+    #else
+        #define ESP_UTILS_CONF_LOG_DEFERRED_ENABLE   0
+    #endif
+#endif
+
+#if ESP_UTILS_CONF_LOG_DEFERRED_ENABLE
+    #ifndef ESP_UTILS_CONF_LOG_DEFERRED_THREAD_NUM
+        #ifdef CONFIG_ESP_UTILS_CONF_LOG_DEFERRED_THREAD_NUM
+            #define ESP_UTILS_CONF_LOG_DEFERRED_THREAD_NUM    CONFIG_ESP_UTILS_CONF_LOG_DEFERRED_THREAD_NUM
+        #else
+            #define ESP_UTILS_CONF_LOG_DEFERRED_THREAD_NUM    (8)
+        #endif
+    #endif
+
+    #ifndef ESP_UTILS_CONF_LOG_DEFERRED_RECORD_NUM
+        #ifdef CONFIG_ESP_UTILS_CONF_LOG_DEFERRED_RECORD_NUM
+            #define ESP_UTILS_CONF_LOG_DEFERRED_RECORD_NUM    CONFIG_ESP_UTILS_CONF_LOG_DEFERRED_RECORD_NUM
+        #else
+            #define ESP_UTILS_CONF_LOG_DEFERRED_RECORD_NUM    (32)
+        #endif
+    #endif
+
+    #ifndef ESP_UTILS_CONF_LOG_DEFERRED_PAYLOAD_SIZE
+        #ifdef CONFIG_ESP_UTILS_CONF_LOG_DEFERRED_PAYLOAD_SIZE
+            #define ESP_UTILS_CONF_LOG_DEFERRED_PAYLOAD_SIZE  CONFIG_ESP_UTILS_CONF_LOG_DEFERRED_PAYLOAD_SIZE
+        #else
+            #define ESP_UTILS_CONF_LOG_DEFERRED_PAYLOAD_SIZE  (64)
+        #endif
+    #endif
+
+    #ifndef ESP_UTILS_CONF_LOG_DEFERRED_DRAIN_INTERVAL_MS
+        #ifdef CONFIG_ESP_UTILS_CONF_LOG_DEFERRED_DRAIN_INTERVAL_MS
+            #define ESP_UTILS_CONF_LOG_DEFERRED_DRAIN_INTERVAL_MS  CONFIG_ESP_UTILS_CONF_LOG_DEFERRED_DRAIN_INTERVAL_MS
+        #else
+            #define ESP_UTILS_CONF_LOG_DEFERRED_DRAIN_INTERVAL_MS  (100)
+        #endif
+    #endif
+
+    #ifndef ESP_UTILS_CONF_LOG_DEFERRED_DRAIN_TASK_PRIORITY
+        #ifdef CONFIG_ESP_UTILS_CONF_LOG_DEFERRED_DRAIN_TASK_PRIORITY
+            #define ESP_UTILS_CONF_LOG_DEFERRED_DRAIN_TASK_PRIORITY  CONFIG_ESP_UTILS_CONF_LOG_DEFERRED_DRAIN_TASK_PRIORITY
+        #else
+            #define ESP_UTILS_CONF_LOG_DEFERRED_DRAIN_TASK_PRIORITY  (1)
+        #endif
+    #endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////// Memory Configurations /////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -79,6 +129,22 @@
         #error "`ESP_UTILS_CONF_MEM_GEN_ALLOC_ESP_CAPS` must be defined when `ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE` is \
                 set to `ESP_UTILS_MEM_ALLOC_TYPE_ESP`"
     #endif
+#elif ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_POOL
+    #ifndef ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_SLAB_SIZE
+        #ifdef CONFIG_ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_SLAB_SIZE
+            #define ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_SLAB_SIZE  CONFIG_ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_SLAB_SIZE
+        #else
+            #define ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_SLAB_SIZE  (4096)
+        #endif
+    #endif
+
+    #ifndef ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_CACHE_NUM
+        #ifdef CONFIG_ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_CACHE_NUM
+            #define ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_CACHE_NUM  CONFIG_ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_CACHE_NUM
+        #else
+            #define ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_CACHE_NUM  (16)
+        #endif
+    #endif
 #elif ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_CUSTOM
     #ifndef ESP_UTILS_CONF_MEM_GEN_ALLOC_CUSTOM_INCLUDE
         #ifdef CONFIG_ESP_UTILS_CONF_MEM_GEN_ALLOC_CUSTOM_INCLUDE
@@ -100,4 +166,85 @@
     #endif
 #endif
 
+#ifndef ESP_UTILS_CONF_MEM_TRACE_ENABLE
+    #ifdef CONFIG_ESP_UTILS_CONF_MEM_TRACE_ENABLE
+        #define ESP_UTILS_CONF_MEM_TRACE_ENABLE  CONFIG_ESP_UTILS_CONF_MEM_TRACE_ENABLE
+    #else
+        #define ESP_UTILS_CONF_MEM_TRACE_ENABLE  (0)
+    #endif
+#endif
+
+#if ESP_UTILS_CONF_MEM_TRACE_ENABLE
+    #ifndef ESP_UTILS_CONF_MEM_TRACE_TAG_NUM
+        #ifdef CONFIG_ESP_UTILS_CONF_MEM_TRACE_TAG_NUM
+            #define ESP_UTILS_CONF_MEM_TRACE_TAG_NUM  CONFIG_ESP_UTILS_CONF_MEM_TRACE_TAG_NUM
+        #else
+            #define ESP_UTILS_CONF_MEM_TRACE_TAG_NUM  (16)
+        #endif
+    #endif
+
+    #ifndef ESP_UTILS_CONF_MEM_TRACE_SITE_NUM
+        #ifdef CONFIG_ESP_UTILS_CONF_MEM_TRACE_SITE_NUM
+            #define ESP_UTILS_CONF_MEM_TRACE_SITE_NUM  CONFIG_ESP_UTILS_CONF_MEM_TRACE_SITE_NUM
+        #else
+            #define ESP_UTILS_CONF_MEM_TRACE_SITE_NUM  (64)
+        #endif
+    #endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////// Perf Configurations //////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef ESP_UTILS_CONF_PERF_ENABLE
+    #ifdef CONFIG_ESP_UTILS_CONF_PERF_ENABLE
+        #define ESP_UTILS_CONF_PERF_ENABLE  CONFIG_ESP_UTILS_CONF_PERF_ENABLE
+    #else
+        #define ESP_UTILS_CONF_PERF_ENABLE  (0)
+    #endif
+#endif
+
+#if ESP_UTILS_CONF_PERF_ENABLE
+    #ifndef ESP_UTILS_CONF_PERF_METRIC_NUM
+        #ifdef CONFIG_ESP_UTILS_CONF_PERF_METRIC_NUM
+            #define ESP_UTILS_CONF_PERF_METRIC_NUM  CONFIG_ESP_UTILS_CONF_PERF_METRIC_NUM
+        #else
+            #define ESP_UTILS_CONF_PERF_METRIC_NUM  (32)
+        #endif
+    #endif
+
+    #ifndef ESP_UTILS_CONF_PERF_HISTOGRAM_BUCKET_NUM
+        #ifdef CONFIG_ESP_UTILS_CONF_PERF_HISTOGRAM_BUCKET_NUM
+            #define ESP_UTILS_CONF_PERF_HISTOGRAM_BUCKET_NUM  CONFIG_ESP_UTILS_CONF_PERF_HISTOGRAM_BUCKET_NUM
+        #else
+            #define ESP_UTILS_CONF_PERF_HISTOGRAM_BUCKET_NUM  (8)
+        #endif
+    #endif
+#endif
+
+#ifndef ESP_UTILS_CONF_TRACE_ENABLE
+    #ifdef CONFIG_ESP_UTILS_CONF_TRACE_ENABLE
+        #define ESP_UTILS_CONF_TRACE_ENABLE  CONFIG_ESP_UTILS_CONF_TRACE_ENABLE
+    #else
+        #define ESP_UTILS_CONF_TRACE_ENABLE  (0)
+    #endif
+#endif
+
+#if ESP_UTILS_CONF_TRACE_ENABLE
+    #ifndef ESP_UTILS_CONF_TRACE_THREAD_NUM
+        #ifdef CONFIG_ESP_UTILS_CONF_TRACE_THREAD_NUM
+            #define ESP_UTILS_CONF_TRACE_THREAD_NUM  CONFIG_ESP_UTILS_CONF_TRACE_THREAD_NUM
+        #else
+            #define ESP_UTILS_CONF_TRACE_THREAD_NUM  (4)
+        #endif
+    #endif
+
+    #ifndef ESP_UTILS_CONF_TRACE_EVENT_NUM
+        #ifdef CONFIG_ESP_UTILS_CONF_TRACE_EVENT_NUM
+            #define ESP_UTILS_CONF_TRACE_EVENT_NUM  CONFIG_ESP_UTILS_CONF_TRACE_EVENT_NUM
+        #else
+            #define ESP_UTILS_CONF_TRACE_EVENT_NUM  (512)
+        #endif
+    #endif
+#endif
+
 // *INDENT-ON*
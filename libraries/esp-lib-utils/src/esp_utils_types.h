@@ -32,3 +32,4 @@
 #define ESP_UTILS_MEM_ALLOC_TYPE_ESP           (1)
 #define ESP_UTILS_MEM_ALLOC_TYPE_MICROPYTHON   (2)
 #define ESP_UTILS_MEM_ALLOC_TYPE_CUSTOM        (3)
+#define ESP_UTILS_MEM_ALLOC_TYPE_POOL          (4)
@@ -18,6 +18,9 @@
 #include <cstring>
 #include <functional>
 #include <mutex>
+#if ESP_UTILS_CONF_LOG_DEFERRED_ENABLE
+#include "esp_utils_log_deferred.h"
+#endif
 
 extern "C" const char *esp_utils_log_extract_file_name(const char *file_path);
 
@@ -36,6 +39,17 @@ public:
     }
 
     // Templates and conditional compilation: Filter logs by different levels
+#if ESP_UTILS_CONF_LOG_DEFERRED_ENABLE
+    template <int level, typename... Args>
+    void print(const char *file, int line, const char *func, const char *format, Args... args)
+    {
+        // Logs below the global level will not be compiled
+        if constexpr (level >= ESP_UTILS_CONF_LOG_LEVEL) {
+            // Only record the raw arguments, they will be formatted and printed by `LogDeferred::flush()`
+            LogDeferred::getInstance().record(level, ESP_UTILS_LOG_TAG, file, line, func, format, args...);
+        }
+    }
+#else
     template <int level>
     void print(const char *file, int line, const char *func, const char *format, ...)
     {
@@ -55,6 +69,7 @@ public:
             );
         }
     }
+#endif // ESP_UTILS_CONF_LOG_DEFERRED_ENABLE
 
 private:
     Log() = default;
@@ -72,8 +87,10 @@ private:
         return ' ';
     }
 
+#if !ESP_UTILS_CONF_LOG_DEFERRED_ENABLE
     char _buffer[ESP_UTILS_CONF_LOG_BUFFER_SIZE];
     std::mutex _mutex;
+#endif
 };
 
 } // namespace esp_utils
@@ -0,0 +1,377 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#if defined(ESP_PLATFORM)
+#include "esp_pthread.h"
+#endif
+#include "esp_utils_conf_internal.h"
+
+extern "C" const char *esp_utils_log_extract_file_name(const char *file_path);
+
+namespace esp_utils {
+
+/**
+ * Deferred log backend.
+ *
+ * Instead of formatting and printing on the calling task, each log call only stores the format pointer, a timestamp
+ * and the raw arguments into a lock-free single-producer/single-consumer ring owned by the calling thread. Records are
+ * formatted and printed later by `flush()`, which is either called manually or periodically by the drain task.
+ *
+ * Notes:
+ *  - `%s` arguments are copied into the record, all other arguments are copied by value
+ *  - When the record payload is too small for the arguments, the message is formatted on the caller side instead
+ *    (truncated to the payload size)
+ *  - When the ring of the calling thread is full, the record is dropped and counted
+ *  - Rings are statically allocated, when no ring is left for the calling thread the message is printed synchronously
+ */
+class LogDeferred {
+public:
+    using FormatFunc = int (*)(char *buffer, size_t size, const char *format, const uint8_t *payload);
+
+    struct Record {
+        int64_t timestamp_us;
+        const char *tag;
+        const char *file;
+        const char *func;
+        const char *format;
+        FormatFunc formatter;       /*!< `nullptr` means the payload is a pre-formatted string */
+        uint16_t line;
+        uint8_t level;
+        uint8_t payload[ESP_UTILS_CONF_LOG_DEFERRED_PAYLOAD_SIZE];
+    };
+
+    // Singleton pattern: Get the unique instance of the class
+    static LogDeferred &getInstance()
+    {
+        static LogDeferred instance;
+        return instance;
+    }
+
+    template <typename... Args>
+    void record(
+        int level, const char *tag, const char *file, int line, const char *func, const char *format, Args... args
+    )
+    {
+        Ring *ring = getThreadRing();
+        if (ring == nullptr) {
+            printDirect(level, tag, file, line, func, format, args...);
+            return;
+        }
+
+        uint32_t head = ring->head.load(std::memory_order_relaxed);
+        if ((head - ring->tail.load(std::memory_order_acquire)) >= ESP_UTILS_CONF_LOG_DEFERRED_RECORD_NUM) {
+            ring->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        Record &rec = ring->records[head % ESP_UTILS_CONF_LOG_DEFERRED_RECORD_NUM];
+        rec.timestamp_us = getTimestampUs();
+        rec.tag = tag;
+        rec.file = file;
+        rec.func = func;
+        rec.format = format;
+        rec.line = static_cast<uint16_t>(line);
+        rec.level = static_cast<uint8_t>(level);
+        if (pack(rec.payload, args...)) {
+            rec.formatter = &formatPayload<Args...>;
+        } else {
+            // Arguments do not fit, fall back to formatting on the caller side
+            formatText(reinterpret_cast<char *>(rec.payload), sizeof(rec.payload), format, args...);
+            rec.formatter = nullptr;
+        }
+        ring->head.store(head + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Format and print all pending records of all threads in timestamp order
+     *
+     * @return Number of printed records
+     */
+    size_t flush()
+    {
+        std::lock_guard<std::mutex> lock(_drain_mutex);
+
+        size_t count = 0;
+        while (true) {
+            // Merge the rings by picking the oldest pending record each time
+            Ring *oldest = nullptr;
+            for (auto &ring : _rings) {
+                if (ring.tail.load(std::memory_order_relaxed) == ring.head.load(std::memory_order_acquire)) {
+                    continue;
+                }
+                if ((oldest == nullptr) || (frontOf(&ring).timestamp_us < frontOf(oldest).timestamp_us)) {
+                    oldest = &ring;
+                }
+            }
+            if (oldest == nullptr) {
+                break;
+            }
+
+            const Record &rec = frontOf(oldest);
+            const char *message = reinterpret_cast<const char *>(rec.payload);
+            if (rec.formatter != nullptr) {
+                rec.formatter(_buffer, sizeof(_buffer), rec.format, rec.payload);
+                message = _buffer;
+            }
+            printf(
+                "[%c][%s][%lld][%s:%04d](%s): %s\n", logLevelToChar(rec.level), rec.tag,
+                static_cast<long long>(rec.timestamp_us), esp_utils_log_extract_file_name(rec.file), rec.line, rec.func,
+                message
+            );
+            oldest->tail.fetch_add(1, std::memory_order_release);
+            count++;
+        }
+
+        for (auto &ring : _rings) {
+            uint32_t dropped = ring.dropped.exchange(0, std::memory_order_relaxed);
+            if (dropped > 0) {
+                printf("[W][Utils] Deferred log dropped %d records\n", static_cast<int>(dropped));
+            }
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Start a low priority task which calls `flush()` periodically
+     *
+     * @param[in] interval_ms Interval between two flushes
+     *
+     * @return `true` if the task is running, `false` otherwise
+     */
+    bool startDrainTask(uint32_t interval_ms = ESP_UTILS_CONF_LOG_DEFERRED_DRAIN_INTERVAL_MS)
+    {
+        std::lock_guard<std::mutex> lock(_task_mutex);
+
+        if (_drain_thread.joinable()) {
+            return true;
+        }
+
+#if defined(ESP_PLATFORM)
+        esp_pthread_cfg_t old_cfg = {};
+        bool has_old_cfg = (esp_pthread_get_cfg(&old_cfg) == ESP_OK);
+        esp_pthread_cfg_t cfg = esp_pthread_get_default_config();
+        cfg.prio = ESP_UTILS_CONF_LOG_DEFERRED_DRAIN_TASK_PRIORITY;
+        cfg.thread_name = "log_drain";
+        esp_pthread_set_cfg(&cfg);
+#endif
+        _drain_running = true;
+        _drain_thread = std::thread([this, interval_ms]() {
+            while (_drain_running.load()) {
+                flush();
+                std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+            }
+            flush();
+        });
+#if defined(ESP_PLATFORM)
+        if (has_old_cfg) {
+            esp_pthread_set_cfg(&old_cfg);
+        }
+#endif
+
+        return true;
+    }
+
+    /**
+     * @brief Stop the drain task, pending records are flushed before it exits
+     */
+    void stopDrainTask()
+    {
+        std::lock_guard<std::mutex> lock(_task_mutex);
+
+        if (!_drain_thread.joinable()) {
+            return;
+        }
+        _drain_running = false;
+        _drain_thread.join();
+    }
+
+private:
+    struct Ring {
+        Record records[ESP_UTILS_CONF_LOG_DEFERRED_RECORD_NUM];
+        std::atomic<uint32_t> head{0};
+        std::atomic<uint32_t> tail{0};
+        std::atomic<uint32_t> dropped{0};
+        std::atomic<bool> in_use{false};
+    };
+
+    // Release the ring when the owner thread exits, so it can be reused by another thread
+    struct RingOwner {
+        Ring *ring = nullptr;
+        ~RingOwner()
+        {
+            if (ring != nullptr) {
+                ring->in_use.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    LogDeferred() = default;
+
+    ~LogDeferred()
+    {
+        stopDrainTask();
+    }
+
+    Ring *getThreadRing()
+    {
+        static thread_local RingOwner owner;
+        if (owner.ring != nullptr) {
+            return owner.ring;
+        }
+
+        // Rings are statically allocated to keep the backend free of heap allocations
+        for (auto &ring : _rings) {
+            bool expected = false;
+            if (ring.in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                owner.ring = &ring;
+                return &ring;
+            }
+        }
+
+        return nullptr;
+    }
+
+    static const Record &frontOf(Ring *ring)
+    {
+        return ring->records[ring->tail.load(std::memory_order_relaxed) % ESP_UTILS_CONF_LOG_DEFERRED_RECORD_NUM];
+    }
+
+    static int64_t getTimestampUs()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch()
+               ).count();
+    }
+
+    template <typename T>
+    static constexpr bool isString()
+    {
+        using D = std::decay_t<T>;
+        return std::is_same_v<D, const char *> || std::is_same_v<D, char *>;
+    }
+
+    // Type which is written into the payload for an argument of type `T`
+    template <typename T>
+    using Stored = std::conditional_t<isString<T>(), const char *, std::decay_t<T>>;
+
+    template <typename... Args>
+    static bool pack(uint8_t *payload, Args... args)
+    {
+        size_t offset = 0;
+        (void)payload;
+        (void)offset;
+        return (packOne(payload, offset, args) && ...);
+    }
+
+    template <typename T>
+    static bool packOne(uint8_t *payload, size_t &offset, T arg)
+    {
+        if constexpr (isString<T>()) {
+            const char *str = (arg == nullptr) ? "(null)" : arg;
+            size_t len = strlen(str) + 1;
+            if ((offset + len) > ESP_UTILS_CONF_LOG_DEFERRED_PAYLOAD_SIZE) {
+                return false;
+            }
+            memcpy(payload + offset, str, len);
+            offset += len;
+        } else {
+            static_assert(
+                std::is_trivially_copyable_v<std::decay_t<T>>, "Deferred log only supports trivially copyable arguments"
+            );
+            if ((offset + sizeof(T)) > ESP_UTILS_CONF_LOG_DEFERRED_PAYLOAD_SIZE) {
+                return false;
+            }
+            memcpy(payload + offset, &arg, sizeof(T));
+            offset += sizeof(T);
+        }
+        return true;
+    }
+
+    template <typename T>
+    static Stored<T> unpackOne(const uint8_t *payload, size_t &offset)
+    {
+        if constexpr (isString<T>()) {
+            const char *str = reinterpret_cast<const char *>(payload + offset);
+            offset += strlen(str) + 1;
+            return str;
+        } else {
+            std::decay_t<T> value;
+            memcpy(&value, payload + offset, sizeof(value));
+            offset += sizeof(value);
+            return value;
+        }
+    }
+
+    template <typename... Args>
+    static int formatPayload(char *buffer, size_t size, const char *format, const uint8_t *payload)
+    {
+        size_t offset = 0;
+        // Braced initialization guarantees the arguments are unpacked from left to right
+        std::tuple<Stored<Args>...> values{unpackOne<Args>(payload, offset)...};
+        (void)payload;
+        (void)offset;
+        return std::apply([&](auto... unpacked) {
+            return formatText(buffer, size, format, unpacked...);
+        }, values);
+    }
+
+    template <typename... Args>
+    static int formatText(char *buffer, size_t size, const char *format, Args... args)
+    {
+        if constexpr (sizeof...(Args) == 0) {
+            return snprintf(buffer, size, "%s", format);
+        } else {
+            return snprintf(buffer, size, format, args...);
+        }
+    }
+
+    template <typename... Args>
+    void printDirect(
+        int level, const char *tag, const char *file, int line, const char *func, const char *format, Args... args
+    )
+    {
+        std::lock_guard<std::mutex> lock(_direct_mutex);
+        formatText(_direct_buffer, sizeof(_direct_buffer), format, args...);
+        printf(
+            "[%c][%s][%s:%04d](%s): %s\n", logLevelToChar(level), tag,
+            esp_utils_log_extract_file_name(file), line, func, _direct_buffer
+        );
+    }
+
+    static constexpr char logLevelToChar(int level)
+    {
+        switch (level) {
+        case ESP_UTILS_LOG_LEVEL_DEBUG:   return 'D';
+        case ESP_UTILS_LOG_LEVEL_INFO:    return 'I';
+        case ESP_UTILS_LOG_LEVEL_WARNING: return 'W';
+        case ESP_UTILS_LOG_LEVEL_ERROR:   return 'E';
+        default: break;
+        }
+        return ' ';
+    }
+
+    Ring _rings[ESP_UTILS_CONF_LOG_DEFERRED_THREAD_NUM];
+    std::mutex _drain_mutex;
+    char _buffer[ESP_UTILS_CONF_LOG_BUFFER_SIZE];
+    std::mutex _direct_mutex;
+    char _direct_buffer[ESP_UTILS_CONF_LOG_BUFFER_SIZE];
+    std::mutex _task_mutex;
+    std::thread _drain_thread;
+    std::atomic<bool> _drain_running{false};
+};
+
+} // namespace esp_utils
@@ -5,6 +5,7 @@
  */
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include "esp_heap_caps.h"
 #include "esp_utils_conf_internal.h"
@@ -18,7 +19,10 @@
 #include <py/mpconfig.h>
 #include <py/misc.h>
 #include <py/gc.h>
+#elif ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_POOL
+#include "esp_utils_mem_pool.h"
 #endif // ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE
+#include "esp_utils_mem_trace.h"
 
 #define PRINT_INFO_BUFFER_SIZE  256
 
@@ -34,48 +38,34 @@ bool esp_utils_mem_check_alloc_enabled(void)
     return is_alloc_enabled;
 }
 
-void *esp_utils_mem_gen_malloc(size_t size)
+static void *mem_malloc(size_t size)
 {
-    ESP_UTILS_LOG_TRACE_ENTER();
-
-    void *p = NULL;
-
     if (!is_alloc_enabled) {
-        p = malloc(size);
-        goto end;
+        return malloc(size);
     }
 
 #if ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_STDLIB
-    p = malloc(size);
+    return malloc(size);
 #elif ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_ESP
-    p = heap_caps_aligned_alloc(ESP_UTILS_CONF_MEM_GEN_ALLOC_ESP_ALIGN, size, ESP_UTILS_CONF_MEM_GEN_ALLOC_ESP_CAPS);
+    return heap_caps_aligned_alloc(ESP_UTILS_CONF_MEM_GEN_ALLOC_ESP_ALIGN, size, ESP_UTILS_CONF_MEM_GEN_ALLOC_ESP_CAPS);
 #elif ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_CUSTOM
-    p = ESP_UTILS_CONF_MEM_GEN_ALLOC_CUSTOM_MALLOC(size);
+    return ESP_UTILS_CONF_MEM_GEN_ALLOC_CUSTOM_MALLOC(size);
 #elif ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_MICROPYTHON
 #if MICROPY_MALLOC_USES_ALLOCATED_SIZE
-    p = gc_alloc(size, true);
+    return gc_alloc(size, true);
 #else
-    p = m_malloc(size);
+    return m_malloc(size);
 #endif // MICROPY_MALLOC_USES_ALLOCATED_SIZE
+#elif ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_POOL
+    return esp_utils_mem_pool_malloc(size);
 #endif // ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE
-
-end:
-    ESP_UTILS_LOGD("Malloc @%p: %d", p, (int)size);
-
-    ESP_UTILS_LOG_TRACE_EXIT();
-
-    return p;
 }
 
-void esp_utils_mem_gen_free(void *p)
+static void mem_free(void *p)
 {
-    ESP_UTILS_LOG_TRACE_ENTER();
-
-    ESP_UTILS_LOGD("Free @%p", p);
-
     if (!is_alloc_enabled) {
         free(p);
-        goto end;
+        return;
     }
 
 #if ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_STDLIB
@@ -90,9 +80,51 @@ void esp_utils_mem_gen_free(void *p)
 #else
     m_free(p);
 #endif // MICROPY_MALLOC_USES_ALLOCATED_SIZE
+#elif ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_POOL
+    esp_utils_mem_pool_free(p);
 #endif // ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE
+}
+
+static void *mem_gen_malloc(size_t size, const void *site)
+{
+#if ESP_UTILS_CONF_MEM_TRACE_ENABLE
+    // Prepend the trace header, which is charged to the tag of the calling thread and to `site`
+    size_t header_size = esp_utils_mem_trace_get_header_size();
+    if (size > (SIZE_MAX - header_size)) {
+        return NULL;
+    }
+    void *raw = mem_malloc(header_size + size);
+    return (raw == NULL) ? NULL : esp_utils_mem_trace_on_alloc(raw, size, site);
+#else
+    (void)site;
+    return mem_malloc(size);
+#endif // ESP_UTILS_CONF_MEM_TRACE_ENABLE
+}
+
+void *esp_utils_mem_gen_malloc(size_t size)
+{
+    ESP_UTILS_LOG_TRACE_ENTER();
+
+    void *p = mem_gen_malloc(size, __builtin_return_address(0));
+
+    ESP_UTILS_LOGD("Malloc @%p: %d", p, (int)size);
+
+    ESP_UTILS_LOG_TRACE_EXIT();
+
+    return p;
+}
+
+void esp_utils_mem_gen_free(void *p)
+{
+    ESP_UTILS_LOG_TRACE_ENTER();
+
+    ESP_UTILS_LOGD("Free @%p", p);
+
+#if ESP_UTILS_CONF_MEM_TRACE_ENABLE
+    p = esp_utils_mem_trace_on_free(p);
+#endif // ESP_UTILS_CONF_MEM_TRACE_ENABLE
+    mem_free(p);
 
-end:
     ESP_UTILS_LOG_TRACE_EXIT();
 }
 
@@ -101,7 +133,7 @@ void *esp_utils_mem_gen_calloc(size_t n, size_t size)
     ESP_UTILS_LOG_TRACE_ENTER();
 
     size_t total_size = (size_t)n * size;
-    void *p = esp_utils_mem_gen_malloc(total_size);
+    void *p = mem_gen_malloc(total_size, __builtin_return_address(0));
     if (p != NULL) {
         memset(p, 0, total_size);
     }
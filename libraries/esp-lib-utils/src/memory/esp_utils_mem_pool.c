@@ -0,0 +1,298 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "esp_utils_conf_internal.h"
+#if ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_POOL
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "check/esp_utils_check.h"
+#include "log/esp_utils_log.h"
+#include "esp_utils_mem_pool.h"
+
+#define POOL_CLASS_NUM      (6)         /* 16, 32, 64, 128, 256, 512 */
+#define POOL_CLASS_LARGE    (0xFF)      /* Forwarded to `malloc()` */
+#define POOL_CACHE_REFILL   ((ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_CACHE_NUM + 1) / 2)
+
+typedef struct pool_slab_t {
+    struct pool_slab_t *next;
+    uint32_t used;                      /* Blocks which are not in the global free list */
+} pool_slab_t;
+
+typedef struct {
+    pool_slab_t *slab;                  /* `NULL` for large blocks */
+    uint32_t class_id;
+} pool_header_t;
+
+typedef struct pool_free_t {
+    struct pool_free_t *next;
+} pool_free_t;
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pool_free_t *free_list;
+    pool_slab_t *slab_list;
+} pool_class_t;
+
+typedef struct {
+    pool_free_t *free_list[POOL_CLASS_NUM];
+    uint32_t free_num[POOL_CLASS_NUM];
+} pool_cache_t;
+
+static pool_class_t pool_classes[POOL_CLASS_NUM] = {
+    [0 ... POOL_CLASS_NUM - 1] = { .mutex = PTHREAD_MUTEX_INITIALIZER },
+};
+static pthread_once_t cache_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t cache_key;             /* Only used to flush the cache when the thread exits */
+static __thread pool_cache_t *thread_cache;
+
+static inline size_t class_block_size(int class_id)
+{
+    return (size_t)ESP_UTILS_MEM_POOL_MIN_BLOCK_SIZE << class_id;
+}
+
+static inline int size_to_class(size_t size)
+{
+    int class_id = 0;
+    while (class_block_size(class_id) < size) {
+        class_id++;
+    }
+    return class_id;
+}
+
+static inline pool_header_t *block_to_header(void *p)
+{
+    return (pool_header_t *)p - 1;
+}
+
+static inline void *header_to_block(pool_header_t *header)
+{
+    return header + 1;
+}
+
+/* Must be called with the class mutex held */
+static bool class_add_slab(int class_id)
+{
+    size_t stride = sizeof(pool_header_t) + class_block_size(class_id);
+    size_t block_num = (ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_SLAB_SIZE - sizeof(pool_slab_t)) / stride;
+    if (block_num == 0) {
+        block_num = 1;
+    }
+
+    pool_slab_t *slab = (pool_slab_t *)malloc(sizeof(pool_slab_t) + block_num * stride);
+    ESP_UTILS_CHECK_NULL_RETURN(slab, false, "Allocate slab failed");
+
+    pool_class_t *pool_class = &pool_classes[class_id];
+    slab->used = 0;
+    slab->next = pool_class->slab_list;
+    pool_class->slab_list = slab;
+
+    uint8_t *cursor = (uint8_t *)(slab + 1);
+    for (size_t i = 0; i < block_num; i++, cursor += stride) {
+        pool_header_t *header = (pool_header_t *)cursor;
+        header->slab = slab;
+        header->class_id = class_id;
+        pool_free_t *node = (pool_free_t *)header_to_block(header);
+        node->next = pool_class->free_list;
+        pool_class->free_list = node;
+    }
+
+    return true;
+}
+
+/* Move up to `num` blocks from the global list into the cache */
+static void class_take(int class_id, pool_cache_t *cache, uint32_t num)
+{
+    pool_class_t *pool_class = &pool_classes[class_id];
+
+    pthread_mutex_lock(&pool_class->mutex);
+    if ((pool_class->free_list == NULL) && !class_add_slab(class_id)) {
+        goto end;
+    }
+    while ((num-- > 0) && (pool_class->free_list != NULL)) {
+        pool_free_t *node = pool_class->free_list;
+        pool_class->free_list = node->next;
+        block_to_header(node)->slab->used++;
+        node->next = cache->free_list[class_id];
+        cache->free_list[class_id] = node;
+        cache->free_num[class_id]++;
+    }
+
+end:
+    pthread_mutex_unlock(&pool_class->mutex);
+}
+
+/* Move up to `num` blocks from the cache back to the global list */
+static void class_give(int class_id, pool_cache_t *cache, uint32_t num)
+{
+    pool_class_t *pool_class = &pool_classes[class_id];
+
+    pthread_mutex_lock(&pool_class->mutex);
+    while ((num-- > 0) && (cache->free_list[class_id] != NULL)) {
+        pool_free_t *node = cache->free_list[class_id];
+        cache->free_list[class_id] = node->next;
+        cache->free_num[class_id]--;
+        block_to_header(node)->slab->used--;
+        node->next = pool_class->free_list;
+        pool_class->free_list = node;
+    }
+    pthread_mutex_unlock(&pool_class->mutex);
+}
+
+static void cache_flush(pool_cache_t *cache)
+{
+    for (int i = 0; i < POOL_CLASS_NUM; i++) {
+        class_give(i, cache, cache->free_num[i]);
+    }
+}
+
+static void cache_destroy(void *arg)
+{
+    pool_cache_t *cache = (pool_cache_t *)arg;
+    thread_cache = NULL;
+    cache_flush(cache);
+    free(cache);
+}
+
+static void cache_key_create(void)
+{
+    pthread_key_create(&cache_key, cache_destroy);
+}
+
+static pool_cache_t *get_thread_cache(bool create)
+{
+    if ((thread_cache != NULL) || !create) {
+        return thread_cache;
+    }
+
+    pthread_once(&cache_key_once, cache_key_create);
+    pool_cache_t *cache = (pool_cache_t *)calloc(1, sizeof(pool_cache_t));
+    ESP_UTILS_CHECK_NULL_RETURN(cache, NULL, "Allocate thread cache failed");
+    if (pthread_setspecific(cache_key, cache) != 0) {
+        free(cache);
+        return NULL;
+    }
+    thread_cache = cache;
+
+    return cache;
+}
+
+static void *large_malloc(size_t size)
+{
+    pool_header_t *header = (pool_header_t *)malloc(sizeof(pool_header_t) + size);
+    if (header == NULL) {
+        return NULL;
+    }
+    header->slab = NULL;
+    header->class_id = POOL_CLASS_LARGE;
+
+    return header_to_block(header);
+}
+
+void *esp_utils_mem_pool_malloc(size_t size)
+{
+    if (size > ESP_UTILS_MEM_POOL_MAX_BLOCK_SIZE) {
+        return large_malloc(size);
+    }
+
+    // Without a thread cache or a new slab, the block is taken from the heap like a large one
+    pool_cache_t *cache = get_thread_cache(true);
+    if (cache == NULL) {
+        return large_malloc(size);
+    }
+
+    int class_id = size_to_class(size);
+    if (cache->free_list[class_id] == NULL) {
+        class_take(class_id, cache, POOL_CACHE_REFILL);
+        if (cache->free_list[class_id] == NULL) {
+            return large_malloc(size);
+        }
+    }
+
+    pool_free_t *node = cache->free_list[class_id];
+    cache->free_list[class_id] = node->next;
+    cache->free_num[class_id]--;
+
+    return node;
+}
+
+void esp_utils_mem_pool_free(void *p)
+{
+    if (p == NULL) {
+        return;
+    }
+
+    pool_header_t *header = block_to_header(p);
+    if (header->class_id == POOL_CLASS_LARGE) {
+        free(header);
+        return;
+    }
+
+    int class_id = header->class_id;
+    pool_cache_t *cache = get_thread_cache(true);
+    if (cache == NULL) {
+        // No cache for this thread, return the block to the global list directly
+        pool_cache_t tmp_cache = { 0 };
+        tmp_cache.free_list[class_id] = (pool_free_t *)p;
+        tmp_cache.free_list[class_id]->next = NULL;
+        tmp_cache.free_num[class_id] = 1;
+        class_give(class_id, &tmp_cache, 1);
+        return;
+    }
+
+    pool_free_t *node = (pool_free_t *)p;
+    node->next = cache->free_list[class_id];
+    cache->free_list[class_id] = node;
+    cache->free_num[class_id]++;
+    if (cache->free_num[class_id] > ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_CACHE_NUM) {
+        class_give(class_id, cache, POOL_CACHE_REFILL);
+    }
+}
+
+size_t esp_utils_mem_pool_trim(void)
+{
+    ESP_UTILS_LOG_TRACE_ENTER();
+
+    pool_cache_t *cache = get_thread_cache(false);
+    if (cache != NULL) {
+        cache_flush(cache);
+    }
+
+    size_t released = 0;
+    for (int i = 0; i < POOL_CLASS_NUM; i++) {
+        pool_class_t *pool_class = &pool_classes[i];
+
+        pthread_mutex_lock(&pool_class->mutex);
+        // Drop the blocks of empty slabs from the free list, then release the slabs
+        pool_free_t **link = &pool_class->free_list;
+        while (*link != NULL) {
+            if (block_to_header(*link)->slab->used == 0) {
+                *link = (*link)->next;
+            } else {
+                link = &(*link)->next;
+            }
+        }
+        pool_slab_t **slab_link = &pool_class->slab_list;
+        while (*slab_link != NULL) {
+            pool_slab_t *slab = *slab_link;
+            if (slab->used == 0) {
+                *slab_link = slab->next;
+                free(slab);
+                released++;
+            } else {
+                slab_link = &slab->next;
+            }
+        }
+        pthread_mutex_unlock(&pool_class->mutex);
+    }
+
+    ESP_UTILS_LOGD("Released %d slabs", (int)released);
+
+    ESP_UTILS_LOG_TRACE_EXIT();
+
+    return released;
+}
+
+#endif // ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE
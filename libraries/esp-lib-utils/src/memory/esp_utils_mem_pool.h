@@ -0,0 +1,43 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_utils_conf_internal.h"
+
+#if ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_POOL
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Segregated-fit pool allocator used when `ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE` is set to
+ *        `ESP_UTILS_MEM_ALLOC_TYPE_POOL`.
+ *
+ * Requests up to `ESP_UTILS_MEM_POOL_MAX_BLOCK_SIZE` bytes are served from per-size-class free lists, which are
+ * refilled from slabs of `ESP_UTILS_CONF_MEM_GEN_ALLOC_POOL_SLAB_SIZE` bytes. Each thread keeps a small cache of free
+ * blocks per class, so the common allocate/free path takes no lock. Larger requests are forwarded to `malloc()`.
+ */
+#define ESP_UTILS_MEM_POOL_MIN_BLOCK_SIZE   (16)
+#define ESP_UTILS_MEM_POOL_MAX_BLOCK_SIZE   (512)
+
+void *esp_utils_mem_pool_malloc(size_t size);
+void esp_utils_mem_pool_free(void *p);
+
+/**
+ * @brief Return the blocks cached by the calling thread and release all the slabs without live blocks
+ *
+ * @return Number of released slabs
+ */
+size_t esp_utils_mem_pool_trim(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE
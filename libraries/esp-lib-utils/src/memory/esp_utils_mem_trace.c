@@ -0,0 +1,246 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "esp_utils_conf_internal.h"
+#if ESP_UTILS_CONF_MEM_TRACE_ENABLE
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "check/esp_utils_check.h"
+#include "log/esp_utils_log.h"
+#include "esp_utils_mem_trace.h"
+
+#define TRACE_TAG_DEFAULT       (0)
+#define TRACE_TAG_OTHERS        (ESP_UTILS_CONF_MEM_TRACE_TAG_NUM - 1)      /* Used when the tag table is full */
+#define TRACE_SITE_OTHERS       (ESP_UTILS_CONF_MEM_TRACE_SITE_NUM - 1)     /* Used when the site table is full */
+#define TRACE_SITE_HASH_NUM     (ESP_UTILS_CONF_MEM_TRACE_SITE_NUM - 1)
+
+#if ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_ESP
+#define TRACE_ALIGN_RAW         (ESP_UTILS_CONF_MEM_GEN_ALLOC_ESP_ALIGN)
+#else
+#define TRACE_ALIGN_RAW         (1)
+#endif
+#define TRACE_ALIGN             ((TRACE_ALIGN_RAW > _Alignof(max_align_t)) ? TRACE_ALIGN_RAW : _Alignof(max_align_t))
+#define TRACE_HEADER_SIZE       ESP_UTILS_MEM_TRACE_ALIGN_UP(sizeof(trace_header_t), TRACE_ALIGN)
+
+typedef struct {
+    size_t size;
+    uint16_t tag_id;
+    uint16_t site_id;
+} trace_header_t;
+
+typedef struct {
+    const char *name;
+    size_t live_bytes;
+    size_t live_count;
+    size_t peak_bytes;
+    size_t total_count;
+} trace_tag_t;
+
+typedef struct {
+    const void *addr;                   /* `NULL` means the slot is free */
+    uint16_t tag_id;                    /* Tag of the first allocation from this site */
+    size_t live_bytes;
+    size_t live_count;
+} trace_site_t;
+
+_Static_assert(ESP_UTILS_CONF_MEM_TRACE_TAG_NUM >= 2, "Tag table must have at least two entries");
+_Static_assert(ESP_UTILS_CONF_MEM_TRACE_SITE_NUM >= 2, "Site table must have at least two entries");
+
+static pthread_mutex_t trace_mutex = PTHREAD_MUTEX_INITIALIZER;
+static trace_tag_t trace_tags[ESP_UTILS_CONF_MEM_TRACE_TAG_NUM] = {
+    [TRACE_TAG_DEFAULT] = { .name = "default" },
+    [TRACE_TAG_OTHERS] = { .name = "others" },
+};
+static uint32_t trace_tag_num = 1;
+static trace_site_t trace_sites[ESP_UTILS_CONF_MEM_TRACE_SITE_NUM];
+static size_t trace_live_bytes;
+static __thread const char *thread_tag;
+
+static inline trace_header_t *block_to_header(void *p)
+{
+    return (trace_header_t *)((uint8_t *)p - TRACE_HEADER_SIZE);
+}
+
+/* Must be called with the mutex held */
+static int tag_find(const char *tag, bool create)
+{
+    if (tag == NULL) {
+        return TRACE_TAG_DEFAULT;
+    }
+    for (uint32_t i = 0; i < trace_tag_num; i++) {
+        if ((trace_tags[i].name == tag) || (strcmp(trace_tags[i].name, tag) == 0)) {
+            return i;
+        }
+    }
+    if (!create) {
+        return -1;
+    }
+    if (trace_tag_num >= TRACE_TAG_OTHERS) {
+        return TRACE_TAG_OTHERS;
+    }
+    trace_tags[trace_tag_num].name = tag;
+
+    return trace_tag_num++;
+}
+
+/* Must be called with the mutex held */
+static int site_find(const void *addr, int tag_id)
+{
+    uint32_t id = (uint32_t)(((uintptr_t)addr >> 2) * 2654435761u) % TRACE_SITE_HASH_NUM;
+    for (int probe = 0; probe < TRACE_SITE_HASH_NUM; probe++) {
+        trace_site_t *site = &trace_sites[id];
+        if (site->addr == addr) {
+            return id;
+        }
+        if (site->addr == NULL) {
+            site->addr = addr;
+            site->tag_id = tag_id;
+            return id;
+        }
+        id = (id + 1) % TRACE_SITE_HASH_NUM;
+    }
+
+    return TRACE_SITE_OTHERS;
+}
+
+const char *esp_utils_mem_trace_set_tag(const char *tag)
+{
+    const char *prev_tag = thread_tag;
+    thread_tag = tag;
+
+    return prev_tag;
+}
+
+bool esp_utils_mem_trace_get_tag_info(const char *tag, esp_utils_mem_trace_tag_info_t *info)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(info, false, "Invalid info");
+
+    memset(info, 0, sizeof(*info));
+    info->tag = tag;
+
+    pthread_mutex_lock(&trace_mutex);
+    int tag_id = tag_find(tag, false);
+    if (tag_id >= 0) {
+        trace_tag_t *entry = &trace_tags[tag_id];
+        info->tag = entry->name;
+        info->live_bytes = entry->live_bytes;
+        info->live_count = entry->live_count;
+        info->peak_bytes = entry->peak_bytes;
+        info->total_count = entry->total_count;
+    }
+    pthread_mutex_unlock(&trace_mutex);
+
+    return (tag_id >= 0);
+}
+
+size_t esp_utils_mem_trace_get_live_bytes(void)
+{
+    pthread_mutex_lock(&trace_mutex);
+    size_t live_bytes = trace_live_bytes;
+    pthread_mutex_unlock(&trace_mutex);
+
+    return live_bytes;
+}
+
+void esp_utils_mem_trace_reset_peak(void)
+{
+    pthread_mutex_lock(&trace_mutex);
+    for (int i = 0; i < ESP_UTILS_CONF_MEM_TRACE_TAG_NUM; i++) {
+        trace_tags[i].peak_bytes = trace_tags[i].live_bytes;
+    }
+    pthread_mutex_unlock(&trace_mutex);
+}
+
+bool esp_utils_mem_trace_print_info(void)
+{
+    ESP_UTILS_LOG_TRACE_ENTER();
+
+    pthread_mutex_lock(&trace_mutex);
+    printf(
+        "Memory Trace Info (live: %d bytes):\n"
+        "            Tag :     Live /   Blocks /     Peak /    Total\n", (int)trace_live_bytes
+    );
+    for (int i = 0; i < ESP_UTILS_CONF_MEM_TRACE_TAG_NUM; i++) {
+        trace_tag_t *tag = &trace_tags[i];
+        if ((tag->name == NULL) || (tag->total_count == 0)) {
+            continue;
+        }
+        printf(
+            "%15.15s : [%8d / %8d / %8d / %8d]\n", tag->name, (int)tag->live_bytes, (int)tag->live_count,
+            (int)tag->peak_bytes, (int)tag->total_count
+        );
+    }
+    printf("Live allocation sites:\n");
+    for (int i = 0; i < ESP_UTILS_CONF_MEM_TRACE_SITE_NUM; i++) {
+        trace_site_t *site = &trace_sites[i];
+        if (site->live_count == 0) {
+            continue;
+        }
+        printf(
+            "  %p (%s): %d bytes in %d blocks\n", (i == TRACE_SITE_OTHERS) ? NULL : site->addr,
+            trace_tags[site->tag_id].name, (int)site->live_bytes, (int)site->live_count
+        );
+    }
+    pthread_mutex_unlock(&trace_mutex);
+
+    ESP_UTILS_LOG_TRACE_EXIT();
+
+    return true;
+}
+
+size_t esp_utils_mem_trace_get_header_size(void)
+{
+    return TRACE_HEADER_SIZE;
+}
+
+void *esp_utils_mem_trace_on_alloc(void *raw, size_t size, const void *site)
+{
+    trace_header_t *header = (trace_header_t *)raw;
+    header->size = size;
+
+    pthread_mutex_lock(&trace_mutex);
+    int tag_id = tag_find(thread_tag, true);
+    int site_id = site_find(site, tag_id);
+    header->tag_id = tag_id;
+    header->site_id = site_id;
+
+    trace_tag_t *tag = &trace_tags[tag_id];
+    tag->live_bytes += size;
+    tag->live_count++;
+    tag->total_count++;
+    if (tag->live_bytes > tag->peak_bytes) {
+        tag->peak_bytes = tag->live_bytes;
+    }
+    trace_sites[site_id].live_bytes += size;
+    trace_sites[site_id].live_count++;
+    trace_live_bytes += size;
+    pthread_mutex_unlock(&trace_mutex);
+
+    return (uint8_t *)raw + TRACE_HEADER_SIZE;
+}
+
+void *esp_utils_mem_trace_on_free(void *p)
+{
+    if (p == NULL) {
+        return NULL;
+    }
+
+    trace_header_t *header = block_to_header(p);
+
+    pthread_mutex_lock(&trace_mutex);
+    trace_tag_t *tag = &trace_tags[header->tag_id];
+    tag->live_bytes -= header->size;
+    tag->live_count--;
+    trace_sites[header->site_id].live_bytes -= header->size;
+    trace_sites[header->site_id].live_count--;
+    trace_live_bytes -= header->size;
+    pthread_mutex_unlock(&trace_mutex);
+
+    return header;
+}
+
+#endif // ESP_UTILS_CONF_MEM_TRACE_ENABLE
@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_utils_conf_internal.h"
+
+#if ESP_UTILS_CONF_MEM_TRACE_ENABLE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Accounting information of a memory tag
+ */
+typedef struct {
+    const char *tag;        /*!< Tag name */
+    size_t live_bytes;      /*!< Bytes currently allocated */
+    size_t live_count;      /*!< Blocks currently allocated */
+    size_t peak_bytes;      /*!< Maximum of `live_bytes` since the last `esp_utils_mem_trace_reset_peak()` */
+    size_t total_count;     /*!< Number of allocations since boot */
+} esp_utils_mem_trace_tag_info_t;
+
+/**
+ * @brief Set the tag charged for the general memory allocations of the calling thread
+ *
+ * @param[in] tag Tag name, must point to static storage. `NULL` means the default tag
+ *
+ * @return Previous tag of the calling thread
+ */
+const char *esp_utils_mem_trace_set_tag(const char *tag);
+
+/**
+ * @brief Get the accounting information of a tag
+ *
+ * @param[in]  tag  Tag name, `NULL` means the default tag
+ * @param[out] info Accounting information, all zero if the tag has never allocated memory
+ *
+ * @return `true` if the tag is known, `false` otherwise
+ */
+bool esp_utils_mem_trace_get_tag_info(const char *tag, esp_utils_mem_trace_tag_info_t *info);
+
+/**
+ * @brief Get the bytes currently allocated by all tags
+ */
+size_t esp_utils_mem_trace_get_live_bytes(void);
+
+/**
+ * @brief Reset the peak bytes of all tags to their current live bytes
+ */
+void esp_utils_mem_trace_reset_peak(void);
+
+/**
+ * @brief Print the tag table and the allocation sites which still own memory
+ *
+ * The allocation site is the return address of the call into the memory module, which can be resolved with
+ * `addr2line` or the ESP-IDF monitor.
+ *
+ * @return `true` if success, `false` otherwise
+ */
+bool esp_utils_mem_trace_print_info(void);
+
+/* Internal functions used by `esp_utils_mem.c` */
+#define ESP_UTILS_MEM_TRACE_ALIGN_UP(x, a)  ((((x) + (a) - 1) / (a)) * (a))
+size_t esp_utils_mem_trace_get_header_size(void);
+void *esp_utils_mem_trace_on_alloc(void *raw, size_t size, const void *site);
+void *esp_utils_mem_trace_on_free(void *p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef __cplusplus
+
+namespace esp_utils {
+
+/**
+ * Charge the general memory allocations of the calling thread to a tag until the guard is destroyed
+ */
+class MemTraceTagGuard {
+public:
+    explicit MemTraceTagGuard(const char *tag):
+        _prev_tag(esp_utils_mem_trace_set_tag(tag))
+    {
+    }
+
+    ~MemTraceTagGuard()
+    {
+        esp_utils_mem_trace_set_tag(_prev_tag);
+    }
+
+    MemTraceTagGuard(const MemTraceTagGuard &) = delete;
+    MemTraceTagGuard &operator=(const MemTraceTagGuard &) = delete;
+
+private:
+    const char *_prev_tag;
+};
+
+} // namespace esp_utils
+
+#define _ESP_UTILS_MEM_TRACE_CONCAT(a, b)   a ## b
+#define ESP_UTILS_MEM_TRACE_CONCAT(a, b)    _ESP_UTILS_MEM_TRACE_CONCAT(a, b)
+#define ESP_UTILS_MEM_TRACE_TAG_SCOPE(tag) \
+    esp_utils::MemTraceTagGuard ESP_UTILS_MEM_TRACE_CONCAT(_mem_trace_guard_, __LINE__)(tag)
+
+#endif // __cplusplus
+
+#else
+
+#define ESP_UTILS_MEM_TRACE_TAG_SCOPE(tag)
+
+#endif // ESP_UTILS_CONF_MEM_TRACE_ENABLE
@@ -0,0 +1,333 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "esp_utils_conf_internal.h"
+#if ESP_UTILS_CONF_PERF_ENABLE
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "check/esp_utils_check.h"
+#include "log/esp_utils_log.h"
+#include "esp_utils_perf.h"
+
+#define PERF_BUCKET_NUM     (ESP_UTILS_CONF_PERF_HISTOGRAM_BUCKET_NUM)
+
+struct esp_utils_perf_metric_t {
+    const char *name;
+    esp_utils_perf_type_t type;
+    uint32_t bound_num;
+    uint32_t bounds[PERF_BUCKET_NUM];
+    _Atomic int64_t value;
+    _Atomic uint32_t count;
+    _Atomic uint32_t min;
+    _Atomic uint32_t max;
+    _Atomic uint32_t buckets[PERF_BUCKET_NUM + 1];
+};
+
+/* Output of the report, the length keeps growing when the buffer is full */
+typedef struct {
+    char *buffer;                       /* `NULL` means printing to the console */
+    size_t size;
+    size_t len;
+} perf_writer_t;
+
+static const uint32_t perf_default_bounds[] = { 16, 64, 256, 1024, 4096, 16384, 65536 };
+
+static pthread_mutex_t perf_mutex = PTHREAD_MUTEX_INITIALIZER;
+static esp_utils_perf_metric_t perf_metrics[ESP_UTILS_CONF_PERF_METRIC_NUM];
+static _Atomic uint32_t perf_metric_num;    /* Published with release order after a metric is initialized */
+
+static const char *type_to_string(esp_utils_perf_type_t type)
+{
+    switch (type) {
+    case ESP_UTILS_PERF_TYPE_COUNTER:   return "counter";
+    case ESP_UTILS_PERF_TYPE_GAUGE:     return "gauge";
+    case ESP_UTILS_PERF_TYPE_HISTOGRAM: return "histogram";
+    default: break;
+    }
+    return "unknown";
+}
+
+static void metric_reset(esp_utils_perf_metric_t *metric)
+{
+    atomic_store_explicit(&metric->value, 0, memory_order_relaxed);
+    atomic_store_explicit(&metric->count, 0, memory_order_relaxed);
+    atomic_store_explicit(&metric->min, UINT32_MAX, memory_order_relaxed);
+    atomic_store_explicit(&metric->max, 0, memory_order_relaxed);
+    for (int i = 0; i < PERF_BUCKET_NUM + 1; i++) {
+        atomic_store_explicit(&metric->buckets[i], 0, memory_order_relaxed);
+    }
+}
+
+static esp_utils_perf_metric_t *metric_register(
+    const char *name, esp_utils_perf_type_t type, const uint32_t *bounds, size_t bound_num
+)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(name, NULL, "Invalid name");
+
+    esp_utils_perf_metric_t *metric = NULL;
+
+    pthread_mutex_lock(&perf_mutex);
+    uint32_t num = atomic_load_explicit(&perf_metric_num, memory_order_relaxed);
+    for (uint32_t i = 0; i < num; i++) {
+        if (strcmp(perf_metrics[i].name, name) == 0) {
+            metric = &perf_metrics[i];
+            ESP_UTILS_CHECK_FALSE_GOTO(metric->type == type, err, "Metric(%s) is registered as another type", name);
+            goto end;
+        }
+    }
+    ESP_UTILS_CHECK_FALSE_GOTO(num < ESP_UTILS_CONF_PERF_METRIC_NUM, err, "Registry is full, ignore metric(%s)", name);
+
+    metric = &perf_metrics[num];
+    metric->name = name;
+    metric->type = type;
+    metric->bound_num = bound_num;
+    if (bound_num > 0) {
+        memcpy(metric->bounds, bounds, bound_num * sizeof(uint32_t));
+    }
+    metric_reset(metric);
+    atomic_store_explicit(&perf_metric_num, num + 1, memory_order_release);
+
+end:
+    pthread_mutex_unlock(&perf_mutex);
+    return metric;
+
+err:
+    pthread_mutex_unlock(&perf_mutex);
+    return NULL;
+}
+
+esp_utils_perf_metric_t *esp_utils_perf_register_counter(const char *name)
+{
+    return metric_register(name, ESP_UTILS_PERF_TYPE_COUNTER, NULL, 0);
+}
+
+esp_utils_perf_metric_t *esp_utils_perf_register_gauge(const char *name)
+{
+    return metric_register(name, ESP_UTILS_PERF_TYPE_GAUGE, NULL, 0);
+}
+
+esp_utils_perf_metric_t *esp_utils_perf_register_histogram(const char *name, const uint32_t *bounds, size_t bound_num)
+{
+    if (bounds == NULL) {
+        bounds = perf_default_bounds;
+        bound_num = sizeof(perf_default_bounds) / sizeof(perf_default_bounds[0]);
+        if (bound_num > PERF_BUCKET_NUM) {
+            bound_num = PERF_BUCKET_NUM;
+        }
+    }
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (bound_num > 0) && (bound_num <= PERF_BUCKET_NUM), NULL, "Invalid bound number(%d)", (int)bound_num
+    );
+    for (size_t i = 1; i < bound_num; i++) {
+        ESP_UTILS_CHECK_FALSE_RETURN(bounds[i] > bounds[i - 1], NULL, "Bounds must be ascending");
+    }
+
+    return metric_register(name, ESP_UTILS_PERF_TYPE_HISTOGRAM, bounds, bound_num);
+}
+
+void esp_utils_perf_counter_add(esp_utils_perf_metric_t *metric, uint32_t value)
+{
+    if (metric == NULL) {
+        return;
+    }
+    atomic_fetch_add_explicit(&metric->value, value, memory_order_relaxed);
+}
+
+void esp_utils_perf_gauge_set(esp_utils_perf_metric_t *metric, int64_t value)
+{
+    if (metric == NULL) {
+        return;
+    }
+    atomic_store_explicit(&metric->value, value, memory_order_relaxed);
+}
+
+void esp_utils_perf_histogram_record(esp_utils_perf_metric_t *metric, uint32_t value)
+{
+    if (metric == NULL) {
+        return;
+    }
+
+    uint32_t bucket = 0;
+    while ((bucket < metric->bound_num) && (value > metric->bounds[bucket])) {
+        bucket++;
+    }
+    atomic_fetch_add_explicit(&metric->buckets[bucket], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&metric->value, value, memory_order_relaxed);
+    atomic_fetch_add_explicit(&metric->count, 1, memory_order_relaxed);
+
+    uint32_t cur = atomic_load_explicit(&metric->min, memory_order_relaxed);
+    while ((value < cur) &&
+            !atomic_compare_exchange_weak_explicit(&metric->min, &cur, value, memory_order_relaxed, memory_order_relaxed)) {
+    }
+    cur = atomic_load_explicit(&metric->max, memory_order_relaxed);
+    while ((value > cur) &&
+            !atomic_compare_exchange_weak_explicit(&metric->max, &cur, value, memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+int64_t esp_utils_perf_get_time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void metric_snapshot(esp_utils_perf_metric_t *metric, esp_utils_perf_snapshot_t *snapshot)
+{
+    memset(snapshot, 0, sizeof(*snapshot));
+    snapshot->name = metric->name;
+    snapshot->type = metric->type;
+    snapshot->value = atomic_load_explicit(&metric->value, memory_order_relaxed);
+    if (metric->type != ESP_UTILS_PERF_TYPE_HISTOGRAM) {
+        return;
+    }
+    // The fields are updated independently, so they may be slightly inconsistent while samples are being recorded
+    snapshot->count = atomic_load_explicit(&metric->count, memory_order_relaxed);
+    snapshot->min = (snapshot->count > 0) ? atomic_load_explicit(&metric->min, memory_order_relaxed) : 0;
+    snapshot->max = atomic_load_explicit(&metric->max, memory_order_relaxed);
+    snapshot->bucket_num = metric->bound_num + 1;
+    memcpy(snapshot->bounds, metric->bounds, metric->bound_num * sizeof(uint32_t));
+    for (uint32_t i = 0; i < snapshot->bucket_num; i++) {
+        snapshot->buckets[i] = atomic_load_explicit(&metric->buckets[i], memory_order_relaxed);
+    }
+}
+
+size_t esp_utils_perf_get_snapshot(esp_utils_perf_snapshot_t *snapshots, size_t num)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN((num == 0) || (snapshots != NULL), 0, "Invalid snapshots");
+
+    uint32_t metric_num = atomic_load_explicit(&perf_metric_num, memory_order_acquire);
+    for (uint32_t i = 0; (i < metric_num) && (i < num); i++) {
+        metric_snapshot(&perf_metrics[i], &snapshots[i]);
+    }
+
+    return metric_num;
+}
+
+void esp_utils_perf_reset(void)
+{
+    uint32_t metric_num = atomic_load_explicit(&perf_metric_num, memory_order_acquire);
+    for (uint32_t i = 0; i < metric_num; i++) {
+        metric_reset(&perf_metrics[i]);
+    }
+}
+
+static void writer_printf(perf_writer_t *writer, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    int len = 0;
+    if (writer->buffer == NULL) {
+        len = vprintf(format, args);
+    } else if (writer->len < writer->size) {
+        len = vsnprintf(writer->buffer + writer->len, writer->size - writer->len, format, args);
+    } else {
+        len = vsnprintf(NULL, 0, format, args);
+    }
+    va_end(args);
+
+    if (len > 0) {
+        writer->len += len;
+    }
+}
+
+static void export_metric(perf_writer_t *writer, esp_utils_perf_format_t format, const esp_utils_perf_snapshot_t *s)
+{
+    bool is_histogram = (s->type == ESP_UTILS_PERF_TYPE_HISTOGRAM);
+
+    if (format == ESP_UTILS_PERF_FORMAT_CSV) {
+        writer_printf(writer, "%s,%s,%" PRId64, s->name, type_to_string(s->type), s->value);
+        if (is_histogram) {
+            writer_printf(writer, ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",", s->count, s->min, s->max);
+            for (uint32_t i = 0; i < s->bucket_num; i++) {
+                if (i + 1 < s->bucket_num) {
+                    writer_printf(writer, "%sle%" PRIu32 "=%" PRIu32, (i > 0) ? " " : "", s->bounds[i], s->buckets[i]);
+                } else {
+                    writer_printf(writer, " inf=%" PRIu32, s->buckets[i]);
+                }
+            }
+        } else {
+            writer_printf(writer, ",,,,");
+        }
+        writer_printf(writer, "\n");
+        return;
+    }
+
+    if (!is_histogram) {
+        writer_printf(writer, "%32.32s : %9s %" PRId64 "\n", s->name, type_to_string(s->type), s->value);
+        return;
+    }
+    writer_printf(
+        writer, "%32.32s : %9s count %" PRIu32 ", avg %" PRId64 ", min %" PRIu32 ", max %" PRIu32 "\n", s->name,
+        type_to_string(s->type), s->count, (s->count > 0) ? (s->value / s->count) : 0, s->min, s->max
+    );
+    writer_printf(writer, "%32s   ", "");
+    for (uint32_t i = 0; i < s->bucket_num; i++) {
+        if (i + 1 < s->bucket_num) {
+            writer_printf(writer, "[<=%" PRIu32 "]: %" PRIu32 " ", s->bounds[i], s->buckets[i]);
+        } else {
+            writer_printf(writer, "[>%" PRIu32 "]: %" PRIu32 "\n", s->bounds[i - 1], s->buckets[i]);
+        }
+    }
+}
+
+static void export_all(perf_writer_t *writer, esp_utils_perf_format_t format)
+{
+    if (format == ESP_UTILS_PERF_FORMAT_CSV) {
+        writer_printf(writer, "name,type,value,count,min,max,buckets\n");
+    } else {
+        writer_printf(writer, "Performance Counters:\n");
+    }
+
+    // Snapshot one metric at a time to keep the stack usage small
+    uint32_t metric_num = atomic_load_explicit(&perf_metric_num, memory_order_acquire);
+    for (uint32_t i = 0; i < metric_num; i++) {
+        esp_utils_perf_snapshot_t snapshot;
+        metric_snapshot(&perf_metrics[i], &snapshot);
+        export_metric(writer, format, &snapshot);
+    }
+}
+
+size_t esp_utils_perf_export(esp_utils_perf_format_t format, char *buffer, size_t size)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN((size == 0) || (buffer != NULL), 0, "Invalid buffer");
+
+    char dummy = '\0';
+    perf_writer_t writer = {
+        .buffer = (size > 0) ? buffer : &dummy,
+        .size = size,
+        .len = 0,
+    };
+    if (size > 0) {
+        buffer[0] = '\0';
+    }
+    export_all(&writer, format);
+
+    return writer.len;
+}
+
+bool esp_utils_perf_print(esp_utils_perf_format_t format)
+{
+    ESP_UTILS_LOG_TRACE_ENTER();
+
+    perf_writer_t writer = {
+        .buffer = NULL,
+        .size = 0,
+        .len = 0,
+    };
+    export_all(&writer, format);
+
+    ESP_UTILS_LOG_TRACE_EXIT();
+
+    return true;
+}
+
+#endif // ESP_UTILS_CONF_PERF_ENABLE
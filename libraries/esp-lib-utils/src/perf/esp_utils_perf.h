@@ -0,0 +1,196 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_utils_conf_internal.h"
+
+#if ESP_UTILS_CONF_PERF_ENABLE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Type of a performance metric
+ */
+typedef enum {
+    ESP_UTILS_PERF_TYPE_COUNTER = 0,    /*!< Monotonic counter, only increased by `esp_utils_perf_counter_add()` */
+    ESP_UTILS_PERF_TYPE_GAUGE,          /*!< Last value set by `esp_utils_perf_gauge_set()` */
+    ESP_UTILS_PERF_TYPE_HISTOGRAM,      /*!< Samples recorded by `esp_utils_perf_histogram_record()` */
+} esp_utils_perf_type_t;
+
+/**
+ * @brief Format of the performance report
+ */
+typedef enum {
+    ESP_UTILS_PERF_FORMAT_TEXT = 0,     /*!< Aligned table for the console */
+    ESP_UTILS_PERF_FORMAT_CSV,          /*!< One line per metric, with a header line */
+} esp_utils_perf_format_t;
+
+/**
+ * @brief Opaque handle of a registered metric, `NULL` is accepted (and ignored) by all the update functions
+ */
+typedef struct esp_utils_perf_metric_t esp_utils_perf_metric_t;
+
+/**
+ * @brief Snapshot of a metric
+ */
+typedef struct {
+    const char *name;                   /*!< Metric name */
+    esp_utils_perf_type_t type;         /*!< Metric type */
+    int64_t value;                      /*!< Counter or gauge value, sum of the samples for histograms */
+    uint32_t count;                     /*!< Number of samples (histogram only) */
+    uint32_t min;                       /*!< Minimum sample, `0` if there is no sample (histogram only) */
+    uint32_t max;                       /*!< Maximum sample (histogram only) */
+    uint32_t bucket_num;                /*!< Number of valid buckets, the last one has no upper bound */
+    uint32_t bounds[ESP_UTILS_CONF_PERF_HISTOGRAM_BUCKET_NUM];      /*!< Inclusive upper bound of each bucket */
+    uint32_t buckets[ESP_UTILS_CONF_PERF_HISTOGRAM_BUCKET_NUM + 1]; /*!< Samples in each bucket */
+} esp_utils_perf_snapshot_t;
+
+/**
+ * @brief Register a monotonic counter, or get it if a counter with the same name is already registered
+ *
+ * @param[in] name Metric name, must point to static storage
+ *
+ * @return Metric handle, `NULL` if the name is used by another type or the registry is full
+ */
+esp_utils_perf_metric_t *esp_utils_perf_register_counter(const char *name);
+
+/**
+ * @brief Register a gauge, or get it if a gauge with the same name is already registered
+ *
+ * @param[in] name Metric name, must point to static storage
+ *
+ * @return Metric handle, `NULL` if the name is used by another type or the registry is full
+ */
+esp_utils_perf_metric_t *esp_utils_perf_register_gauge(const char *name);
+
+/**
+ * @brief Register a histogram, or get it if a histogram with the same name is already registered
+ *
+ * @param[in] name      Metric name, must point to static storage
+ * @param[in] bounds    Ascending inclusive upper bounds of the buckets, `NULL` means the default bounds
+ *                      (powers of 4 from 16 to 65536, suitable for durations in microseconds)
+ * @param[in] bound_num Number of bounds, at most `ESP_UTILS_CONF_PERF_HISTOGRAM_BUCKET_NUM`
+ *
+ * @return Metric handle, `NULL` if the name is used by another type, the bounds are invalid or the registry is full
+ */
+esp_utils_perf_metric_t *esp_utils_perf_register_histogram(const char *name, const uint32_t *bounds, size_t bound_num);
+
+/**
+ * @brief Update functions, they never block or allocate and can be called from any task
+ */
+void esp_utils_perf_counter_add(esp_utils_perf_metric_t *metric, uint32_t value);
+void esp_utils_perf_gauge_set(esp_utils_perf_metric_t *metric, int64_t value);
+void esp_utils_perf_histogram_record(esp_utils_perf_metric_t *metric, uint32_t value);
+
+/**
+ * @brief Get the monotonic time in microseconds, used to measure durations for histograms
+ */
+int64_t esp_utils_perf_get_time_us(void);
+
+/**
+ * @brief Copy the current values of the registered metrics
+ *
+ * @param[out] snapshots Snapshot array
+ * @param[in]  num       Number of elements in `snapshots`
+ *
+ * @return Number of registered metrics, only the first `num` are copied
+ */
+size_t esp_utils_perf_get_snapshot(esp_utils_perf_snapshot_t *snapshots, size_t num);
+
+/**
+ * @brief Reset the values of all metrics, the registrations are kept
+ */
+void esp_utils_perf_reset(void);
+
+/**
+ * @brief Write the report of all metrics into a buffer
+ *
+ * @param[in]  format Report format
+ * @param[out] buffer Output buffer, can be `NULL` if `size` is `0`
+ * @param[in]  size   Size of `buffer`
+ *
+ * @return Length of the full report (like `snprintf()`), the output is truncated if it is not smaller than `size`
+ */
+size_t esp_utils_perf_export(esp_utils_perf_format_t format, char *buffer, size_t size);
+
+/**
+ * @brief Print the report of all metrics to the console
+ *
+ * @return `true` if success, `false` otherwise
+ */
+bool esp_utils_perf_print(esp_utils_perf_format_t format);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef __cplusplus
+
+namespace esp_utils {
+
+/**
+ * Record the lifetime of the object into a histogram, in microseconds
+ */
+class PerfScopeTimer {
+public:
+    explicit PerfScopeTimer(esp_utils_perf_metric_t *metric):
+        _metric(metric),
+        _start_us(esp_utils_perf_get_time_us())
+    {
+    }
+
+    ~PerfScopeTimer()
+    {
+        esp_utils_perf_histogram_record(_metric, static_cast<uint32_t>(esp_utils_perf_get_time_us() - _start_us));
+    }
+
+    PerfScopeTimer(const PerfScopeTimer &) = delete;
+    PerfScopeTimer &operator=(const PerfScopeTimer &) = delete;
+
+private:
+    esp_utils_perf_metric_t *_metric;
+    int64_t _start_us;
+};
+
+} // namespace esp_utils
+
+/**
+ * The following macros register the metric on first use (C++ only), the names must be string literals
+ */
+#define _ESP_UTILS_PERF_CONCAT(a, b)        a ## b
+#define ESP_UTILS_PERF_CONCAT(a, b)         _ESP_UTILS_PERF_CONCAT(a, b)
+#define ESP_UTILS_PERF_COUNTER_ADD(name, value) do { \
+        static esp_utils_perf_metric_t *const _perf_metric = esp_utils_perf_register_counter(name); \
+        esp_utils_perf_counter_add(_perf_metric, value); \
+    } while (0)
+#define ESP_UTILS_PERF_GAUGE_SET(name, value) do { \
+        static esp_utils_perf_metric_t *const _perf_metric = esp_utils_perf_register_gauge(name); \
+        esp_utils_perf_gauge_set(_perf_metric, value); \
+    } while (0)
+#define ESP_UTILS_PERF_HISTOGRAM_RECORD(name, value) do { \
+        static esp_utils_perf_metric_t *const _perf_metric = esp_utils_perf_register_histogram(name, NULL, 0); \
+        esp_utils_perf_histogram_record(_perf_metric, value); \
+    } while (0)
+#define ESP_UTILS_PERF_HISTOGRAM_SCOPE_US(name) \
+    static esp_utils_perf_metric_t *const ESP_UTILS_PERF_CONCAT(_perf_metric_, __LINE__) = \
+        esp_utils_perf_register_histogram(name, NULL, 0); \
+    esp_utils::PerfScopeTimer ESP_UTILS_PERF_CONCAT(_perf_timer_, __LINE__)(ESP_UTILS_PERF_CONCAT(_perf_metric_, __LINE__))
+
+#endif // __cplusplus
+
+#else
+
+#define ESP_UTILS_PERF_COUNTER_ADD(name, value)
+#define ESP_UTILS_PERF_GAUGE_SET(name, value)
+#define ESP_UTILS_PERF_HISTOGRAM_RECORD(name, value)
+#define ESP_UTILS_PERF_HISTOGRAM_SCOPE_US(name)
+
+#endif // ESP_UTILS_CONF_PERF_ENABLE
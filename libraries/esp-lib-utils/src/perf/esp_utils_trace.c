@@ -0,0 +1,255 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "esp_utils_conf_internal.h"
+#if ESP_UTILS_CONF_TRACE_ENABLE
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "check/esp_utils_check.h"
+#include "log/esp_utils_log.h"
+#include "esp_utils_trace.h"
+
+#define TRACE_EVENT_NUM         (ESP_UTILS_CONF_TRACE_EVENT_NUM)
+#define TRACE_THREAD_NUM        (ESP_UTILS_CONF_TRACE_THREAD_NUM)
+#define TRACE_CHUNK_SIZE        (96)
+
+typedef struct {
+    const char *name;
+    uint32_t ts_us;                     /* Relative to the start of the trace */
+    char phase;                         /* 'B', 'E' or 'i', as defined by the Chrome trace event format */
+} trace_event_t;
+
+/* Only written by the owner task, `head` is published with release order after the event is written */
+typedef struct {
+    _Atomic(const char *) thread_name;
+    _Atomic uint32_t head;
+    trace_event_t events[TRACE_EVENT_NUM];
+} trace_ring_t;
+
+typedef struct {
+    esp_utils_trace_write_cb_t write_cb;
+    void *user_data;
+    size_t len;
+} trace_writer_t;
+
+typedef struct {
+    char *buffer;
+    size_t size;
+    size_t len;
+} trace_buffer_t;
+
+static trace_ring_t trace_rings[TRACE_THREAD_NUM];
+static _Atomic uint32_t trace_ring_num;     /* Rings are never released, so a task keeps its ring forever */
+static _Atomic bool trace_running;
+static _Atomic int64_t trace_start_us;
+static __thread trace_ring_t *thread_ring;
+static __thread bool thread_ring_full;
+
+static int64_t get_time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static trace_ring_t *get_thread_ring(void)
+{
+    if ((thread_ring != NULL) || thread_ring_full) {
+        return thread_ring;
+    }
+
+    uint32_t index = atomic_fetch_add_explicit(&trace_ring_num, 1, memory_order_relaxed);
+    if (index >= TRACE_THREAD_NUM) {
+        thread_ring_full = true;
+        ESP_UTILS_LOGW("No free trace ring, increase `ESP_UTILS_CONF_TRACE_THREAD_NUM`");
+        return NULL;
+    }
+    thread_ring = &trace_rings[index];
+
+    return thread_ring;
+}
+
+static void record(const char *name, char phase)
+{
+    if (!atomic_load_explicit(&trace_running, memory_order_acquire) || (name == NULL)) {
+        return;
+    }
+    trace_ring_t *ring = get_thread_ring();
+    if (ring == NULL) {
+        return;
+    }
+
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    trace_event_t *event = &ring->events[head % TRACE_EVENT_NUM];
+    event->name = name;
+    event->ts_us = (uint32_t)(get_time_us() - atomic_load_explicit(&trace_start_us, memory_order_relaxed));
+    event->phase = phase;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+void esp_utils_trace_start(void)
+{
+    atomic_store_explicit(&trace_running, false, memory_order_relaxed);
+
+    uint32_t ring_num = atomic_load_explicit(&trace_ring_num, memory_order_relaxed);
+    for (uint32_t i = 0; (i < ring_num) && (i < TRACE_THREAD_NUM); i++) {
+        atomic_store_explicit(&trace_rings[i].head, 0, memory_order_relaxed);
+    }
+    atomic_store_explicit(&trace_start_us, get_time_us(), memory_order_relaxed);
+
+    atomic_store_explicit(&trace_running, true, memory_order_release);
+}
+
+void esp_utils_trace_stop(void)
+{
+    atomic_store_explicit(&trace_running, false, memory_order_release);
+}
+
+bool esp_utils_trace_is_running(void)
+{
+    return atomic_load_explicit(&trace_running, memory_order_relaxed);
+}
+
+void esp_utils_trace_set_thread_name(const char *name)
+{
+    trace_ring_t *ring = get_thread_ring();
+    if (ring != NULL) {
+        atomic_store_explicit(&ring->thread_name, name, memory_order_relaxed);
+    }
+}
+
+void esp_utils_trace_begin(const char *name)
+{
+    record(name, 'B');
+}
+
+void esp_utils_trace_end(const char *name)
+{
+    record(name, 'E');
+}
+
+void esp_utils_trace_instant(const char *name)
+{
+    record(name, 'i');
+}
+
+static void writer_write(trace_writer_t *writer, const char *data, size_t len)
+{
+    if (len > 0) {
+        writer->write_cb(data, len, writer->user_data);
+        writer->len += len;
+    }
+}
+
+static void writer_printf(trace_writer_t *writer, const char *format, ...)
+{
+    char chunk[TRACE_CHUNK_SIZE];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(chunk, sizeof(chunk), format, args);
+    va_end(args);
+
+    if (len > 0) {
+        writer_write(writer, chunk, ((size_t)len < sizeof(chunk)) ? (size_t)len : (sizeof(chunk) - 1));
+    }
+}
+
+/* Write a quoted JSON string, names are usually identifiers, so only the quote and the backslash are escaped */
+static void writer_string(trace_writer_t *writer, const char *str)
+{
+    writer_write(writer, "\"", 1);
+    const char *start = str;
+    for (; *str != '\0'; str++) {
+        if ((*str == '"') || (*str == '\\')) {
+            writer_write(writer, start, str - start);
+            writer_write(writer, "\\", 1);
+            start = str;
+        }
+    }
+    writer_write(writer, start, str - start);
+    writer_write(writer, "\"", 1);
+}
+
+size_t esp_utils_trace_dump(esp_utils_trace_write_cb_t write_cb, void *user_data)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(write_cb, 0, "Invalid write callback");
+
+    trace_writer_t writer = {
+        .write_cb = write_cb,
+        .user_data = user_data,
+        .len = 0,
+    };
+    bool is_first = true;
+
+    writer_printf(&writer, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    uint32_t ring_num = atomic_load_explicit(&trace_ring_num, memory_order_relaxed);
+    for (uint32_t tid = 0; (tid < ring_num) && (tid < TRACE_THREAD_NUM); tid++) {
+        const trace_ring_t *ring = &trace_rings[tid];
+
+        writer_printf(
+            &writer, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%" PRIu32 ",\"args\":{\"name\":",
+            is_first ? "" : ",", tid
+        );
+        const char *thread_name = atomic_load_explicit(&ring->thread_name, memory_order_relaxed);
+        if (thread_name != NULL) {
+            writer_string(&writer, thread_name);
+        } else {
+            writer_printf(&writer, "\"thread %" PRIu32 "\"", tid);
+        }
+        writer_printf(&writer, "}}");
+        is_first = false;
+
+        // Only the latest `TRACE_EVENT_NUM` events are kept
+        uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        uint32_t tail = (head > TRACE_EVENT_NUM) ? (head - TRACE_EVENT_NUM) : 0;
+        for (uint32_t i = tail; i < head; i++) {
+            const trace_event_t *event = &ring->events[i % TRACE_EVENT_NUM];
+            writer_printf(&writer, ",\n{\"name\":");
+            writer_string(&writer, event->name);
+            writer_printf(
+                &writer, ",\"ph\":\"%c\",\"ts\":%" PRIu32 ",\"pid\":0,\"tid\":%" PRIu32 "%s}", event->phase,
+                event->ts_us, tid, (event->phase == 'i') ? ",\"s\":\"t\"" : ""
+            );
+        }
+    }
+    writer_printf(&writer, "\n]}\n");
+
+    return writer.len;
+}
+
+static void buffer_write_cb(const char *data, size_t len, void *user_data)
+{
+    trace_buffer_t *buffer = (trace_buffer_t *)user_data;
+
+    if (buffer->len + 1 < buffer->size) {
+        size_t copy_len = buffer->size - buffer->len - 1;
+        copy_len = (len < copy_len) ? len : copy_len;
+        memcpy(buffer->buffer + buffer->len, data, copy_len);
+        buffer->buffer[buffer->len + copy_len] = '\0';
+    }
+    buffer->len += len;
+}
+
+size_t esp_utils_trace_export(char *buffer, size_t size)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN((size == 0) || (buffer != NULL), 0, "Invalid buffer");
+
+    trace_buffer_t output = {
+        .buffer = buffer,
+        .size = size,
+        .len = 0,
+    };
+    if (size > 0) {
+        buffer[0] = '\0';
+    }
+
+    return esp_utils_trace_dump(buffer_write_cb, &output);
+}
+
+#endif // ESP_UTILS_CONF_TRACE_ENABLE
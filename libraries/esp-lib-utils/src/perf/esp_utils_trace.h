@@ -0,0 +1,137 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_utils_conf_internal.h"
+
+#if ESP_UTILS_CONF_TRACE_ENABLE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Callback to write a chunk of the trace file
+ *
+ * @param[in] data      Chunk data, not null-terminated
+ * @param[in] len       Chunk length
+ * @param[in] user_data User data passed to `esp_utils_trace_dump()`
+ */
+typedef void (*esp_utils_trace_write_cb_t)(const char *data, size_t len, void *user_data);
+
+/**
+ * @brief Clear the recorded events and start recording
+ *
+ * @note Events being recorded by other tasks while the trace is restarted may be kept
+ */
+void esp_utils_trace_start(void);
+
+/**
+ * @brief Stop recording, the recorded events are kept until the next `esp_utils_trace_start()`
+ */
+void esp_utils_trace_stop(void);
+
+/**
+ * @brief Check if the events are being recorded
+ */
+bool esp_utils_trace_is_running(void);
+
+/**
+ * @brief Set the name of the calling task shown in the trace viewer, the default name is "thread <index>"
+ *
+ * @param[in] name Task name, must point to static storage
+ */
+void esp_utils_trace_set_thread_name(const char *name);
+
+/**
+ * @brief Record an event into the ring buffer of the calling task
+ *
+ * Each task gets its own ring buffer on its first event, the oldest events are overwritten when it is full. These
+ * functions never block or allocate, but must not be called from ISR.
+ *
+ * @param[in] name Event name, must point to static storage. The begin and end events of a slice must use the same name
+ */
+void esp_utils_trace_begin(const char *name);
+void esp_utils_trace_end(const char *name);
+void esp_utils_trace_instant(const char *name);
+
+/**
+ * @brief Write the recorded events as a Chrome trace JSON file, which can be opened by Perfetto or `chrome://tracing`
+ *
+ * @param[in] write_cb  Callback to write each chunk of the file
+ * @param[in] user_data User data passed to `write_cb`
+ *
+ * @return Length of the file
+ *
+ * @note The trace should be stopped before dumping, otherwise the oldest events may be overwritten during the dump
+ */
+size_t esp_utils_trace_dump(esp_utils_trace_write_cb_t write_cb, void *user_data);
+
+/**
+ * @brief Write the recorded events as a Chrome trace JSON file into a buffer
+ *
+ * @param[out] buffer Output buffer, can be `NULL` if `size` is `0`
+ * @param[in]  size   Size of `buffer`
+ *
+ * @return Length of the full file (like `snprintf()`), the output is truncated if it is not smaller than `size`
+ */
+size_t esp_utils_trace_export(char *buffer, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define ESP_UTILS_TRACE_BEGIN(name)         esp_utils_trace_begin(name)
+#define ESP_UTILS_TRACE_END(name)           esp_utils_trace_end(name)
+#define ESP_UTILS_TRACE_INSTANT(name)       esp_utils_trace_instant(name)
+
+#ifdef __cplusplus
+
+namespace esp_utils {
+
+/**
+ * Record the lifetime of the object as a trace slice
+ */
+class TraceScope {
+public:
+    explicit TraceScope(const char *name):
+        _name(name)
+    {
+        esp_utils_trace_begin(_name);
+    }
+
+    ~TraceScope()
+    {
+        esp_utils_trace_end(_name);
+    }
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+
+private:
+    const char *_name;
+};
+
+} // namespace esp_utils
+
+#define _ESP_UTILS_TRACE_CONCAT(a, b)       a ## b
+#define ESP_UTILS_TRACE_CONCAT(a, b)        _ESP_UTILS_TRACE_CONCAT(a, b)
+#define ESP_UTILS_TRACE_SCOPE(name) \
+    esp_utils::TraceScope ESP_UTILS_TRACE_CONCAT(_trace_scope_, __LINE__)(name)
+
+#endif // __cplusplus
+
+#else
+
+#define ESP_UTILS_TRACE_BEGIN(name)
+#define ESP_UTILS_TRACE_END(name)
+#define ESP_UTILS_TRACE_INSTANT(name)
+#define ESP_UTILS_TRACE_SCOPE(name)
+
+#endif // ESP_UTILS_CONF_TRACE_ENABLE
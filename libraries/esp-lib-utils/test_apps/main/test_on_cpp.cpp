@@ -3,7 +3,15 @@
  *
  * SPDX-License-Identifier: CC0-1.0
  */
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <map>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 #include "unity.h"
 #define ESP_UTILS_LOG_TAG "TestCpp"
 #include "esp_lib_utils.h"
@@ -21,6 +29,35 @@ TEST_CASE("Test log functions on cpp", "[utils][log][CPP]")
     ESP_UTILS_LOG_TRACE_EXIT();
 }
 
+#if ESP_UTILS_CONF_LOG_DEFERRED_ENABLE
+#define DEFERRED_LOG_THREAD_NUM     (4)
+#define DEFERRED_LOG_MESSAGE_NUM    (8)
+
+TEST_CASE("Test deferred log functions on cpp", "[utils][log][deferred][CPP]")
+{
+    auto &deferred = esp_utils::LogDeferred::getInstance();
+    deferred.flush();
+
+    std::thread threads[DEFERRED_LOG_THREAD_NUM];
+    for (int i = 0; i < DEFERRED_LOG_THREAD_NUM; i++) {
+        threads[i] = std::thread([i]() {
+            for (int j = 0; j < DEFERRED_LOG_MESSAGE_NUM; j++) {
+                ESP_UTILS_LOGI("Thread %d, message %d, float %.2f, string %s", i, j, j * 0.5, "deferred");
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    TEST_ASSERT_EQUAL(DEFERRED_LOG_THREAD_NUM * DEFERRED_LOG_MESSAGE_NUM, deferred.flush());
+
+    TEST_ASSERT_TRUE(deferred.startDrainTask(10));
+    ESP_UTILS_LOGI("This is a message printed by the drain task");
+    deferred.stopDrainTask();
+    TEST_ASSERT_EQUAL(0, deferred.flush());
+}
+#endif // ESP_UTILS_CONF_LOG_DEFERRED_ENABLE
+
 #define MALLOC_GOOD_SIZE    (1 * 1024)
 #define MALLOC_BAD_SIZE     (1 * 1024 * 1024)
 
@@ -67,6 +104,294 @@ end:
     return;
 }
 
+#define MEM_BENCH_LOOP_NUM          (2000)
+#define MEM_BENCH_TOUCH_POINT_NUM   (5)
+
+struct MemBenchTouchPoint {
+    int x;
+    int y;
+    int strength;
+};
+
+template <template <typename> class Alloc>
+static int64_t mem_bench_driver_create_destroy(void)
+{
+    using Config = std::array<uint8_t, 96>;
+    using Device = std::array<uint8_t, 320>;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < MEM_BENCH_LOOP_NUM; i++) {
+        std::map<int, std::shared_ptr<Device>, std::less<int>, Alloc<std::pair<const int, std::shared_ptr<Device>>>>
+        devices;
+        std::vector<Config, Alloc<Config>> configs(4);
+        for (int j = 0; j < 4; j++) {
+            devices[j] = std::allocate_shared<Device>(Alloc<Device>());
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+template <template <typename> class Alloc>
+static int64_t mem_bench_touch_read(void)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < MEM_BENCH_LOOP_NUM * 4; i++) {
+        std::vector<uint16_t, Alloc<uint16_t>> x(MEM_BENCH_TOUCH_POINT_NUM);
+        std::vector<uint16_t, Alloc<uint16_t>> y(MEM_BENCH_TOUCH_POINT_NUM);
+        std::vector<uint16_t, Alloc<uint16_t>> strength(MEM_BENCH_TOUCH_POINT_NUM);
+        std::vector<MemBenchTouchPoint, Alloc<MemBenchTouchPoint>> points;
+        for (int j = 0; j < MEM_BENCH_TOUCH_POINT_NUM; j++) {
+            points.push_back({x[j], y[j], strength[j]});
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+TEST_CASE("Test memory allocator benchmark on cpp", "[utils][memory][benchmark][CPP]")
+{
+    // Warm up, so the first measurement doesn't include the cost of growing the heap or the pool
+    mem_bench_driver_create_destroy<std::allocator>();
+    mem_bench_driver_create_destroy<esp_utils::GeneralMemoryAllocator>();
+
+    int64_t std_create = mem_bench_driver_create_destroy<std::allocator>();
+    int64_t gen_create = mem_bench_driver_create_destroy<esp_utils::GeneralMemoryAllocator>();
+    int64_t std_touch = mem_bench_touch_read<std::allocator>();
+    int64_t gen_touch = mem_bench_touch_read<esp_utils::GeneralMemoryAllocator>();
+
+    printf(
+        "Memory allocator benchmark (us, %d loops):\n"
+        "                      stdlib /  general\n"
+        "  create/destroy : %8d / %8d\n"
+        "  touch read     : %8d / %8d\n",
+        MEM_BENCH_LOOP_NUM, (int)std_create, (int)gen_create, (int)std_touch, (int)gen_touch
+    );
+#if ESP_UTILS_CONF_MEM_GEN_ALLOC_TYPE == ESP_UTILS_MEM_ALLOC_TYPE_POOL
+    esp_utils_mem_pool_trim();
+#endif
+}
+
+#if ESP_UTILS_CONF_MEM_TRACE_ENABLE
+#define MEM_TRACE_LOOP_NUM  (10)
+
+static size_t mem_trace_get_tag_live_bytes(const char *tag)
+{
+    esp_utils_mem_trace_tag_info_t info = {};
+    esp_utils_mem_trace_get_tag_info(tag, &info);
+    return info.live_bytes;
+}
+
+TEST_CASE("Test memory trace functions on cpp", "[utils][memory][trace][CPP]")
+{
+    const char *tags[] = {"Test_A", "Test_B"};
+    size_t live_bytes = esp_utils_mem_trace_get_live_bytes();
+
+    // Create and destroy the "drivers" several times, each tag must return to zero live bytes after every loop
+    for (int i = 0; i < MEM_TRACE_LOOP_NUM; i++) {
+        for (auto tag : tags) {
+            std::shared_ptr<TestGoodClass> ptr = nullptr;
+            {
+                ESP_UTILS_MEM_TRACE_TAG_SCOPE(tag);
+                ptr = make_shared<TestGoodClass>();
+            }
+            TEST_ASSERT_GREATER_OR_EQUAL(sizeof(TestGoodClass), mem_trace_get_tag_live_bytes(tag));
+        }
+        for (auto tag : tags) {
+            TEST_ASSERT_EQUAL_MESSAGE(0, mem_trace_get_tag_live_bytes(tag), "Memory leaked");
+        }
+    }
+    TEST_ASSERT_EQUAL(live_bytes, esp_utils_mem_trace_get_live_bytes());
+
+    // A block which is still alive must be reported, and freeing it from another tag must still balance the books
+    void *leak = nullptr;
+    {
+        ESP_UTILS_MEM_TRACE_TAG_SCOPE(tags[0]);
+        leak = esp_utils_mem_gen_malloc(MALLOC_GOOD_SIZE);
+        TEST_ASSERT_NOT_NULL(leak);
+    }
+    TEST_ASSERT_EQUAL(MALLOC_GOOD_SIZE, mem_trace_get_tag_live_bytes(tags[0]));
+    TEST_ASSERT_TRUE(esp_utils_mem_trace_print_info());
+    {
+        ESP_UTILS_MEM_TRACE_TAG_SCOPE(tags[1]);
+        esp_utils_mem_gen_free(leak);
+    }
+    TEST_ASSERT_EQUAL(0, mem_trace_get_tag_live_bytes(tags[0]));
+    TEST_ASSERT_EQUAL(live_bytes, esp_utils_mem_trace_get_live_bytes());
+}
+#endif // ESP_UTILS_CONF_MEM_TRACE_ENABLE
+
+#if ESP_UTILS_CONF_PERF_ENABLE
+#define PERF_THREAD_NUM     (4)
+#define PERF_SAMPLE_NUM     (1000)
+
+static bool perf_find_snapshot(const char *name, esp_utils_perf_snapshot_t *snapshot)
+{
+    esp_utils_perf_snapshot_t snapshots[ESP_UTILS_CONF_PERF_METRIC_NUM];
+    size_t num = std::min(
+                     esp_utils_perf_get_snapshot(snapshots, ESP_UTILS_CONF_PERF_METRIC_NUM),
+                     static_cast<size_t>(ESP_UTILS_CONF_PERF_METRIC_NUM)
+                 );
+    for (size_t i = 0; i < num; i++) {
+        if (strcmp(snapshots[i].name, name) == 0) {
+            *snapshot = snapshots[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+TEST_CASE("Test perf counters functions on cpp", "[utils][perf][CPP]")
+{
+    esp_utils_perf_reset();
+
+    // Registering the same name again returns the same metric, unless the type is different
+    auto counter = esp_utils_perf_register_counter("test.counter");
+    TEST_ASSERT_NOT_NULL(counter);
+    TEST_ASSERT_EQUAL(counter, esp_utils_perf_register_counter("test.counter"));
+    TEST_ASSERT_NULL(esp_utils_perf_register_gauge("test.counter"));
+    const uint32_t bad_bounds[] = {100, 10};
+    TEST_ASSERT_NULL(esp_utils_perf_register_histogram("test.bad_histogram", bad_bounds, 2));
+
+    // Counters are updated concurrently without losing increments
+    std::thread threads[PERF_THREAD_NUM];
+    for (auto &thread : threads) {
+        thread = std::thread([]() {
+            for (int j = 0; j < PERF_SAMPLE_NUM; j++) {
+                ESP_UTILS_PERF_COUNTER_ADD("test.counter", 1);
+                ESP_UTILS_PERF_HISTOGRAM_RECORD("test.default_histogram", j);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ESP_UTILS_PERF_GAUGE_SET("test.gauge", -42);
+    {
+        ESP_UTILS_PERF_HISTOGRAM_SCOPE_US("test.scope_us");
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    const uint32_t bounds[] = {10, 100};
+    auto histogram = esp_utils_perf_register_histogram("test.histogram", bounds, 2);
+    TEST_ASSERT_NOT_NULL(histogram);
+    esp_utils_perf_histogram_record(histogram, 5);
+    esp_utils_perf_histogram_record(histogram, 50);
+    esp_utils_perf_histogram_record(histogram, 500);
+
+    esp_utils_perf_snapshot_t snapshot = {};
+    TEST_ASSERT_TRUE(perf_find_snapshot("test.counter", &snapshot));
+    TEST_ASSERT_EQUAL(PERF_THREAD_NUM * PERF_SAMPLE_NUM, snapshot.value);
+    TEST_ASSERT_TRUE(perf_find_snapshot("test.default_histogram", &snapshot));
+    TEST_ASSERT_EQUAL(PERF_THREAD_NUM * PERF_SAMPLE_NUM, snapshot.count);
+    TEST_ASSERT_EQUAL(0, snapshot.min);
+    TEST_ASSERT_EQUAL(PERF_SAMPLE_NUM - 1, snapshot.max);
+    TEST_ASSERT_TRUE(perf_find_snapshot("test.gauge", &snapshot));
+    TEST_ASSERT_EQUAL(-42, snapshot.value);
+    TEST_ASSERT_TRUE(perf_find_snapshot("test.scope_us", &snapshot));
+    TEST_ASSERT_EQUAL(1, snapshot.count);
+    TEST_ASSERT_GREATER_OR_EQUAL(2000, snapshot.min);
+    TEST_ASSERT_TRUE(perf_find_snapshot("test.histogram", &snapshot));
+    TEST_ASSERT_EQUAL(3, snapshot.bucket_num);
+    TEST_ASSERT_EQUAL(1, snapshot.buckets[0]);
+    TEST_ASSERT_EQUAL(1, snapshot.buckets[1]);
+    TEST_ASSERT_EQUAL(1, snapshot.buckets[2]);
+    TEST_ASSERT_EQUAL(555, snapshot.value);
+    TEST_ASSERT_EQUAL(5, snapshot.min);
+    TEST_ASSERT_EQUAL(500, snapshot.max);
+
+    // The exporter reports the full length even if the buffer is too small
+    size_t len = esp_utils_perf_export(ESP_UTILS_PERF_FORMAT_CSV, nullptr, 0);
+    std::vector<char> report(len + 1);
+    TEST_ASSERT_EQUAL(len, esp_utils_perf_export(ESP_UTILS_PERF_FORMAT_CSV, report.data(), report.size()));
+    TEST_ASSERT_EQUAL(len, strlen(report.data()));
+    TEST_ASSERT_NOT_NULL(strstr(report.data(), "name,type,value,count,min,max,buckets\n"));
+    TEST_ASSERT_NOT_NULL(strstr(report.data(), "test.histogram,histogram,555,3,5,500,le10=1 le100=1 inf=1\n"));
+    char small[16];
+    TEST_ASSERT_EQUAL(len, esp_utils_perf_export(ESP_UTILS_PERF_FORMAT_CSV, small, sizeof(small)));
+    TEST_ASSERT_EQUAL(sizeof(small) - 1, strlen(small));
+    TEST_ASSERT_TRUE(esp_utils_perf_print(ESP_UTILS_PERF_FORMAT_TEXT));
+    TEST_ASSERT_TRUE(esp_utils_perf_print(ESP_UTILS_PERF_FORMAT_CSV));
+
+    esp_utils_perf_reset();
+    TEST_ASSERT_TRUE(perf_find_snapshot("test.counter", &snapshot));
+    TEST_ASSERT_EQUAL(0, snapshot.value);
+}
+#endif // ESP_UTILS_CONF_PERF_ENABLE
+
+#if ESP_UTILS_CONF_TRACE_ENABLE
+#define TRACE_THREAD_NUM    (2)
+
+static size_t count_substring(const std::string &str, const char *sub)
+{
+    size_t count = 0;
+    for (size_t pos = str.find(sub); pos != std::string::npos; pos = str.find(sub, pos + 1)) {
+        count++;
+    }
+    return count;
+}
+
+TEST_CASE("Test trace functions on cpp", "[utils][trace][CPP]")
+{
+    // Events are ignored when the trace is stopped
+    esp_utils_trace_stop();
+    ESP_UTILS_TRACE_INSTANT("ignored");
+
+    esp_utils_trace_start();
+    TEST_ASSERT_TRUE(esp_utils_trace_is_running());
+    std::thread threads[TRACE_THREAD_NUM];
+    for (auto &thread : threads) {
+        thread = std::thread([]() {
+            esp_utils_trace_set_thread_name("worker");
+            // Overflow the ring buffer, only the latest events are kept
+            for (int i = 0; i < ESP_UTILS_CONF_TRACE_EVENT_NUM; i++) {
+                ESP_UTILS_TRACE_SCOPE("frame");
+                ESP_UTILS_TRACE_INSTANT("vsync");
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    {
+        ESP_UTILS_TRACE_SCOPE("main \"scope\"");
+    }
+    esp_utils_trace_stop();
+    ESP_UTILS_TRACE_INSTANT("ignored");
+
+    size_t len = esp_utils_trace_export(nullptr, 0);
+    std::vector<char> buffer(len + 1);
+    TEST_ASSERT_EQUAL(len, esp_utils_trace_export(buffer.data(), buffer.size()));
+    std::string json(buffer.data());
+    TEST_ASSERT_EQUAL(len, json.size());
+    TEST_ASSERT_EQUAL(0, json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    TEST_ASSERT_EQUAL(json.size() - 4, json.rfind("\n]}\n"));
+    TEST_ASSERT_EQUAL(TRACE_THREAD_NUM, count_substring(json, "\"args\":{\"name\":\"worker\"}"));
+    TEST_ASSERT_EQUAL(0, count_substring(json, "ignored"));
+    // Each worker recorded 3 events per iteration, the ring buffer keeps the latest ones
+    TEST_ASSERT_EQUAL(
+        TRACE_THREAD_NUM * ESP_UTILS_CONF_TRACE_EVENT_NUM, count_substring(json, "\"name\":\"frame\"") +
+        count_substring(json, "\"name\":\"vsync\"")
+    );
+    TEST_ASSERT_EQUAL(1, count_substring(json, "\"name\":\"main \\\"scope\\\"\",\"ph\":\"B\""));
+    TEST_ASSERT_EQUAL(1, count_substring(json, "\"name\":\"main \\\"scope\\\"\",\"ph\":\"E\""));
+    TEST_ASSERT_TRUE(count_substring(json, "\"ph\":\"i\",") > 0);
+
+    char small[32];
+    TEST_ASSERT_EQUAL(len, esp_utils_trace_export(small, sizeof(small)));
+    TEST_ASSERT_EQUAL(sizeof(small) - 1, strlen(small));
+
+    // Restarting the trace clears the recorded events
+    esp_utils_trace_start();
+    esp_utils_trace_stop();
+    std::vector<char> empty(len + 1);
+    esp_utils_trace_export(empty.data(), empty.size());
+    TEST_ASSERT_EQUAL(0, count_substring(empty.data(), "\"name\":\"frame\""));
+}
+#endif // ESP_UTILS_CONF_TRACE_ENABLE
+
 static bool test_check_false_return(void)
 {
     ESP_UTILS_CHECK_FALSE_RETURN(true, false, "Check false return failed");
@@ -132,12 +132,18 @@
  * - LV_LAYER_SIMPLE_BUF_SIZE: [bytes] the optimal target buffer size. LVGL will try to allocate it
  * - LV_LAYER_SIMPLE_FALLBACK_BUF_SIZE: [bytes]  used if `LV_LAYER_SIMPLE_BUF_SIZE` couldn't be allocated.
  *
+ * - LV_LAYER_SIMPLE_BUF_REUSE: 1: keep the `LV_LAYER_SIMPLE_BUF_SIZE` buffer after a simple layer is drawn and reuse it
+ *   for the next simple layers instead of allocating it for each of them. The buffer stays allocated between refreshes.
+ *
  * Both buffer sizes are in bytes.
  * "Transformed layers" (where transform_angle/zoom properties are used) use larger buffers
  * and can't be drawn in chunks. So these settings affects only widgets with opacity.
+ * If the parts of a widget with opacity can't overlap (e.g. a plain rectangle or children next to each other)
+ * the opacity is applied to them directly without a layer.
  */
 #define LV_LAYER_SIMPLE_BUF_SIZE          (24 * 1024)
 #define LV_LAYER_SIMPLE_FALLBACK_BUF_SIZE (3 * 1024)
+#define LV_LAYER_SIMPLE_BUF_REUSE         0
 
 /*Default image cache size. Image caching keeps the images opened.
  *If only the built-in image formats are used there is no real advantage of caching. (I.e. if no new image decoder is added)
@@ -294,6 +300,16 @@
 /*1: Draw random colored rectangles over the redrawn areas*/
 #define LV_USE_REFR_DEBUG 0
 
+/*1: Enable the trace points of the rendering pipeline (refresh, flush, timer handler)*/
+#define LV_USE_PROFILER 0
+#if LV_USE_PROFILER
+    /*Header to include for the profiler*/
+    #define LV_PROFILER_INCLUDE <stdint.h>
+    /*Begin/end a trace slice, `tag` is a string with static storage*/
+    #define LV_PROFILER_BEGIN_TAG(tag)
+    #define LV_PROFILER_END_TAG(tag)
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #define LV_SPRINTF_CUSTOM 0
 #if LV_SPRINTF_CUSTOM
@@ -486,6 +502,10 @@
 #define LV_USE_DROPDOWN   1   /*Requires: lv_label*/
 
 #define LV_USE_IMG        1   /*Requires: lv_label*/
+#if LV_USE_IMG
+    /*Memory of the rotated and zoomed images kept by `lv_img_set_transform_cache()` in bytes (0: disable)*/
+    #define LV_IMG_TRANSFORM_CACHE_SIZE 0
+#endif
 
 #define LV_USE_LABEL      1
 #if LV_USE_LABEL
@@ -651,6 +671,13 @@
 
 /*BMP decoder library*/
 #define LV_USE_BMP 0
+#if LV_USE_BMP
+    /*Size of the buffer of the rows read from the file at once [bytes]. At least one row is read*/
+    #define LV_BMP_READ_BUF_SIZE (4 * 1024U)
+    /*Decode the whole image at once if it's at most this size [bytes] (0: disable).
+     *The decoded image is kept in the image cache (`LV_IMG_CACHE_DEF_SIZE`)*/
+    #define LV_BMP_DECODE_MAX_SIZE 0
+#endif
 
 /* JPG + split JPG decoder library.
  * Split JPG is a custom format optimized for embedded systems. */
@@ -688,6 +715,10 @@
 
 /*Rlottie library*/
 #define LV_USE_RLOTTIE 0
+#if LV_USE_RLOTTIE
+    /*Keep every converted frame of an animation if all of them fit into this many bytes (0: disable)*/
+    #define LV_RLOTTIE_FRAME_CACHE_SIZE 0
+#endif
 
 /*FFmpeg library for image decoding and playing videos
  *Supports all major image formats so do not enable other image decoder with it*/
@@ -703,6 +734,11 @@
 
 /*1: Enable API to take snapshot for object*/
 #define LV_USE_SNAPSHOT 0
+#if LV_USE_SNAPSHOT
+    /*1: Animate snapshots of the screens in `lv_scr_load_anim` instead of rendering the screens in every frame.
+     *Requires memory for two screen sized images during the animation*/
+    #define LV_SNAPSHOT_SCR_LOAD_ANIM 0
+#endif
 
 /*1: Enable Monkey test*/
 #define LV_USE_MONKEY 0
@@ -712,6 +748,13 @@
 
 /*1: Enable lv_obj fragment*/
 #define LV_USE_FRAGMENT 0
+#if LV_USE_FRAGMENT
+    /*Number of views in the navigation stack hidden instead of deleted on push. (0: disable caching)
+     *The cached views are shown again on pop without creating them again*/
+    #define LV_FRAGMENT_CACHE_CNT 0
+    /*Approximate memory the cached views of a fragment manager can use [bytes]*/
+    #define LV_FRAGMENT_CACHE_SIZE (16 * 1024U)
+#endif
 
 /*1: Support using images as font in label or span widgets */
 #define LV_USE_IMGFONT 0
@@ -719,6 +762,9 @@
 /*1: Enable a published subscriber based messaging system */
 #define LV_USE_MSG 0
 
+/*1: Enable estimating the rendering cost of the objects*/
+#define LV_USE_RENDER_COST 0
+
 /*1: Enable Pinyin input method*/
 /*Requires: lv_keyboard*/
 #define LV_USE_IME_PINYIN 0
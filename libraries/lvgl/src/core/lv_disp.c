@@ -9,6 +9,7 @@
 #include "lv_disp.h"
 #include "../misc/lv_math.h"
 #include "../core/lv_refr.h"
+#include "../extra/others/snapshot/lv_snapshot.h"
 
 /*********************
  *      DEFINES
@@ -28,6 +29,11 @@ static void set_x_anim(void * obj, int32_t v);
 static void set_y_anim(void * obj, int32_t v);
 static void scr_anim_ready(lv_anim_t * a);
 static bool is_out_anim(lv_scr_load_anim_t a);
+#if LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM
+    static void scr_load_anim_snapshot_start(lv_anim_t * a);
+    static lv_img_dsc_t * scr_snapshot_take(lv_obj_t * scr);
+    static void scr_snapshot_free(lv_disp_t * d);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -234,6 +240,9 @@ void lv_scr_load_anim(lv_obj_t * new_scr, lv_scr_load_anim_t anim_type, uint32_t
         lv_anim_del(d->scr_to_load, NULL);
         lv_obj_set_pos(d->scr_to_load, 0, 0);
         lv_obj_remove_local_style_prop(d->scr_to_load, LV_STYLE_OPA, 0);
+#if LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM
+        scr_snapshot_free(d);
+#endif
 
         if(d->del_prev) {
             lv_obj_del(act_scr);
@@ -360,6 +369,11 @@ void lv_scr_load_anim(lv_obj_t * new_scr, lv_scr_load_anim_t anim_type, uint32_t
             break;
     }
 
+#if LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM
+    /*The screens don't change during the dummy animation so they can be rendered as usual*/
+    if(anim_type != LV_SCR_LOAD_ANIM_NONE) lv_anim_set_start_cb(&a_new, scr_load_anim_snapshot_start);
+#endif
+
     lv_event_send(act_scr, LV_EVENT_SCREEN_UNLOAD_START, NULL);
 
     lv_anim_start(&a_new);
@@ -522,6 +536,10 @@ static void scr_anim_ready(lv_anim_t * a)
     lv_event_send(d->act_scr, LV_EVENT_SCREEN_LOADED, NULL);
     lv_event_send(d->prev_scr, LV_EVENT_SCREEN_UNLOADED, NULL);
 
+#if LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM
+    scr_snapshot_free(d);
+#endif
+
     if(d->prev_scr && d->del_prev) lv_obj_del(d->prev_scr);
     d->prev_scr = NULL;
     d->draw_prev_over_act = false;
@@ -538,3 +556,71 @@ static bool is_out_anim(lv_scr_load_anim_t anim_type)
            anim_type == LV_SCR_LOAD_ANIM_OUT_TOP   ||
            anim_type == LV_SCR_LOAD_ANIM_OUT_BOTTOM;
 }
+
+#if LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM
+
+static void scr_load_anim_snapshot_start(lv_anim_t * a)
+{
+    scr_load_anim_start(a);
+
+    /*Only the position and opacity of the screens change during the animation,
+     *so render them once and draw the images in every frame*/
+    lv_disp_t * d = lv_obj_get_disp(a->var);
+    scr_snapshot_free(d);
+    d->prev_scr_snapshot = scr_snapshot_take(d->prev_scr);
+    d->act_scr_snapshot = scr_snapshot_take(d->act_scr);
+}
+
+static lv_img_dsc_t * scr_snapshot_take(lv_obj_t * scr)
+{
+    if(scr == NULL) return NULL;
+
+    /*The display background or the other screen can be seen through transparent screens*/
+    lv_img_cf_t cf = LV_IMG_CF_TRUE_COLOR;
+    if(lv_obj_get_style_bg_opa(scr, LV_PART_MAIN) < LV_OPA_MAX) cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+
+    uint32_t buf_size = lv_snapshot_buf_size_needed(scr, cf);
+    lv_img_dsc_t * dsc = lv_mem_alloc(sizeof(lv_img_dsc_t) + buf_size);
+    if(dsc == NULL) {
+        /*Not an error: the screen will be rendered in every frame instead*/
+        LV_LOG_WARN("not enough memory for the snapshot of the screen");
+        return NULL;
+    }
+
+    /*The opacity is applied when the snapshot is drawn.
+     *Restore the local opacity afterwards or remove it if the opacity came from another style.*/
+    lv_opa_t opa = lv_obj_get_style_opa(scr, LV_PART_MAIN);
+    lv_style_value_t local_opa;
+    lv_style_res_t local_res = lv_obj_get_local_style_prop(scr, LV_STYLE_OPA, &local_opa, 0);
+    if(opa != LV_OPA_COVER) lv_obj_set_style_opa(scr, LV_OPA_COVER, 0);
+    lv_res_t res = lv_snapshot_take_to_buf(scr, cf, dsc, dsc + 1, buf_size);
+    if(opa != LV_OPA_COVER) {
+        if(local_res == LV_STYLE_RES_FOUND) lv_obj_set_local_style_prop(scr, LV_STYLE_OPA, local_opa, 0);
+        else lv_obj_remove_local_style_prop(scr, LV_STYLE_OPA, 0);
+    }
+
+    if(res != LV_RES_OK) {
+        lv_mem_free(dsc);
+        return NULL;
+    }
+
+    return dsc;
+}
+
+static void scr_snapshot_free(lv_disp_t * d)
+{
+    /*A new snapshot can be allocated to the same address so remove it from the image cache too*/
+    if(d->act_scr_snapshot) {
+        lv_img_cache_invalidate_src(d->act_scr_snapshot);
+        lv_mem_free(d->act_scr_snapshot);
+        d->act_scr_snapshot = NULL;
+    }
+
+    if(d->prev_scr_snapshot) {
+        lv_img_cache_invalidate_src(d->prev_scr_snapshot);
+        lv_mem_free(d->prev_scr_snapshot);
+        d->prev_scr_snapshot = NULL;
+    }
+}
+
+#endif /*LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM*/
@@ -154,6 +154,19 @@ void _lv_event_mark_deleted(lv_obj_t * obj)
     }
 }
 
+bool _lv_event_has_draw_cb(const lv_obj_t * obj)
+{
+    if(obj->spec_attr == NULL) return false;
+
+    int32_t i = 0;
+    for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
+        lv_event_code_t filter = obj->spec_attr->event_dsc[i].filter & ~LV_EVENT_PREPROCESS;
+        if(filter == LV_EVENT_ALL) return true;
+        if(filter >= LV_EVENT_COVER_CHECK && filter <= LV_EVENT_DRAW_PART_END) return true;
+    }
+    return false;
+}
+
 struct _lv_event_dsc_t * lv_obj_add_event_cb(lv_obj_t * obj, lv_event_cb_t event_cb, lv_event_code_t filter,
                                              void * user_data)
 {
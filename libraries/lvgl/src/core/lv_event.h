@@ -222,6 +222,14 @@ uint32_t lv_event_register_id(void);
  */
 void _lv_event_mark_deleted(struct _lv_obj_t * obj);
 
+/**
+ * Check if an object has an event handler which might draw or change the drawing of the object.
+ * (Its filter is `LV_EVENT_ALL` or one of the cover check and draw events)
+ * @param obj pointer to an object
+ * @return true: there is at least one such event handler
+ */
+bool _lv_event_has_draw_cb(const struct _lv_obj_t * obj);
+
 /**
  * Add an event handler function for an object.
  * Used by the user to react on event which happens with the object.
@@ -903,6 +903,8 @@ static void indev_proc_press(_lv_indev_proc_t * proc)
     proc->types.pointer.scroll_throw_vect.y = (proc->types.pointer.scroll_throw_vect.y + proc->types.pointer.vect.y) / 2;
 
     proc->types.pointer.scroll_throw_vect_ori = proc->types.pointer.scroll_throw_vect;
+    proc->types.pointer.scroll_throw_v_q8 = 0;  /*Start a new throw on release*/
+    proc->types.pointer.scroll_throw_wait_refr = 0;
 
     if(indev_obj_act) {
         lv_event_send(indev_obj_act, LV_EVENT_PRESSING, indev_act);
@@ -1035,6 +1037,8 @@ static void indev_proc_reset_query_handler(lv_indev_t * indev)
         indev->proc.types.pointer.scroll_dir = LV_DIR_NONE;
         indev->proc.types.pointer.scroll_throw_vect.x = 0;
         indev->proc.types.pointer.scroll_throw_vect.y = 0;
+        indev->proc.types.pointer.scroll_throw_v_q8 = 0;
+        indev->proc.types.pointer.scroll_throw_wait_refr = 0;
         indev->proc.types.pointer.gesture_sum.x     = 0;
         indev->proc.types.pointer.gesture_sum.y     = 0;
         indev->proc.reset_query                     = 0;
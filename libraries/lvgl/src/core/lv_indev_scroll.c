@@ -13,6 +13,7 @@
  *      DEFINES
  *********************/
 #define ELASTIC_SLOWNESS_FACTOR 4   /*Scrolling on elastic parts are slower by this factor*/
+#define SCROLL_THROW_REFR_TIMEOUT 100   /*Continue the throw after this time even if the display wasn't refreshed [ms]*/
 
 /**********************
  *      TYPEDEFS
@@ -28,6 +29,8 @@ static lv_coord_t find_snap_point_y(const lv_obj_t * obj, lv_coord_t min, lv_coo
 static void scroll_limit_diff(_lv_indev_proc_t * proc, lv_coord_t * diff_x, lv_coord_t * diff_y);
 static lv_coord_t scroll_throw_predict_y(_lv_indev_proc_t * proc);
 static lv_coord_t scroll_throw_predict_x(_lv_indev_proc_t * proc);
+static lv_coord_t scroll_throw_step(_lv_indev_proc_t * proc, lv_coord_t v, lv_coord_t scroll_throw);
+static lv_coord_t scroll_throw_elastic(_lv_indev_proc_t * proc, lv_coord_t diff, lv_coord_t elastic);
 static lv_coord_t elastic_diff(lv_obj_t * scroll_obj, lv_coord_t diff, lv_coord_t scroll_start, lv_coord_t scroll_end,
                                lv_dir_t dir);
 
@@ -120,6 +123,20 @@ void _lv_indev_scroll_throw_handler(_lv_indev_proc_t * proc)
         proc->types.pointer.scroll_throw_vect.x = 0;
     }
 
+    if(proc->types.pointer.scroll_throw_vect.x == 0 && proc->types.pointer.scroll_throw_vect.y == 0) {
+        proc->types.pointer.scroll_throw_v_q8 = 0;
+    }
+    /*Scroll at most once per refresh: the reads in between would only render some steps.
+     *The steps are time based, so the skipped reads are made up in the next step.*/
+    else if(proc->types.pointer.scroll_throw_wait_refr) {
+        lv_disp_t * disp = lv_obj_get_disp(scroll_obj);
+        if(disp->refr_cnt == proc->types.pointer.scroll_throw_refr_cnt &&
+           lv_tick_elaps(proc->types.pointer.scroll_throw_tick) < SCROLL_THROW_REFR_TIMEOUT) {
+            return;
+        }
+        proc->types.pointer.scroll_throw_wait_refr = 0;
+    }
+
     lv_scroll_snap_t align_x = lv_obj_get_scroll_snap_x(scroll_obj);
     lv_scroll_snap_t align_y = lv_obj_get_scroll_snap_y(scroll_obj);
 
@@ -127,16 +144,15 @@ void _lv_indev_scroll_throw_handler(_lv_indev_proc_t * proc)
         proc->types.pointer.scroll_throw_vect.x = 0;
         /*If no snapping "throw"*/
         if(align_y == LV_SCROLL_SNAP_NONE) {
-            proc->types.pointer.scroll_throw_vect.y =
-                proc->types.pointer.scroll_throw_vect.y * (100 - scroll_throw) / 100;
+            lv_coord_t diff_y = scroll_throw_step(proc, proc->types.pointer.scroll_throw_vect.y, scroll_throw);
 
             lv_coord_t sb = lv_obj_get_scroll_bottom(scroll_obj);
             lv_coord_t st = lv_obj_get_scroll_top(scroll_obj);
 
-            proc->types.pointer.scroll_throw_vect.y = elastic_diff(scroll_obj, proc->types.pointer.scroll_throw_vect.y, st, sb,
-                                                                   LV_DIR_VER);
+            diff_y = scroll_throw_elastic(proc, diff_y, elastic_diff(scroll_obj, diff_y, st, sb, LV_DIR_VER));
+            proc->types.pointer.scroll_throw_vect.y = proc->types.pointer.scroll_throw_v_q8 / 256;
 
-            lv_obj_scroll_by(scroll_obj, 0, proc->types.pointer.scroll_throw_vect.y, LV_ANIM_OFF);
+            if(diff_y) lv_obj_scroll_by(scroll_obj, 0, diff_y, LV_ANIM_OFF);
         }
         /*With snapping find the nearest snap point and scroll there*/
         else {
@@ -151,16 +167,15 @@ void _lv_indev_scroll_throw_handler(_lv_indev_proc_t * proc)
         proc->types.pointer.scroll_throw_vect.y = 0;
         /*If no snapping "throw"*/
         if(align_x == LV_SCROLL_SNAP_NONE) {
-            proc->types.pointer.scroll_throw_vect.x =
-                proc->types.pointer.scroll_throw_vect.x * (100 - scroll_throw) / 100;
+            lv_coord_t diff_x = scroll_throw_step(proc, proc->types.pointer.scroll_throw_vect.x, scroll_throw);
 
             lv_coord_t sl = lv_obj_get_scroll_left(scroll_obj);
             lv_coord_t sr = lv_obj_get_scroll_right(scroll_obj);
 
-            proc->types.pointer.scroll_throw_vect.x = elastic_diff(scroll_obj, proc->types.pointer.scroll_throw_vect.x, sl, sr,
-                                                                   LV_DIR_HOR);
+            diff_x = scroll_throw_elastic(proc, diff_x, elastic_diff(scroll_obj, diff_x, sl, sr, LV_DIR_HOR));
+            proc->types.pointer.scroll_throw_vect.x = proc->types.pointer.scroll_throw_v_q8 / 256;
 
-            lv_obj_scroll_by(scroll_obj, proc->types.pointer.scroll_throw_vect.x, 0, LV_ANIM_OFF);
+            if(diff_x) lv_obj_scroll_by(scroll_obj, diff_x, 0, LV_ANIM_OFF);
         }
         /*With snapping find the nearest snap point and scroll there*/
         else {
@@ -174,6 +189,9 @@ void _lv_indev_scroll_throw_handler(_lv_indev_proc_t * proc)
 
     /*Check if the scroll has finished*/
     if(proc->types.pointer.scroll_throw_vect.x == 0 && proc->types.pointer.scroll_throw_vect.y == 0) {
+        proc->types.pointer.scroll_throw_v_q8 = 0;
+        proc->types.pointer.scroll_throw_wait_refr = 0;
+
         /*Revert if scrolled in*/
         /*If vertically scrollable and not controlled by snap*/
         if(align_y == LV_SCROLL_SNAP_NONE) {
@@ -603,6 +621,85 @@ static lv_coord_t scroll_throw_predict_x(_lv_indev_proc_t * proc)
     return move;
 }
 
+/**
+ * Get the move of the throw since its previous step.
+ * The speed is decreased once in every read period as before, but the move is distributed in time
+ * and the fractions of pixels are accumulated. This way the steps follow the elapsed time smoothly
+ * even if some reads are skipped or the reads and refreshes are not in sync.
+ * @param proc pointer to the state of the indev
+ * @param v the throw speed in pixels per read period to start with
+ * @param scroll_throw the slow down in percentage
+ * @return the move in pixels
+ */
+static lv_coord_t scroll_throw_step(_lv_indev_proc_t * proc, lv_coord_t v, lv_coord_t scroll_throw)
+{
+    lv_indev_t * indev_act = lv_indev_get_act();
+    uint32_t period = indev_act->driver->read_timer ? indev_act->driver->read_timer->period : LV_INDEV_DEF_READ_PERIOD;
+    if(period == 0) period = 1;
+
+    uint32_t elaps;
+    if(proc->types.pointer.scroll_throw_v_q8 == 0) {
+        /*The first step after the release*/
+        proc->types.pointer.scroll_throw_v_q8 = (int32_t)v * 256;
+        proc->types.pointer.scroll_throw_rem_q8 = 0;
+        proc->types.pointer.scroll_throw_phase = 0;
+        elaps = period;
+    }
+    else {
+        elaps = lv_tick_elaps(proc->types.pointer.scroll_throw_tick);
+    }
+    proc->types.pointer.scroll_throw_tick = lv_tick_get();
+
+    int32_t v_q8 = proc->types.pointer.scroll_throw_v_q8;
+    int32_t rem_q8 = proc->types.pointer.scroll_throw_rem_q8;
+    uint32_t phase = proc->types.pointer.scroll_throw_phase;
+    while(elaps > 0) {
+        if(phase == 0) {
+            v_q8 = v_q8 * (100 - scroll_throw) / 100;
+            /*Stop below 1 px per period*/
+            if(LV_ABS(v_q8) < 256) {
+                v_q8 = 0;
+                break;
+            }
+        }
+
+        uint32_t t = LV_MIN(elaps, period - phase);
+        rem_q8 += (int32_t)((int64_t)v_q8 * t / period);
+        phase += t;
+        if(phase >= period) phase = 0;
+        elaps -= t;
+    }
+
+    lv_coord_t diff = rem_q8 / 256;
+    proc->types.pointer.scroll_throw_v_q8 = v_q8;
+    proc->types.pointer.scroll_throw_rem_q8 = rem_q8 - diff * 256;
+    proc->types.pointer.scroll_throw_phase = phase;
+    return diff;
+}
+
+/**
+ * Apply the elastic slow down of a throw step to the speed of the throw too
+ * @param proc pointer to the state of the indev
+ * @param diff the move of the step
+ * @param elastic the move of the step with `elastic_diff()` applied
+ * @return `elastic`
+ */
+static lv_coord_t scroll_throw_elastic(_lv_indev_proc_t * proc, lv_coord_t diff, lv_coord_t elastic)
+{
+    if(diff != elastic) {
+        proc->types.pointer.scroll_throw_v_q8 = proc->types.pointer.scroll_throw_v_q8 * elastic / diff;
+        proc->types.pointer.scroll_throw_rem_q8 = 0;
+    }
+
+    if(elastic != 0) {
+        /*Scrolled: wait for the refresh before the next step*/
+        proc->types.pointer.scroll_throw_wait_refr = 1;
+        proc->types.pointer.scroll_throw_refr_cnt = lv_obj_get_disp(proc->types.pointer.scroll_obj)->refr_cnt;
+    }
+
+    return elastic;
+}
+
 static lv_coord_t elastic_diff(lv_obj_t * scroll_obj, lv_coord_t diff, lv_coord_t scroll_start, lv_coord_t scroll_end,
                                lv_dir_t dir)
 {
@@ -944,6 +944,9 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
     if(cmp_res == _LV_STYLE_STATE_CMP_DIFF_REDRAW) {
         lv_obj_invalidate(obj);
     }
+    else if(cmp_res == _LV_STYLE_STATE_CMP_DIFF_REDRAW_SCROLLBAR) {
+        _lv_obj_invalidate_scrollbars(obj);
+    }
     else if(cmp_res == _LV_STYLE_STATE_CMP_DIFF_LAYOUT) {
         lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
     }
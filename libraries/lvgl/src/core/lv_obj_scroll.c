@@ -11,6 +11,7 @@
 #include "lv_indev.h"
 #include "lv_disp.h"
 #include "lv_indev_scroll.h"
+#include "lv_refr.h"
 
 /*********************
  *      DEFINES
@@ -414,16 +415,32 @@ lv_res_t _lv_obj_scroll_by_raw(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
 
     lv_obj_allocate_spec_attr(obj);
 
+    /*If the rendered pixels can be moved only the scrollbars and the new parts need to be redrawn.
+     *The scrollbars are invalidated before scrolling too as their pixels will be moved too.*/
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    bool blit = disp && disp->driver->scroll_blit;
+    if(blit) _lv_obj_invalidate_scrollbars(obj);
+
     obj->spec_attr->scroll.x += x;
     obj->spec_attr->scroll.y += y;
 
     lv_obj_move_children_by(obj, x, y, true);
     lv_res_t res = lv_event_send(obj, LV_EVENT_SCROLL, NULL);
     if(res != LV_RES_OK) return res;
-    lv_obj_invalidate(obj);
+
+    if(blit && _lv_refr_scroll_blit(obj, x, y)) _lv_obj_invalidate_scrollbars(obj);
+    else lv_obj_invalidate(obj);
     return LV_RES_OK;
 }
 
+void _lv_obj_invalidate_scrollbars(lv_obj_t * obj)
+{
+    lv_area_t hor_area, ver_area;
+    lv_obj_get_scrollbar_area(obj, &hor_area, &ver_area);
+    lv_obj_invalidate_area(obj, &hor_area);
+    lv_obj_invalidate_area(obj, &ver_area);
+}
+
 bool lv_obj_is_scrolling(const lv_obj_t * obj)
 {
     lv_indev_t * indev = lv_indev_get_next(NULL);
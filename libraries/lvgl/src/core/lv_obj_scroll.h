@@ -259,6 +259,12 @@ void lv_obj_scroll_to_view_recursive(struct _lv_obj_t * obj, lv_anim_enable_t an
  */
 lv_res_t _lv_obj_scroll_by_raw(struct _lv_obj_t * obj, lv_coord_t x, lv_coord_t y);
 
+/**
+ * Invalidate the area of the scrollbars of an object
+ * @param obj       pointer to an object
+ */
+void _lv_obj_invalidate_scrollbars(struct _lv_obj_t * obj);
+
 /**
  * Tell whether an object is being scrolled or not at this moment
  * @param obj   pointer to an object
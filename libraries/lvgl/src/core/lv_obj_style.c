@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj.h"
 #include "lv_disp.h"
+#include "lv_refr.h"
 #include "../misc/lv_gc.h"
 
 /*********************
@@ -103,6 +104,43 @@ void lv_obj_add_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t se
     lv_obj_refresh_style(obj, selector, LV_STYLE_PROP_ANY);
 }
 
+void _lv_obj_add_styles(lv_obj_t * obj, const _lv_obj_style_t styles[], uint32_t cnt)
+{
+    if(cnt == 0) return;
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        trans_del(obj, styles[i].selector, LV_STYLE_PROP_ANY, NULL);
+    }
+
+    /*Go after the transition and local styles*/
+    for(i = 0; i < obj->style_cnt; i++) {
+        if(obj->styles[i].is_trans) continue;
+        if(obj->styles[i].is_local) continue;
+        break;
+    }
+
+    /*Make room for all the new styles before the first normal style*/
+    uint32_t old_cnt = obj->style_cnt;
+    obj->style_cnt += cnt;
+    obj->styles = lv_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
+    LV_ASSERT_MALLOC(obj->styles);
+
+    uint32_t j;
+    for(j = old_cnt; j > i; j--) {
+        obj->styles[j - 1 + cnt] = obj->styles[j - 1];
+    }
+
+    /*The last added style has the highest priority so it goes to the front*/
+    lv_memset_00(&obj->styles[i], cnt * sizeof(_lv_obj_style_t));
+    for(j = 0; j < cnt; j++) {
+        obj->styles[i + cnt - 1 - j].style = styles[j].style;
+        obj->styles[i + cnt - 1 - j].selector = styles[j].selector;
+    }
+
+    lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
+}
+
 void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t selector)
 {
     lv_state_t state = lv_obj_style_get_selector_state(selector);
@@ -170,12 +208,18 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 
     if(!style_refr) return;
 
-    lv_obj_invalidate(obj);
-
     lv_part_t part = lv_obj_style_get_selector_part(selector);
 
     bool is_layout_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_LAYOUT_REFR);
     bool is_ext_draw = lv_style_prop_has_flag(prop, LV_STYLE_PROP_EXT_DRAW);
+
+    /*E.g. the scrollbars fading in and out while scrolling*/
+    if(part == LV_PART_SCROLLBAR && prop != LV_STYLE_PROP_ANY && !is_layout_refr && !is_ext_draw) {
+        _lv_obj_invalidate_scrollbars(obj);
+    }
+    else {
+        lv_obj_invalidate(obj);
+    }
     bool is_inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
     bool is_layer_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_LAYER_REFR);
 
@@ -443,7 +487,12 @@ _lv_style_state_cmp_t _lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t sta
             else if(lv_style_get_prop(style, LV_STYLE_SHADOW_OFS_Y, &v)) res = _LV_STYLE_STATE_CMP_DIFF_DRAW_PAD;
             else if(lv_style_get_prop(style, LV_STYLE_SHADOW_SPREAD, &v)) res = _LV_STYLE_STATE_CMP_DIFF_DRAW_PAD;
             else if(lv_style_get_prop(style, LV_STYLE_LINE_WIDTH, &v)) res = _LV_STYLE_STATE_CMP_DIFF_DRAW_PAD;
-            else if(res == _LV_STYLE_STATE_CMP_SAME) res = _LV_STYLE_STATE_CMP_DIFF_REDRAW;
+            else if(lv_obj_style_get_selector_part(obj->styles[i].selector) == LV_PART_SCROLLBAR) {
+                if(res == _LV_STYLE_STATE_CMP_SAME) res = _LV_STYLE_STATE_CMP_DIFF_REDRAW_SCROLLBAR;
+            }
+            else if(res == _LV_STYLE_STATE_CMP_SAME || res == _LV_STYLE_STATE_CMP_DIFF_REDRAW_SCROLLBAR) {
+                res = _LV_STYLE_STATE_CMP_DIFF_REDRAW;
+            }
         }
     }
 
@@ -521,6 +570,12 @@ lv_opa_t lv_obj_get_style_opa_recursive(const lv_obj_t * obj, lv_part_t part)
         obj = lv_obj_get_parent(obj);
     }
 
+    /*A parent's `opa_layered` applied without a layer*/
+    lv_opa_t opa_flat = _lv_refr_get_flat_layer_opa();
+    if(opa_flat < LV_OPA_MAX) {
+        opa_final = ((uint32_t)opa_final * opa_flat) >> 8;
+    }
+
     if(opa_final <= LV_OPA_MIN) return LV_OPA_TRANSP;
     if(opa_final >= LV_OPA_MAX) return LV_OPA_COVER;
     return opa_final;
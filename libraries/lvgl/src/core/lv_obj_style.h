@@ -29,6 +29,7 @@ struct _lv_obj_t;
 
 typedef enum {
     _LV_STYLE_STATE_CMP_SAME,           /*The style properties in the 2 states are identical*/
+    _LV_STYLE_STATE_CMP_DIFF_REDRAW_SCROLLBAR, /*Only the scrollbars need to be redrawn*/
     _LV_STYLE_STATE_CMP_DIFF_REDRAW,    /*The differences can be shown with a simple redraw*/
     _LV_STYLE_STATE_CMP_DIFF_DRAW_PAD,  /*The differences can be shown with a simple redraw*/
     _LV_STYLE_STATE_CMP_DIFF_LAYOUT,    /*The differences can be shown with a simple redraw*/
@@ -74,6 +75,15 @@ void _lv_obj_style_init(void);
  */
 void lv_obj_add_style(struct _lv_obj_t * obj, lv_style_t * style, lv_style_selector_t selector);
 
+/**
+ * Add more styles to an object with only one allocation.
+ * It's the same as calling `lv_obj_add_style()` for every style in order. Used by the themes.
+ * @param obj       pointer to an object
+ * @param styles    array of styles with selectors to add. Only `style` and `selector` are used.
+ * @param cnt       number of styles in `styles`
+ */
+void _lv_obj_add_styles(struct _lv_obj_t * obj, const _lv_obj_style_t styles[], uint32_t cnt);
+
 /**
  * Add a style to an object.
  * @param obj       pointer to an object
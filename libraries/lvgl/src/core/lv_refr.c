@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include <stddef.h>
+#include <string.h>
 #include "lv_refr.h"
 #include "lv_disp.h"
 #include "../hal/lv_hal_tick.h"
@@ -18,6 +19,13 @@
 #include "../draw/lv_draw.h"
 #include "../font/lv_font_fmt_txt.h"
 #include "../extra/others/snapshot/lv_snapshot.h"
+#include "../misc/lv_profiler.h"
+#if LV_USE_IMG
+    #include "../widgets/lv_img.h"
+#endif
+#if LV_USE_LIST
+    #include "../extra/widgets/list/lv_list.h"
+#endif
 
 #if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
     #include "../widgets/lv_label.h"
@@ -26,6 +34,8 @@
 /*********************
  *      DEFINES
  *********************/
+/*Don't check more children than this whether a widget's opacity can be applied without a layer*/
+#define LAYER_FLATTEN_MAX_CHILD_CNT   8
 
 /**********************
  *      TYPEDEFS
@@ -51,14 +61,21 @@ typedef struct {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void lv_refr_join_area(void);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
+static void refr_scroll_blit(void);
+static bool get_scroll_blit_area(lv_disp_t * disp, lv_obj_t * obj, lv_area_t * inner, lv_area_t * area);
 static void refr_area(const lv_area_t * area_p);
 static void refr_area_part(lv_draw_ctx_t * draw_ctx);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
+static lv_obj_t * get_scr_top_obj(const lv_area_t * area_p, lv_obj_t * scr);
+static void refr_scr(lv_draw_ctx_t * draw_ctx, lv_obj_t * scr, lv_obj_t * top_obj);
+#if LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM
+    static lv_img_dsc_t * get_scr_snapshot(lv_obj_t * scr, lv_area_t * area);
+#endif
 static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
 static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
+static bool layer_can_flatten(lv_obj_t * obj);
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h);
 static void draw_buf_flush(lv_disp_t * disp);
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
@@ -75,6 +92,7 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
  **********************/
 static uint32_t px_num;
 static lv_disp_t * disp_refr; /*Display being refreshed*/
+static lv_opa_t flat_layer_opa = LV_OPA_COVER; /*Opacity of the layers being drawn without a layer buffer*/
 
 #if LV_USE_PERF_MONITOR
     static perf_monitor_t   perf_monitor;
@@ -279,12 +297,117 @@ void _lv_refr_set_disp_refreshing(lv_disp_t * disp)
     disp_refr = disp;
 }
 
+/**
+ * Register an object's scrolling to move its already rendered pixels before the next refresh instead of redrawing it.
+ * @param obj   pointer to an object whose children were moved by `dx` and `dy`
+ * @param dx    the horizontal scroll distance
+ * @param dy    the vertical scroll distance
+ * @return      true: the pixels will be moved; false: the object needs to be invalidated as usual
+ */
+bool _lv_refr_scroll_blit(lv_obj_t * obj, lv_coord_t dx, lv_coord_t dy)
+{
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    lv_disp_drv_t * drv = disp->driver;
+    if(!drv->scroll_blit || !drv->direct_mode || drv->full_refresh) return false;
+    if(drv->rotated != LV_DISP_ROT_NONE) return false;
+    if(!lv_disp_is_invalidation_enabled(disp)) return false;
+
+    lv_area_t inner;
+    lv_area_t visible;
+    lv_area_t area;
+    if(!get_scroll_blit_area(disp, obj, &inner, &visible)) return false;
+    if(!_lv_area_intersect(&area, &inner, &visible)) return false;
+
+    /*Only one area can be moved before a refresh*/
+    if(disp->blit_ofs.x != 0 || disp->blit_ofs.y != 0) {
+        if(!_lv_area_is_equal(&disp->blit_area, &area)) return false;
+    }
+
+    /*The not yet redrawn parts are moved too, so redraw them on the new position too*/
+    uint16_t inv_p = disp->inv_p;
+    uint16_t i;
+    for(i = 0; i < inv_p && i < disp->inv_p; i++) {
+        lv_area_t inv_area;
+        if(!_lv_area_intersect(&inv_area, &disp->inv_areas[i], &area)) continue;
+        lv_area_move(&inv_area, dx, dy);
+        if(_lv_area_intersect(&inv_area, &inv_area, &area)) _lv_inv_area(disp, &inv_area);
+    }
+
+    /*Redraw the newly visible part*/
+    lv_area_t moved = area;
+    lv_area_move(&moved, dx, dy);
+    lv_area_t res[4];
+    int8_t res_c = _lv_area_diff(res, &area, &moved);
+    int8_t j;
+    if(res_c < 0) _lv_inv_area(disp, &area);
+    for(j = 0; j < res_c; j++) _lv_inv_area(disp, &res[j]);
+
+    /*The border and the corners are not moved but the children might be drawn on them*/
+    res_c = _lv_area_diff(res, &visible, &inner);
+    for(j = 0; j < res_c; j++) _lv_inv_area(disp, &res[j]);
+
+    disp->blit_area = area;
+    disp->blit_ofs.x += dx;
+    disp->blit_ofs.y += dy;
+
+    return true;
+}
+
+/**
+ * Get the opacity of the widgets with `opa_layered` which are being drawn without a layer.
+ * @return the opacity or `LV_OPA_COVER` if no such widget is being drawn
+ */
+lv_opa_t _lv_refr_get_flat_layer_opa(void)
+{
+    return flat_layer_opa;
+}
+
+/**
+ * Join the invalidated areas of the display being refreshed which has got common parts.
+ * The joined areas are marked in `inv_area_joined`.
+ * It shouldn't be used directly by the user, it's public to be benchmarked.
+ */
+void _lv_refr_join_area(void)
+{
+    uint32_t join_from;
+    uint32_t join_in;
+    lv_area_t joined_area;
+    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
+        if(disp_refr->inv_area_joined[join_in] != 0) continue;
+
+        /*Check all areas to join them in 'join_in'*/
+        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
+            /*Handle only unjoined areas and ignore itself*/
+            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
+                continue;
+            }
+
+            /*Check if the areas are on each other*/
+            if(_lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
+                continue;
+            }
+
+            _lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+
+            /*Join two area only if the joined area size is smaller*/
+            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
+                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
+                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+
+                /*Mark 'join_form' is joined into 'join_in'*/
+                disp_refr->inv_area_joined[join_from] = 1;
+            }
+        }
+    }
+}
+
 /**
  * Called periodically to handle the refreshing
  * @param tmr pointer to the timer itself
  */
 void _lv_disp_refr_timer(lv_timer_t * tmr)
 {
+    LV_PROFILER_BEGIN;
     REFR_TRACE("begin");
 
     uint32_t start = lv_tick_get();
@@ -316,15 +439,18 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         disp_refr->inv_p = 0;
         LV_LOG_WARN("there is no active screen");
         REFR_TRACE("finished");
+        LV_PROFILER_END;
         return;
     }
 
-    lv_refr_join_area();
+    _lv_refr_join_area();
     refr_sync_areas();
+    refr_scroll_blit();
     refr_invalid_areas();
 
     /*If refresh happened ...*/
     if(disp_refr->inv_p != 0) {
+        disp_refr->refr_cnt++;
 
         /*Copy invalid areas for sync next refresh in double buffered direct mode*/
         if(disp_refr->driver->direct_mode && disp_refr->driver->draw_buf->buf2) {
@@ -448,6 +574,7 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
 #endif
 
     REFR_TRACE("finished");
+    LV_PROFILER_END;
 }
 
 #if LV_USE_PERF_MONITOR
@@ -470,43 +597,6 @@ uint32_t lv_refr_get_fps_avg(void)
  *   STATIC FUNCTIONS
  **********************/
 
-/**
- * Join the areas which has got common parts
- */
-static void lv_refr_join_area(void)
-{
-    uint32_t join_from;
-    uint32_t join_in;
-    lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
-
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
-            }
-
-            /*Check if the areas are on each other*/
-            if(_lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
-            }
-
-            _lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
-
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
-
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
-            }
-        }
-    }
-}
-
 /**
  * Refresh the sync areas
  */
@@ -579,6 +669,55 @@ static void refr_sync_areas(void)
     _lv_ll_clear(&disp_refr->sync_areas);
 }
 
+/**
+ * Move the pixels of the scrolled object registered by `_lv_refr_scroll_blit()`
+ */
+static void refr_scroll_blit(void)
+{
+    lv_point_t ofs = disp_refr->blit_ofs;
+    if(ofs.x == 0 && ofs.y == 0) return;
+
+    disp_refr->blit_ofs.x = 0;
+    disp_refr->blit_ofs.y = 0;
+
+    lv_disp_drv_t * drv = disp_refr->driver;
+    if(!drv->direct_mode || drv->full_refresh) return;
+
+    lv_area_t scr_area;
+    lv_area_set(&scr_area, 0, 0, lv_disp_get_hor_res(disp_refr) - 1, lv_disp_get_ver_res(disp_refr) - 1);
+    lv_area_t dest = disp_refr->blit_area;
+    lv_area_move(&dest, ofs.x, ofs.y);
+    if(!_lv_area_intersect(&dest, &dest, &disp_refr->blit_area)) return;
+    if(!_lv_area_intersect(&dest, &dest, &scr_area)) return;
+
+    lv_area_t src = dest;
+    lv_area_move(&src, -ofs.x, -ofs.y);
+
+    lv_disp_draw_buf_t * draw_buf = drv->draw_buf;
+    lv_coord_t stride = lv_disp_get_hor_res(disp_refr);
+    if(draw_buf->buf2) {
+        /*Copy from the shown buffer as `refr_sync_areas()` does it with the rest of the last frame*/
+        void * buf_on_screen = draw_buf->buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1;
+        drv->draw_ctx->buffer_copy(drv->draw_ctx, draw_buf->buf_act, stride, &dest, buf_on_screen, stride, &src);
+
+        /*The other buffer also needs the moved pixels*/
+        lv_area_t * sync_area = _lv_ll_ins_tail(&disp_refr->sync_areas);
+        LV_ASSERT_MALLOC(sync_area);
+        if(sync_area) *sync_area = dest;
+    }
+    else {
+        /*Process the lines against the direction of the movement to not overwrite the lines to move*/
+        lv_color_t * buf = draw_buf->buf_act;
+        uint32_t line_size = lv_area_get_width(&dest) * sizeof(lv_color_t);
+        lv_coord_t h = lv_area_get_height(&dest);
+        lv_coord_t i;
+        for(i = 0; i < h; i++) {
+            lv_coord_t y = ofs.y > 0 ? dest.y2 - i : dest.y1 + i;
+            memmove(buf + y * stride + dest.x1, buf + (y - ofs.y) * stride + src.x1, line_size);
+        }
+    }
+}
+
 /**
  * Refresh the joined areas
  */
@@ -695,6 +834,7 @@ static void refr_area(const lv_area_t * area_p)
 
 static void refr_area_part(lv_draw_ctx_t * draw_ctx)
 {
+    LV_PROFILER_BEGIN;
     lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
 
     if(draw_ctx->init_buf)
@@ -727,9 +867,9 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
     lv_obj_t * top_prev_scr = NULL;
 
     /*Get the most top object which is not covered by others*/
-    top_act_scr = lv_refr_get_top_obj(draw_ctx->buf_area, lv_disp_get_scr_act(disp_refr));
+    top_act_scr = get_scr_top_obj(draw_ctx->buf_area, lv_disp_get_scr_act(disp_refr));
     if(disp_refr->prev_scr) {
-        top_prev_scr = lv_refr_get_top_obj(draw_ctx->buf_area, disp_refr->prev_scr);
+        top_prev_scr = get_scr_top_obj(draw_ctx->buf_area, disp_refr->prev_scr);
     }
 
     /*Draw a display background if there is no top object*/
@@ -769,24 +909,20 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
     }
 
     if(disp_refr->draw_prev_over_act) {
-        if(top_act_scr == NULL) top_act_scr = disp_refr->act_scr;
-        refr_obj_and_children(draw_ctx, top_act_scr);
+        refr_scr(draw_ctx, disp_refr->act_scr, top_act_scr);
 
         /*Refresh the previous screen if any*/
         if(disp_refr->prev_scr) {
-            if(top_prev_scr == NULL) top_prev_scr = disp_refr->prev_scr;
-            refr_obj_and_children(draw_ctx, top_prev_scr);
+            refr_scr(draw_ctx, disp_refr->prev_scr, top_prev_scr);
         }
     }
     else {
         /*Refresh the previous screen if any*/
         if(disp_refr->prev_scr) {
-            if(top_prev_scr == NULL) top_prev_scr = disp_refr->prev_scr;
-            refr_obj_and_children(draw_ctx, top_prev_scr);
+            refr_scr(draw_ctx, disp_refr->prev_scr, top_prev_scr);
         }
 
-        if(top_act_scr == NULL) top_act_scr = disp_refr->act_scr;
-        refr_obj_and_children(draw_ctx, top_act_scr);
+        refr_scr(draw_ctx, disp_refr->act_scr, top_act_scr);
     }
 
     /*Also refresh top and sys layer unconditionally*/
@@ -794,6 +930,7 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
     refr_obj_and_children(draw_ctx, lv_disp_get_layer_sys(disp_refr));
 
     draw_buf_flush(disp_refr);
+    LV_PROFILER_END;
 }
 
 /**
@@ -837,6 +974,79 @@ static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj)
     return found_p;
 }
 
+/**
+ * Search the most top object of a screen which fully covers an area.
+ * A screen drawn from a snapshot covers the area only as a whole.
+ * @param area_p pointer to an area
+ * @param scr pointer to a screen
+ * @return the most top object or NULL if the area is not fully covered
+ */
+static lv_obj_t * get_scr_top_obj(const lv_area_t * area_p, lv_obj_t * scr)
+{
+#if LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM
+    lv_area_t snapshot_area;
+    lv_img_dsc_t * snapshot = get_scr_snapshot(scr, &snapshot_area);
+    if(snapshot) {
+        if(snapshot->header.cf == LV_IMG_CF_TRUE_COLOR &&
+           lv_obj_get_style_opa(scr, LV_PART_MAIN) == LV_OPA_COVER &&
+           _lv_area_is_in(area_p, &snapshot_area, 0)) {
+            return scr;
+        }
+        return NULL;
+    }
+#endif
+
+    return lv_refr_get_top_obj(area_p, scr);
+}
+
+/**
+ * Draw a screen from its snapshot if it has any, else render it from its most top object
+ * @param draw_ctx pointer to a draw context
+ * @param scr pointer to a screen
+ * @param top_obj the most top object of the screen covering the area or NULL
+ */
+static void refr_scr(lv_draw_ctx_t * draw_ctx, lv_obj_t * scr, lv_obj_t * top_obj)
+{
+#if LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM
+    lv_area_t snapshot_area;
+    lv_img_dsc_t * snapshot = get_scr_snapshot(scr, &snapshot_area);
+    if(snapshot) {
+        lv_draw_img_dsc_t dsc;
+        lv_draw_img_dsc_init(&dsc);
+        dsc.opa = lv_obj_get_style_opa(scr, LV_PART_MAIN);
+        if(dsc.opa > LV_OPA_MIN) lv_draw_img(draw_ctx, &dsc, &snapshot_area, snapshot);
+        return;
+    }
+#endif
+
+    if(top_obj == NULL) top_obj = scr;
+    refr_obj_and_children(draw_ctx, top_obj);
+}
+
+#if LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM
+/**
+ * Get the snapshot of a screen taken for the screen load animation
+ * @param scr pointer to a screen
+ * @param area store the area of the snapshot here
+ * @return the snapshot or NULL if the screen needs to be rendered
+ */
+static lv_img_dsc_t * get_scr_snapshot(lv_obj_t * scr, lv_area_t * area)
+{
+    lv_img_dsc_t * snapshot = NULL;
+    if(scr == disp_refr->act_scr) snapshot = disp_refr->act_scr_snapshot;
+    else if(scr == disp_refr->prev_scr) snapshot = disp_refr->prev_scr_snapshot;
+    if(snapshot == NULL) return NULL;
+
+    /*The snapshot follows the screen as it's moved by the animation*/
+    lv_coord_t ext_size = _lv_obj_get_ext_draw_size(scr);
+    area->x1 = scr->coords.x1 - ext_size;
+    area->y1 = scr->coords.y1 - ext_size;
+    area->x2 = area->x1 + snapshot->header.w - 1;
+    area->y2 = area->y1 + snapshot->header.h - 1;
+    return snapshot;
+}
+#endif
+
 /**
  * Make the refreshing from an object. Draw all its children and the youngers too.
  * @param top_p pointer to an objects. Start the drawing from it.
@@ -973,6 +1183,16 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
         lv_opa_t opa = lv_obj_get_style_opa_layered(obj, 0);
         if(opa < LV_OPA_MIN) return;
 
+        /*If the parts of the widget can't overlap the opacity can be applied to them one by one*/
+        if(layer_type == LV_LAYER_TYPE_SIMPLE && lv_obj_get_style_blend_mode(obj, 0) == LV_BLEND_MODE_NORMAL &&
+           layer_can_flatten(obj)) {
+            lv_opa_t opa_ori = flat_layer_opa;
+            flat_layer_opa = ((uint32_t)flat_layer_opa * opa) >> 8;
+            lv_obj_redraw(draw_ctx, obj);
+            flat_layer_opa = opa_ori;
+            return;
+        }
+
         lv_area_t layer_area_full;
         lv_res_t res = layer_get_area(draw_ctx, obj, layer_type, &layer_area_full);
         if(res != LV_RES_OK) return;
@@ -1046,6 +1266,222 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     }
 }
 
+/**
+ * Check if an object is drawn on an area
+ * @param obj   pointer to an object
+ * @param area  an area in absolute coordinates
+ * @return      true: `obj` or its child might be drawn on `area`
+ */
+static bool is_drawn_on(lv_obj_t * obj, const lv_area_t * area)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
+
+    lv_area_t obj_area;
+    lv_obj_get_coords(obj, &obj_area);
+    lv_coord_t ext_draw_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&obj_area, ext_draw_size, ext_draw_size);
+    return _lv_area_is_on(&obj_area, area);
+}
+
+/**
+ * Get the area where the pixels of a scrolled object can be moved instead of redrawing them.
+ * It's possible if the background is a solid color behind the children and nothing else is drawn on the area.
+ * @param disp  the display of the object
+ * @param obj   pointer to the scrolled object
+ * @param inner store the object's coordinates without its border and corners here
+ * @param area  store the visible part of the object's coordinates here
+ * @return      true: the pixels can be moved
+ */
+static bool get_scroll_blit_area(lv_disp_t * disp, lv_obj_t * obj, lv_area_t * inner, lv_area_t * area)
+{
+    /*Only widgets which are known to draw only a rectangle*/
+#if LV_USE_LIST
+    if(obj->class_p != &lv_obj_class && obj->class_p != &lv_list_class) return false;
+#else
+    if(obj->class_p != &lv_obj_class) return false;
+#endif
+    if(_lv_event_has_draw_cb(obj)) return false;
+    if(_lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) return false;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+
+    /*The background needs to look the same after moving it*/
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) return false;
+    if(lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE) return false;
+    if(lv_obj_get_style_bg_img_src(obj, LV_PART_MAIN)) return false;
+    if(lv_obj_get_style_blend_mode(obj, LV_PART_MAIN) != LV_BLEND_MODE_NORMAL) return false;
+    if(lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN) != LV_OPA_COVER) return false;
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        if(lv_obj_has_flag(obj->spec_attr->children[i], LV_OBJ_FLAG_FLOATING)) return false;
+    }
+
+    /*Leave out the border, the rounded corners and the outline drawn inside*/
+    lv_coord_t inset = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    if(lv_obj_get_style_border_opa(obj, LV_PART_MAIN) > LV_OPA_MIN) {
+        inset = LV_MAX(inset, lv_obj_get_style_border_width(obj, LV_PART_MAIN));
+    }
+    lv_coord_t outline_pad = lv_obj_get_style_outline_pad(obj, LV_PART_MAIN);
+    if(outline_pad < 0 && lv_obj_get_style_outline_width(obj, LV_PART_MAIN) &&
+       lv_obj_get_style_outline_opa(obj, LV_PART_MAIN) > LV_OPA_MIN) {
+        inset = LV_MAX(inset, -outline_pad);
+    }
+    lv_coord_t short_side = LV_MIN(lv_obj_get_width(obj), lv_obj_get_height(obj));
+    if(inset * 2 >= short_side) return false;
+
+    lv_area_copy(inner, &obj->coords);
+    lv_area_increase(inner, -inset, -inset);
+
+    lv_area_t scr_area;
+    lv_area_set(&scr_area, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+    if(!_lv_area_intersect(area, &obj->coords, &scr_area)) return false;
+
+    /*Clip to the parents and check that nothing is drawn on the area later*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
+    lv_obj_t * child = obj;
+    lv_obj_t * parent = lv_obj_get_parent(obj);
+    while(parent) {
+        if(lv_obj_has_flag(parent, LV_OBJ_FLAG_HIDDEN)) return false;
+        if(_lv_event_has_draw_cb(parent)) return false;
+        if(_lv_obj_get_layer_type(parent) != LV_LAYER_TYPE_NONE) return false;
+        if(lv_obj_get_style_clip_corner(parent, LV_PART_MAIN) && lv_obj_get_style_radius(parent, LV_PART_MAIN)) return false;
+
+        if(!lv_obj_has_flag(parent, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+            if(!_lv_area_intersect(area, area, &parent->coords)) return false;
+        }
+
+        /*The next siblings are drawn later*/
+        child_cnt = lv_obj_get_child_cnt(parent);
+        for(i = lv_obj_get_index(child) + 1; i < child_cnt; i++) {
+            if(is_drawn_on(parent->spec_attr->children[i], area)) return false;
+        }
+
+        /*The scrollbars of the parent are drawn on the children*/
+        lv_area_t hor_area, ver_area;
+        lv_obj_get_scrollbar_area(parent, &hor_area, &ver_area);
+        if(lv_area_get_size(&hor_area) && _lv_area_is_on(&hor_area, area)) return false;
+        if(lv_area_get_size(&ver_area) && _lv_area_is_on(&ver_area, area)) return false;
+
+        child = parent;
+        parent = lv_obj_get_parent(parent);
+    }
+
+    /*`child` is a screen now, check the layers drawn on it*/
+    if(disp->prev_scr) return false;
+
+    lv_obj_t * layers[2] = {NULL, NULL};
+    if(child == disp->act_scr) {
+        layers[0] = disp->top_layer;
+        layers[1] = disp->sys_layer;
+    }
+    else if(child == disp->top_layer) {
+        layers[0] = disp->sys_layer;
+    }
+    else if(child != disp->sys_layer) {
+        return false;
+    }
+
+    for(i = 0; i < 2 && layers[i]; i++) {
+        if(lv_obj_get_style_bg_opa(layers[i], LV_PART_MAIN) > LV_OPA_MIN) return false;
+        child_cnt = lv_obj_get_child_cnt(layers[i]);
+        uint32_t j;
+        for(j = 0; j < child_cnt; j++) {
+            if(is_drawn_on(layers[i]->spec_attr->children[j], area)) return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Count how many primitives (rectangle parts, image, scrollbar) an object draws itself.
+ * @param obj   pointer to an object
+ * @return      0, 1 or 2 which means 2 or more or unknown (e.g. custom drawing)
+ */
+static uint32_t get_primitive_cnt(lv_obj_t * obj)
+{
+    /*Event callbacks can draw anything*/
+    if(obj->spec_attr && obj->spec_attr->event_dsc_cnt) return 2;
+
+    uint32_t cnt = 0;
+#if LV_USE_IMG
+    if(obj->class_p == &lv_img_class) {
+        if(lv_img_get_src(obj)) cnt++;
+    }
+    else
+#endif
+    {
+        if(obj->class_p != &lv_obj_class) return 2;
+    }
+
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) > LV_OPA_MIN) cnt++;
+    if(lv_obj_get_style_bg_img_src(obj, LV_PART_MAIN)) cnt++;
+    if(lv_obj_get_style_border_width(obj, LV_PART_MAIN) &&
+       lv_obj_get_style_border_opa(obj, LV_PART_MAIN) > LV_OPA_MIN) cnt++;
+    if(lv_obj_get_style_outline_width(obj, LV_PART_MAIN) &&
+       lv_obj_get_style_outline_opa(obj, LV_PART_MAIN) > LV_OPA_MIN) cnt++;
+    if(lv_obj_get_style_shadow_width(obj, LV_PART_MAIN) &&
+       lv_obj_get_style_shadow_opa(obj, LV_PART_MAIN) > LV_OPA_MIN) cnt++;
+    if(cnt > 1) return 2;
+
+    lv_area_t hor_area, ver_area;
+    lv_obj_get_scrollbar_area(obj, &hor_area, &ver_area);
+    if(lv_area_get_size(&hor_area)) cnt++;
+    if(lv_area_get_size(&ver_area)) cnt++;
+
+    return LV_MIN(cnt, 2);
+}
+
+/**
+ * Tell whether the opacity of a widget can be applied to the drawn primitives directly instead of using a layer.
+ * It's possible if nothing is drawn on each other, e.g. a simple rectangle or an empty parent with children
+ * which are not overlapping.
+ * @param obj   pointer to an object
+ * @return      true: the widget can be drawn without a layer
+ */
+static bool layer_can_flatten(lv_obj_t * obj)
+{
+    uint32_t own_cnt = get_primitive_cnt(obj);
+    if(own_cnt > 1) return false;
+
+    lv_obj_t * visible[LAYER_FLATTEN_MAX_CHILD_CNT];
+    lv_area_t visible_areas[LAYER_FLATTEN_MAX_CHILD_CNT];
+    uint32_t visible_cnt = 0;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) continue;
+        if(visible_cnt == LAYER_FLATTEN_MAX_CHILD_CNT) return false;
+        visible[visible_cnt] = child;
+        visible_cnt++;
+    }
+
+    if(visible_cnt == 0) return true;
+
+    /*The children would overlap the widget or they could be outside of it*/
+    if(own_cnt) return false;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+
+    for(i = 0; i < visible_cnt; i++) {
+        lv_obj_t * child = visible[i];
+        if(_lv_obj_get_layer_type(child) != LV_LAYER_TYPE_NONE) return false;
+        if(!layer_can_flatten(child)) return false;
+
+        lv_coord_t ext_draw_size = _lv_obj_get_ext_draw_size(child);
+        lv_area_copy(&visible_areas[i], &child->coords);
+        lv_area_increase(&visible_areas[i], ext_draw_size, ext_draw_size);
+
+        uint32_t j;
+        for(j = 0; j < i; j++) {
+            if(_lv_area_is_on(&visible_areas[i], &visible_areas[j])) return false;
+        }
+    }
+
+    return true;
+}
+
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h)
 {
     int32_t max_row = (uint32_t)disp->driver->draw_buf->size / area_w;
@@ -1266,6 +1702,7 @@ static void draw_buf_rotate(lv_area_t * area, lv_color_t * color_p)
  */
 static void draw_buf_flush(lv_disp_t * disp)
 {
+    LV_PROFILER_BEGIN;
     lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
 
     /*Flush the rendered content to the display*/
@@ -1305,6 +1742,7 @@ static void draw_buf_flush(lv_disp_t * disp)
         else
             draw_buf->buf_act = draw_buf->buf1;
     }
+    LV_PROFILER_END;
 }
 
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
@@ -85,6 +85,31 @@ lv_disp_t * _lv_refr_get_disp_refreshing(void);
  */
 void _lv_refr_set_disp_refreshing(lv_disp_t * disp);
 
+/**
+ * Join the invalidated areas of the display being refreshed which has got common parts.
+ * The joined areas are marked in `inv_area_joined`.
+ * It shouldn't be used directly by the user, it's public to be benchmarked.
+ */
+void _lv_refr_join_area(void);
+
+/**
+ * Register an object's scrolling to move its already rendered pixels before the next refresh instead of redrawing it.
+ * Only the newly visible parts are invalidated, the caller should invalidate the scrollbars.
+ * Used only if `scroll_blit` is enabled in the display driver and the object allows it.
+ * @param obj   pointer to an object whose children were moved by `dx` and `dy`
+ * @param dx    the horizontal scroll distance
+ * @param dy    the vertical scroll distance
+ * @return      true: the pixels will be moved; false: the object needs to be invalidated as usual
+ */
+bool _lv_refr_scroll_blit(lv_obj_t * obj, lv_coord_t dx, lv_coord_t dy);
+
+/**
+ * Get the opacity of the widgets with `opa_layered` which are being drawn without a layer.
+ * The drawing functions should multiply the opacity with it (see `lv_obj_get_style_opa_recursive()`)
+ * @return the opacity or `LV_OPA_COVER` if no such widget is being drawn
+ */
+lv_opa_t _lv_refr_get_flat_layer_opa(void);
+
 #if LV_USE_PERF_MONITOR
 /**
  * Reset FPS counter
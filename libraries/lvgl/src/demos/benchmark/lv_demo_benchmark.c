@@ -740,6 +740,19 @@ void lv_demo_benchmark_run_scene(int_fast16_t scene_no)
     }
 }
 
+uint32_t lv_demo_benchmark_get_scene_cnt(void)
+{
+    /*The last scene only terminates the list*/
+    return dimof(scenes) - 1;
+}
+
+const char * lv_demo_benchmark_get_scene_name(int_fast16_t scene_no)
+{
+    if(scene_no < 0 || (uint32_t)(scene_no >> 1) >= lv_demo_benchmark_get_scene_cnt()) return NULL;
+
+    return scenes[scene_no >> 1].name;
+}
+
 void lv_demo_benchmark_set_finished_cb(finished_cb_t * finished_cb)
 {
     benchmark_finished_cb = finished_cb;
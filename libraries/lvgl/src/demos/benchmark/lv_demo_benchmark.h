@@ -33,6 +33,20 @@ void lv_demo_benchmark_close(void);
 
 void lv_demo_benchmark_run_scene(int_fast16_t scene_no);
 
+/**
+ * Get the number of scenes. Each scene can be run twice with `lv_demo_benchmark_run_scene()`:
+ * `scene_no = index * 2` runs it normally and `scene_no = index * 2 + 1` runs it with opacity.
+ * @return the number of scenes
+ */
+uint32_t lv_demo_benchmark_get_scene_cnt(void);
+
+/**
+ * Get the name of a scene
+ * @param scene_no the scene number as in `lv_demo_benchmark_run_scene()`
+ * @return the name of the scene (without the " + opa" suffix) or NULL if `scene_no` is invalid
+ */
+const char * lv_demo_benchmark_get_scene_name(int_fast16_t scene_no);
+
 void lv_demo_benchmark_set_finished_cb(finished_cb_t * finished_cb);
 
 /**
@@ -34,13 +34,17 @@ typedef struct {
 
     /** Fill an area of the destination buffer with a color*/
     void (*blend)(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc);
+
+    /** A free `LV_LAYER_SIMPLE_BUF_SIZE` sized layer buffer kept to be reused by the next layer*/
+    void * layer_buf;
 } lv_draw_sw_ctx_t;
 
 typedef struct {
     lv_draw_layer_ctx_t base_draw;
 
-    uint32_t buf_size_bytes: 31;
+    uint32_t buf_size_bytes: 30;
     uint32_t has_alpha : 1;
+    uint32_t reusable : 1;  /**< The buffer is `LV_LAYER_SIMPLE_BUF_SIZE` large and can be kept for the next layer*/
 } lv_draw_sw_layer_ctx_t;
 
 /**********************
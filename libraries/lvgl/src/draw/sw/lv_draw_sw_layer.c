@@ -22,6 +22,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void * layer_buf_alloc(lv_draw_ctx_t * draw_ctx, lv_draw_sw_layer_ctx_t * layer_sw_ctx);
 
 /**********************
  *  STATIC VARIABLES
@@ -53,11 +54,12 @@ struct _lv_draw_layer_ctx_t * lv_draw_sw_layer_create(struct _lv_draw_ctx_t * dr
         layer_sw_ctx->buf_size_bytes = LV_LAYER_SIMPLE_BUF_SIZE;
         uint32_t full_size = lv_area_get_size(&layer_sw_ctx->base_draw.area_full) * px_size;
         if(layer_sw_ctx->buf_size_bytes > full_size) layer_sw_ctx->buf_size_bytes = full_size;
-        layer_sw_ctx->base_draw.buf = lv_mem_alloc(layer_sw_ctx->buf_size_bytes);
+        layer_sw_ctx->base_draw.buf = layer_buf_alloc(draw_ctx, layer_sw_ctx);
         if(layer_sw_ctx->base_draw.buf == NULL) {
             LV_LOG_WARN("Cannot allocate %"LV_PRIu32" bytes for layer buffer. Allocating %"LV_PRIu32" bytes instead. (Reduced performance)",
                         (uint32_t)layer_sw_ctx->buf_size_bytes, (uint32_t)LV_LAYER_SIMPLE_FALLBACK_BUF_SIZE * px_size);
             layer_sw_ctx->buf_size_bytes = LV_LAYER_SIMPLE_FALLBACK_BUF_SIZE;
+            layer_sw_ctx->reusable = 0;
             layer_sw_ctx->base_draw.buf = lv_mem_alloc(layer_sw_ctx->buf_size_bytes);
             if(layer_sw_ctx->base_draw.buf == NULL) {
                 return NULL;
@@ -72,12 +74,14 @@ struct _lv_draw_layer_ctx_t * lv_draw_sw_layer_create(struct _lv_draw_ctx_t * dr
     else {
         layer_sw_ctx->base_draw.area_act = layer_sw_ctx->base_draw.area_full;
         layer_sw_ctx->buf_size_bytes = lv_area_get_size(&layer_sw_ctx->base_draw.area_full) * px_size;
+        /*Allocated with its own size, a small transformed layer shouldn't hold a simple layer sized buffer*/
+        layer_sw_ctx->reusable = 0;
         layer_sw_ctx->base_draw.buf = lv_mem_alloc(layer_sw_ctx->buf_size_bytes);
-        lv_memset_00(layer_sw_ctx->base_draw.buf, layer_sw_ctx->buf_size_bytes);
         layer_sw_ctx->has_alpha = flags & LV_DRAW_LAYER_FLAG_HAS_ALPHA ? 1 : 0;
         if(layer_sw_ctx->base_draw.buf == NULL) {
             return NULL;
         }
+        lv_memset_00(layer_sw_ctx->base_draw.buf, layer_sw_ctx->buf_size_bytes);
 
         draw_ctx->buf = layer_sw_ctx->base_draw.buf;
         draw_ctx->buf_area = &layer_sw_ctx->base_draw.area_act;
@@ -138,11 +142,44 @@ void lv_draw_sw_layer_blend(struct _lv_draw_ctx_t * draw_ctx, struct _lv_draw_la
 
 void lv_draw_sw_layer_destroy(lv_draw_ctx_t * draw_ctx, lv_draw_layer_ctx_t * layer_ctx)
 {
-    LV_UNUSED(draw_ctx);
+    lv_draw_sw_ctx_t * draw_sw_ctx = (lv_draw_sw_ctx_t *) draw_ctx;
+    lv_draw_sw_layer_ctx_t * layer_sw_ctx = (lv_draw_sw_layer_ctx_t *) layer_ctx;
 
-    lv_mem_free(layer_ctx->buf);
+    /*Keep the buffer for the next layer if there is no other one kept yet (nested layers)*/
+    if(layer_sw_ctx->reusable && draw_sw_ctx->layer_buf == NULL) {
+        draw_sw_ctx->layer_buf = layer_ctx->buf;
+    }
+    else {
+        lv_mem_free(layer_ctx->buf);
+    }
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+/**
+ * Allocate a buffer of `buf_size_bytes` for a simple layer.
+ * It's allocated with `LV_LAYER_SIMPLE_BUF_SIZE` so that it can be reused by any later simple layer.
+ */
+static void * layer_buf_alloc(lv_draw_ctx_t * draw_ctx, lv_draw_sw_layer_ctx_t * layer_sw_ctx)
+{
+    layer_sw_ctx->reusable = 0;
+#if LV_LAYER_SIMPLE_BUF_REUSE
+    if(layer_sw_ctx->buf_size_bytes <= LV_LAYER_SIMPLE_BUF_SIZE) {
+        lv_draw_sw_ctx_t * draw_sw_ctx = (lv_draw_sw_ctx_t *) draw_ctx;
+        void * buf = draw_sw_ctx->layer_buf;
+        if(buf) draw_sw_ctx->layer_buf = NULL;
+        else buf = lv_mem_alloc(LV_LAYER_SIMPLE_BUF_SIZE);
+
+        if(buf) {
+            layer_sw_ctx->reusable = 1;
+            return buf;
+        }
+    }
+#else
+    LV_UNUSED(draw_ctx);
+#endif
+
+    return lv_mem_alloc(layer_sw_ctx->buf_size_bytes);
+}
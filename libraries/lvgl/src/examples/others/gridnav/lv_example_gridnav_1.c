@@ -30,9 +30,9 @@ void lv_example_gridnav_1(void)
         lv_obj_add_flag(obj, LV_OBJ_FLAG_CHECKABLE);
         lv_group_remove_obj(obj);   /*Not needed, we use the gridnav instead*/
 
-        lv_obj_t * label = lv_label_create(obj);
-        lv_label_set_text_fmt(label, "%d", i);
-        lv_obj_center(label);
+        lv_obj_t * btn_label = lv_label_create(obj);
+        lv_label_set_text_fmt(btn_label, "%"LV_PRIu32, i);
+        lv_obj_center(btn_label);
     }
 
     /* Create a second container with rollover grid nav mode.*/
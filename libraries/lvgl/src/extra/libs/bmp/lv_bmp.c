@@ -26,6 +26,12 @@ typedef struct {
     int px_height;
     unsigned int bpp;
     int row_size_bytes;
+    uint32_t px_size;       /*Size of a converted pixel*/
+    uint8_t * block;        /*Converted rows of the file, in the order of the file (bottom-up)*/
+    uint32_t block_stride;  /*Size of a converted row in `block`*/
+    int block_row_max;      /*Number of rows `block` can store*/
+    int block_first;        /*First row of the file in `block`, -1 if empty*/
+    int block_cnt;          /*Number of rows in `block`*/
 } bmp_dsc_t;
 
 /**********************
@@ -39,6 +45,10 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
 
 static void decoder_close(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc);
 
+static lv_res_t block_load(bmp_dsc_t * b, int row);
+static void block_convert(bmp_dsc_t * b);
+static lv_res_t decode_all(bmp_dsc_t * b, lv_img_decoder_dsc_t * dsc);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -135,12 +145,13 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
         memset(&b, 0x00, sizeof(b));
 
         lv_fs_res_t res = lv_fs_open(&b.f, dsc->src, LV_FS_MODE_RD);
-        if(res == LV_RES_OK) return LV_RES_INV;
+        if(res != LV_FS_RES_OK) return LV_RES_INV;
 
         uint8_t header[54];
-        lv_fs_read(&b.f, header, 54, NULL);
+        uint32_t br = 0;
+        res = lv_fs_read(&b.f, header, 54, &br);
 
-        if(0x42 != header[0] || 0x4d != header[1]) {
+        if(res != LV_FS_RES_OK || br != 54 || 0x42 != header[0] || 0x4d != header[1]) {
             lv_fs_close(&b.f);
             return LV_RES_INV;
         }
@@ -151,6 +162,14 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
         memcpy(&b.bpp, header + 28, 2);
         b.row_size_bytes = ((b.bpp * b.px_width + 31) / 32) * 4;
 
+        /*Negative heights (top-down images) are not supported*/
+        if(b.px_width <= 0 || b.px_height <= 0) {
+            LV_LOG_WARN("Unsupported size %dx%d", b.px_width, b.px_height);
+            dsc->error_msg = "Unsupported size";
+            lv_fs_close(&b.f);
+            return LV_RES_INV;
+        }
+
         bool color_depth_error = false;
         if(LV_COLOR_DEPTH == 32 && (b.bpp != 32 && b.bpp != 24)) {
             LV_LOG_WARN("LV_COLOR_DEPTH == 32 but bpp is %d (should be 32 or 24)", b.bpp);
@@ -171,12 +190,35 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
             return LV_RES_INV;
         }
 
+        /*Read as many rows at once as the buffer can store, but at least one*/
+        b.px_size = LV_COLOR_DEPTH == 32 ? 4 : b.bpp / 8;
+        b.block_stride = LV_MAX((uint32_t)b.row_size_bytes, b.px_width * b.px_size);
+        b.block_row_max = LV_CLAMP(1, (int)(LV_BMP_READ_BUF_SIZE / b.block_stride), b.px_height);
+        b.block_first = -1;
+        b.block = lv_mem_alloc(b.block_stride * b.block_row_max);
+        LV_ASSERT_MALLOC(b.block);
+        if(b.block == NULL) {
+            lv_fs_close(&b.f);
+            return LV_RES_INV;
+        }
+
+        dsc->img_data = NULL;
+        if((uint64_t)b.px_width * b.px_height * b.px_size <= LV_BMP_DECODE_MAX_SIZE) {
+            lv_res_t decode_res = decode_all(&b, dsc);
+            lv_mem_free(b.block);
+            lv_fs_close(&b.f);
+            return decode_res;
+        }
+
         dsc->user_data = lv_mem_alloc(sizeof(bmp_dsc_t));
         LV_ASSERT_MALLOC(dsc->user_data);
-        if(dsc->user_data == NULL) return LV_RES_INV;
+        if(dsc->user_data == NULL) {
+            lv_mem_free(b.block);
+            lv_fs_close(&b.f);
+            return LV_RES_INV;
+        }
         memcpy(dsc->user_data, &b, sizeof(b));
 
-        dsc->img_data = NULL;
         return LV_RES_OK;
     }
     /* BMP file as data not supported for simplicity.
@@ -194,47 +236,13 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
     LV_UNUSED(decoder);
 
     bmp_dsc_t * b = dsc->user_data;
-    y = (b->px_height - 1) - y; /*BMP images are stored upside down*/
-    uint32_t p = b->px_offset + b->row_size_bytes * y;
-    p += x * (b->bpp / 8);
-    lv_fs_seek(&b->f, p, LV_FS_SEEK_SET);
-    lv_fs_read(&b->f, buf, len * (b->bpp / 8), NULL);
-
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 1
-    for(unsigned int i = 0; i < len * (b->bpp / 8); i += 2) {
-        buf[i] = buf[i] ^ buf[i + 1];
-        buf[i + 1] = buf[i] ^ buf[i + 1];
-        buf[i] = buf[i] ^ buf[i + 1];
+    int row = (b->px_height - 1) - y; /*BMP images are stored upside down*/
+    if(row < b->block_first || row >= b->block_first + b->block_cnt) {
+        if(block_load(b, row) != LV_RES_OK) return LV_RES_INV;
     }
 
-#elif LV_COLOR_DEPTH == 32
-    if(b->bpp == 32) {
-        lv_coord_t i;
-        for(i = 0; i < len; i++) {
-            uint8_t b0 = buf[i * 4];
-            uint8_t b1 = buf[i * 4 + 1];
-            uint8_t b2 = buf[i * 4 + 2];
-            uint8_t b3 = buf[i * 4 + 3];
-            lv_color32_t * c = (lv_color32_t *)&buf[i * 4];
-            c->ch.red = b2;
-            c->ch.green = b1;
-            c->ch.blue = b0;
-            c->ch.alpha = b3;
-        }
-    }
-    if(b->bpp == 24) {
-        lv_coord_t i;
-
-        for(i = len - 1; i >= 0; i--) {
-            uint8_t * t = &buf[i * 3];
-            lv_color32_t * c = (lv_color32_t *)&buf[i * 4];
-            c->ch.red = t[2];
-            c->ch.green = t[1];
-            c->ch.blue = t[0];
-            c->ch.alpha = 0xff;
-        }
-    }
-#endif
+    const uint8_t * src = b->block + (row - b->block_first) * b->block_stride + x * b->px_size;
+    lv_memcpy(buf, src, len * b->px_size);
 
     return LV_RES_OK;
 }
@@ -246,9 +254,102 @@ static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc
 {
     LV_UNUSED(decoder);
     bmp_dsc_t * b = dsc->user_data;
-    lv_fs_close(&b->f);
-    lv_mem_free(dsc->user_data);
+    if(b) {
+        lv_fs_close(&b->f);
+        lv_mem_free(b->block);
+        lv_mem_free(b);
+        dsc->user_data = NULL;
+    }
+    if(dsc->img_data) {
+        lv_mem_free((uint8_t *)dsc->img_data);
+        dsc->img_data = NULL;
+    }
+}
 
+/**
+ * Read the aligned block of rows which contains a row of the file and convert it
+ * @param b the BMP descriptor
+ * @param row index of a row in the file, i.e. counted from the bottom
+ * @return LV_RES_OK: the row is in the block; LV_RES_INV: read error
+ */
+static lv_res_t block_load(bmp_dsc_t * b, int row)
+{
+    int first = row - row % b->block_row_max;
+    int cnt = LV_MIN(b->block_row_max, b->px_height - first);
+    uint32_t size = b->row_size_bytes * cnt;
+    uint32_t br = 0;
+
+    b->block_first = -1;
+    if(lv_fs_seek(&b->f, b->px_offset + b->row_size_bytes * first, LV_FS_SEEK_SET) != LV_FS_RES_OK) return LV_RES_INV;
+    if(lv_fs_read(&b->f, b->block, size, &br) != LV_FS_RES_OK || br != size) return LV_RES_INV;
+
+    b->block_first = first;
+    b->block_cnt = cnt;
+    block_convert(b);
+
+    return LV_RES_OK;
+}
+
+/**
+ * Convert the rows read into the block to the color format of LVGL, from `row_size_bytes` to `block_stride` per row
+ * @param b the BMP descriptor
+ */
+static void block_convert(bmp_dsc_t * b)
+{
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 1
+    /*The rows are 4 bytes aligned, so two pixels are swapped at once*/
+    uint32_t * w = (uint32_t *)b->block;
+    uint32_t w_cnt = b->row_size_bytes * b->block_cnt / 4;
+    for(uint32_t i = 0; i < w_cnt; i++) {
+        w[i] = ((w[i] & 0x00ff00ffU) << 8) | ((w[i] >> 8) & 0x00ff00ffU);
+    }
+#elif LV_COLOR_DEPTH == 32
+    /*BGRA is the layout of `lv_color32_t` already, BGR is expanded in place from the end*/
+    if(b->bpp == 24) {
+        for(int r = b->block_cnt - 1; r >= 0; r--) {
+            const uint8_t * src = b->block + r * b->row_size_bytes;
+            lv_color32_t * dst = (lv_color32_t *)(b->block + r * b->block_stride);
+            for(int i = b->px_width - 1; i >= 0; i--) {
+                lv_color32_t c;
+                c.ch.blue = src[i * 3];
+                c.ch.green = src[i * 3 + 1];
+                c.ch.red = src[i * 3 + 2];
+                c.ch.alpha = 0xff;
+                dst[i] = c;
+            }
+        }
+    }
+#else
+    LV_UNUSED(b);
+#endif
+}
+
+/**
+ * Decode the whole image, so it can be kept in the image cache
+ * @param b the BMP descriptor with an allocated block
+ * @param dsc the decoder descriptor, `img_data` is set on success
+ * @return LV_RES_OK: no error; LV_RES_INV: allocation or read error
+ */
+static lv_res_t decode_all(bmp_dsc_t * b, lv_img_decoder_dsc_t * dsc)
+{
+    uint32_t line_size = b->px_width * b->px_size;
+    uint8_t * img = lv_mem_alloc(line_size * b->px_height);
+    LV_ASSERT_MALLOC(img);
+    if(img == NULL) return LV_RES_INV;
+
+    for(int row = 0; row < b->px_height; row += b->block_row_max) {
+        if(block_load(b, row) != LV_RES_OK) {
+            lv_mem_free(img);
+            return LV_RES_INV;
+        }
+        for(int i = 0; i < b->block_cnt; i++) {
+            int y = (b->px_height - 1) - (row + i);
+            lv_memcpy(img + y * line_size, b->block + i * b->block_stride, line_size);
+        }
+    }
+
+    dsc->img_data = img;
+    return LV_RES_OK;
 }
 
 #endif /*LV_USE_BMP*/
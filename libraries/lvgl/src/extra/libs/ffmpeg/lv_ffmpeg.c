@@ -44,13 +44,11 @@ struct ffmpeg_context_s {
     AVFormatContext * fmt_ctx;
     AVCodecContext * video_dec_ctx;
     AVStream * video_stream;
-    uint8_t * video_src_data[4];
     uint8_t * video_dst_data[4];
     struct SwsContext * sws_ctx;
     AVFrame * frame;
     AVPacket pkt;
     int video_stream_idx;
-    int video_src_linesize[4];
     int video_dst_linesize[4];
     enum AVPixelFormat video_dst_pix_fmt;
     bool has_alpha;
@@ -85,6 +83,9 @@ static int ffmpeg_update_next_frame(struct ffmpeg_context_s * ffmpeg_ctx);
 static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx);
 static bool ffmpeg_pix_fmt_has_alpha(enum AVPixelFormat pix_fmt);
 static bool ffmpeg_pix_fmt_is_yuv(enum AVPixelFormat pix_fmt);
+#if LV_COLOR_DEPTH >= 16
+    static void ffmpeg_convert_yuv420p(const AVFrame * frame, lv_color_t * dst, int dst_stride, bool full_range);
+#endif
 
 static void lv_ffmpeg_player_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_ffmpeg_player_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
@@ -413,12 +414,27 @@ static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx)
 
     LV_LOG_TRACE("video_frame coded_n:%d", frame->coded_picture_number);
 
-    /* copy decoded frame to destination buffer:
-     * this is required since rawvideo expects non aligned data
+    if(!ffmpeg_ctx->has_alpha) {
+        int lv_linesize = sizeof(lv_color_t) * width;
+        int dst_linesize = ffmpeg_ctx->video_dst_linesize[0];
+        if(dst_linesize != lv_linesize) {
+            LV_LOG_WARN("ffmpeg linesize = %d, but lvgl image require %d",
+                        dst_linesize,
+                        lv_linesize);
+            ffmpeg_ctx->video_dst_linesize[0] = lv_linesize;
+        }
+    }
+
+#if LV_COLOR_DEPTH >= 16
+    /* The most common format of the videos is converted directly to lv_color_t
+     * as the size doesn't change and no scaling is needed
      */
-    av_image_copy(ffmpeg_ctx->video_src_data, ffmpeg_ctx->video_src_linesize,
-                  (const uint8_t **)(frame->data), frame->linesize,
-                  ffmpeg_ctx->video_dec_ctx->pix_fmt, width, height);
+    if(frame->format == AV_PIX_FMT_YUV420P || frame->format == AV_PIX_FMT_YUVJ420P) {
+        ffmpeg_convert_yuv420p(frame, (lv_color_t *)ffmpeg_ctx->video_dst_data[0], width,
+                               frame->format == AV_PIX_FMT_YUVJ420P);
+        return height;
+    }
+#endif
 
     if(ffmpeg_ctx->sws_ctx == NULL) {
         int swsFlags = SWS_BILINEAR;
@@ -448,21 +464,11 @@ static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx)
                                   NULL, NULL, NULL);
     }
 
-    if(!ffmpeg_ctx->has_alpha) {
-        int lv_linesize = sizeof(lv_color_t) * width;
-        int dst_linesize = ffmpeg_ctx->video_dst_linesize[0];
-        if(dst_linesize != lv_linesize) {
-            LV_LOG_WARN("ffmpeg linesize = %d, but lvgl image require %d",
-                        dst_linesize,
-                        lv_linesize);
-            ffmpeg_ctx->video_dst_linesize[0] = lv_linesize;
-        }
-    }
-
+    /* The decoded frame is the source of the conversion, no need to copy it */
     ret = sws_scale(
               ffmpeg_ctx->sws_ctx,
-              (const uint8_t * const *)(ffmpeg_ctx->video_src_data),
-              ffmpeg_ctx->video_src_linesize,
+              (const uint8_t * const *)(frame->data),
+              frame->linesize,
               0,
               height,
               ffmpeg_ctx->video_dst_data,
@@ -472,6 +478,50 @@ failed:
     return ret;
 }
 
+#if LV_COLOR_DEPTH >= 16
+
+/* Convert YUV 4:2:0 to lv_color_t with BT.601 integer coefficients, as `sws_scale` does by default */
+static void ffmpeg_convert_yuv420p(const AVFrame * frame, lv_color_t * dst, int dst_stride, bool full_range)
+{
+    int y_ofs, y_mul, r_v, g_u, g_v, b_u;
+
+    if(full_range) {
+        y_ofs = 0;
+        y_mul = 256;
+        r_v = 359;
+        g_u = 88;
+        g_v = 183;
+        b_u = 454;
+    }
+    else {
+        y_ofs = 16;
+        y_mul = 298;
+        r_v = 409;
+        g_u = 100;
+        g_v = 208;
+        b_u = 516;
+    }
+
+    for(int y = 0; y < frame->height; y++) {
+        const uint8_t * y_p = frame->data[0] + y * frame->linesize[0];
+        const uint8_t * u_p = frame->data[1] + (y >> 1) * frame->linesize[1];
+        const uint8_t * v_p = frame->data[2] + (y >> 1) * frame->linesize[2];
+        lv_color_t * dst_p = dst + y * dst_stride;
+
+        for(int x = 0; x < frame->width; x++) {
+            int u = u_p[x >> 1] - 128;
+            int v = v_p[x >> 1] - 128;
+            int c = (y_p[x] - y_ofs) * y_mul + 128;
+            int r = (c + r_v * v) >> 8;
+            int g = (c - g_u * u - g_v * v) >> 8;
+            int b = (c + b_u * u) >> 8;
+            dst_p[x] = lv_color_make(LV_CLAMP(0, r, 255), LV_CLAMP(0, g, 255), LV_CLAMP(0, b, 255));
+        }
+    }
+}
+
+#endif
+
 static int ffmpeg_decode_packet(AVCodecContext * dec, const AVPacket * pkt,
                                 struct ffmpeg_context_s * ffmpeg_ctx)
 {
@@ -729,22 +779,6 @@ static int ffmpeg_image_allocate(struct ffmpeg_context_s * ffmpeg_ctx)
 {
     int ret;
 
-    /* allocate image where the decoded image will be put */
-    ret = av_image_alloc(
-              ffmpeg_ctx->video_src_data,
-              ffmpeg_ctx->video_src_linesize,
-              ffmpeg_ctx->video_dec_ctx->width,
-              ffmpeg_ctx->video_dec_ctx->height,
-              ffmpeg_ctx->video_dec_ctx->pix_fmt,
-              4);
-
-    if(ret < 0) {
-        LV_LOG_ERROR("Could not allocate src raw video buffer");
-        return ret;
-    }
-
-    LV_LOG_INFO("alloc video_src_bufsize = %d", ret);
-
     ret = av_image_alloc(
               ffmpeg_ctx->video_dst_data,
               ffmpeg_ctx->video_dst_linesize,
@@ -780,10 +814,6 @@ static void ffmpeg_close_src_ctx(struct ffmpeg_context_s * ffmpeg_ctx)
     avcodec_free_context(&(ffmpeg_ctx->video_dec_ctx));
     avformat_close_input(&(ffmpeg_ctx->fmt_ctx));
     av_frame_free(&(ffmpeg_ctx->frame));
-    if(ffmpeg_ctx->video_src_data[0] != NULL) {
-        av_free(ffmpeg_ctx->video_src_data[0]);
-        ffmpeg_ctx->video_src_data[0] = NULL;
-    }
 }
 
 static void ffmpeg_close_dst_ctx(struct ffmpeg_context_s * ffmpeg_ctx)
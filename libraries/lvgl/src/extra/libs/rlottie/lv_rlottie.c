@@ -17,6 +17,9 @@
 #define MY_CLASS &lv_rlottie_class
 #define LV_ARGB32   32
 
+/*Skip frames if rendering takes more than this part of the frame period [%]*/
+#define RENDER_TIME_MAX_PCT 50
+
 /**********************
 *      TYPEDEFS
 **********************/
@@ -28,6 +31,10 @@
 static void lv_rlottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_rlottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void next_frame_task_cb(lv_timer_t * t);
+static void frame_cache_init(lv_rlottie_t * rlottie);
+static void frame_cache_free(lv_rlottie_t * rlottie);
+static void render_frame(lv_rlottie_t * rlottie);
+static void update_frame_step(lv_rlottie_t * rlottie);
 
 /**********************
  *  STATIC VARIABLES
@@ -146,6 +153,9 @@ static void lv_rlottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * ob
     rlottie->dest_frame = rlottie->total_frames; /* invalid destination frame so it's possible to pause on frame 0 */
 
     rlottie->task = lv_timer_create(next_frame_task_cb, 1000 / rlottie->framerate, obj);
+    rlottie->frame_step = 1;
+    rlottie->render_time = 0;
+    frame_cache_init(rlottie);
 
     lv_obj_update_layout(obj);
 }
@@ -155,6 +165,9 @@ static void lv_rlottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj
     LV_UNUSED(class_p);
     lv_rlottie_t * rlottie = (lv_rlottie_t *) obj;
 
+    /*Needs `total_frames` so free it first*/
+    frame_cache_free(rlottie);
+
     if(rlottie->animation) {
         lottie_animation_destroy(rlottie->animation);
         rlottie->animation = 0;
@@ -181,11 +194,10 @@ static void lv_rlottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj
 }
 
 #if LV_COLOR_DEPTH == 16
-static void convert_to_rgba5658(uint32_t * pix, const size_t width, const size_t height)
+static void convert_to_rgba5658(uint32_t * pix, uint8_t * dest, const size_t width, const size_t height)
 {
     /* rlottie draws in ARGB32 format, but LVGL only deal with RGB565 format with (optional 8 bit alpha channel)
-       so convert in place here the received buffer to LVGL format. */
-    uint8_t * dest = (uint8_t *)pix;
+       so convert the received buffer to LVGL format. `dest` can be `pix` to convert in place. */
     uint32_t * src = pix;
     for(size_t y = 0; y < height; y++) {
         /* Convert a 4 bytes per pixel in format ARGB to R5G6B5A8 format
@@ -237,8 +249,9 @@ static void next_frame_task_cb(lv_timer_t * t)
     }
     else {
         if((rlottie->play_ctrl & LV_RLOTTIE_CTRL_BACKWARD) == LV_RLOTTIE_CTRL_BACKWARD) {
+            /* The first frame is rendered even if it's skipped by the frame step */
             if(rlottie->current_frame > 0)
-                --rlottie->current_frame;
+                rlottie->current_frame -= LV_MIN(rlottie->current_frame, rlottie->frame_step);
             else { /* Looping ? */
                 if((rlottie->play_ctrl & LV_RLOTTIE_CTRL_LOOP) == LV_RLOTTIE_CTRL_LOOP)
                     rlottie->current_frame = rlottie->total_frames - 1;
@@ -250,8 +263,9 @@ static void next_frame_task_cb(lv_timer_t * t)
             }
         }
         else {
-            if(rlottie->current_frame < rlottie->total_frames)
-                ++rlottie->current_frame;
+            /* The last frame is rendered even if it's skipped by the frame step */
+            if(rlottie->current_frame + 1 < rlottie->total_frames)
+                rlottie->current_frame = LV_MIN(rlottie->current_frame + rlottie->frame_step, rlottie->total_frames - 1);
             else { /* Looping ? */
                 if((rlottie->play_ctrl & LV_RLOTTIE_CTRL_LOOP) == LV_RLOTTIE_CTRL_LOOP)
                     rlottie->current_frame = 0;
@@ -264,6 +278,60 @@ static void next_frame_task_cb(lv_timer_t * t)
         }
     }
 
+    render_frame(rlottie);
+    lv_obj_invalidate(obj);
+}
+
+static void frame_cache_init(lv_rlottie_t * rlottie)
+{
+    rlottie->frame_cache = NULL;
+
+#if LV_RLOTTIE_FRAME_CACHE_SIZE
+    size_t frame_size = (size_t)rlottie->imgdsc.header.w * rlottie->imgdsc.header.h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    if(rlottie->total_frames == 0 || rlottie->total_frames * frame_size > LV_RLOTTIE_FRAME_CACHE_SIZE) return;
+
+    rlottie->frame_cache = lv_mem_alloc(rlottie->total_frames * sizeof(uint8_t *));
+    if(rlottie->frame_cache) lv_memset_00(rlottie->frame_cache, rlottie->total_frames * sizeof(uint8_t *));
+#endif
+}
+
+static void frame_cache_free(lv_rlottie_t * rlottie)
+{
+    if(rlottie->frame_cache == NULL) return;
+
+    size_t i;
+    for(i = 0; i < rlottie->total_frames; i++) {
+        lv_mem_free(rlottie->frame_cache[i]);
+    }
+    lv_mem_free(rlottie->frame_cache);
+    rlottie->frame_cache = NULL;
+    rlottie->imgdsc.data = (void *)rlottie->allocated_buf;
+    lv_img_cache_invalidate_src(&rlottie->imgdsc);
+}
+
+static void render_frame(lv_rlottie_t * rlottie)
+{
+    uint8_t * cached = NULL;
+    if(rlottie->frame_cache) {
+        cached = rlottie->frame_cache[rlottie->current_frame];
+        if(cached == NULL) {
+            cached = lv_mem_alloc(rlottie->imgdsc.header.w * rlottie->imgdsc.header.h * LV_IMG_PX_SIZE_ALPHA_BYTE);
+            /*Out of memory, render every frame instead*/
+            if(cached == NULL) frame_cache_free(rlottie);
+        }
+        else {
+            /*Already converted, it costs nothing*/
+            rlottie->imgdsc.data = cached;
+            lv_img_cache_invalidate_src(&rlottie->imgdsc);
+            rlottie->render_time = rlottie->render_time * 3 / 4;
+            update_frame_step(rlottie);
+            return;
+        }
+    }
+
+    uint32_t t = lv_tick_get();
+
+#if LV_COLOR_DEPTH == 16
     lottie_animation_render(
         rlottie->animation,
         rlottie->current_frame,
@@ -272,12 +340,43 @@ static void next_frame_task_cb(lv_timer_t * t)
         rlottie->imgdsc.header.h,
         rlottie->scanline_width
     );
-
-#if LV_COLOR_DEPTH == 16
-    convert_to_rgba5658(rlottie->allocated_buf, rlottie->imgdsc.header.w, rlottie->imgdsc.header.h);
+    convert_to_rgba5658(rlottie->allocated_buf, cached ? cached : (uint8_t *)rlottie->allocated_buf,
+                        rlottie->imgdsc.header.w, rlottie->imgdsc.header.h);
+#else
+    /*The ARGB32 output of rlottie can be used as it is*/
+    lottie_animation_render(
+        rlottie->animation,
+        rlottie->current_frame,
+        cached ? (uint32_t *)cached : rlottie->allocated_buf,
+        rlottie->imgdsc.header.w,
+        rlottie->imgdsc.header.h,
+        rlottie->scanline_width
+    );
 #endif
 
-    lv_obj_invalidate(obj);
+    rlottie->render_time = (rlottie->render_time * 3 + lv_tick_elaps(t)) / 4;
+    update_frame_step(rlottie);
+
+    if(cached) {
+        rlottie->frame_cache[rlottie->current_frame] = cached;
+        rlottie->imgdsc.data = cached;
+        lv_img_cache_invalidate_src(&rlottie->imgdsc);
+    }
+}
+
+/*Step more frames at once, with a longer period, if rendering would take too much time from the UI*/
+static void update_frame_step(lv_rlottie_t * rlottie)
+{
+    uint32_t frame_period = 1000 / rlottie->framerate;
+    if(frame_period == 0) frame_period = 1;
+
+    uint32_t step = (rlottie->render_time * 100 / RENDER_TIME_MAX_PCT + frame_period - 1) / frame_period;
+    step = LV_CLAMP(1, step, LV_MAX(rlottie->total_frames / 2, 1));
+    if(step == rlottie->frame_step) return;
+
+    LV_LOG_INFO("render time %"LV_PRIu32" ms, step %"LV_PRIu32" frames", rlottie->render_time, step);
+    rlottie->frame_step = step;
+    lv_timer_set_period(rlottie->task, frame_period * step);
 }
 
 #endif /*LV_USE_RLOTTIE*/
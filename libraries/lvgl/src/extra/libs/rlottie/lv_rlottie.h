@@ -46,6 +46,9 @@ typedef struct {
     size_t scanline_width;
     lv_rlottie_ctrl_t play_ctrl;
     size_t dest_frame;
+    uint8_t ** frame_cache;     /*The converted frames if all of them fit into `LV_RLOTTIE_FRAME_CACHE_SIZE`*/
+    uint32_t render_time;       /*Average time of rendering a frame [ms]*/
+    uint32_t frame_step;        /*Number of frames to step at once to keep up with the frame rate*/
 } lv_rlottie_t;
 
 extern const lv_obj_class_t lv_rlottie_class;
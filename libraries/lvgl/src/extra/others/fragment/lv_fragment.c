@@ -83,11 +83,14 @@ lv_obj_t * lv_fragment_create_obj(lv_fragment_t * fragment, lv_obj_t * container
         states->destroying_obj = false;
     }
     const lv_fragment_class_t * cls = fragment->cls;
+    uint32_t t = lv_tick_get();
     lv_obj_t * obj = cls->create_obj_cb(fragment, container);
     LV_ASSERT_NULL(obj);
     fragment->obj = obj;
     lv_fragment_manager_create_obj(fragment->child_manager);
     if(states) {
+        states->build_time = lv_tick_elaps(t);
+        LV_LOG_INFO("objects created in %" LV_PRIu32 " ms", states->build_time);
         states->obj_created = true;
         lv_obj_add_event_cb(obj, cb_delete_assertion, LV_EVENT_DELETE, NULL);
     }
@@ -119,6 +122,7 @@ void lv_fragment_del_obj(lv_fragment_t * fragment)
     }
     if(states) {
         states->obj_created = false;
+        states->obj_cached = false;
     }
     fragment->obj = NULL;
 }
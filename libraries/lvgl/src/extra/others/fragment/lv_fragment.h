@@ -158,6 +158,18 @@ typedef struct _lv_fragment_managed_states_t  {
      * true if this fragment is in navigation stack that can be popped
      */
     bool in_stack;
+    /**
+     * true if the objects are kept hidden in the stack to show them again on pop
+     */
+    bool obj_cached;
+    /**
+     * Time of the last `create_obj_cb` with the objects of the child fragments [ms]
+     */
+    uint32_t build_time;
+    /**
+     * Approximate memory used by the objects when they were cached [bytes]
+     */
+    uint32_t obj_size;
 } lv_fragment_managed_states_t;
 
 /**********************
@@ -206,6 +218,8 @@ void lv_fragment_manager_remove(lv_fragment_manager_t * manager, lv_fragment_t *
 
 /**
  * Attach fragment to manager and add to navigation stack.
+ * With `LV_FRAGMENT_CACHE_CNT > 0` the objects of the previous top fragment are hidden instead of deleted
+ * and they are shown again when this fragment is popped.
  * @param manager Fragment manager instance
  * @param fragment Fragment instance
  * @param container Pointer to container object for manager to add objects to
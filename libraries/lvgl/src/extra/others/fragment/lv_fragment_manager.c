@@ -44,6 +44,14 @@ static void item_create_obj(lv_fragment_managed_states_t * item);
 
 static void item_del_obj(lv_fragment_managed_states_t * item);
 
+static void item_cache_obj(lv_fragment_manager_t * manager, lv_fragment_managed_states_t * item);
+
+#if LV_FRAGMENT_CACHE_CNT
+static void cache_trim(lv_fragment_manager_t * manager);
+
+static uint32_t get_obj_size(const lv_obj_t * obj);
+#endif
+
 static void item_del_fragment(lv_fragment_managed_states_t * item);
 
 static lv_fragment_managed_states_t * fragment_attach(lv_fragment_manager_t * manager, lv_fragment_t * fragment,
@@ -154,7 +162,7 @@ void lv_fragment_manager_push(lv_fragment_manager_t * manager, lv_fragment_t * f
 {
     lv_fragment_stack_item_t * top = _lv_ll_get_tail(&manager->stack);
     if(top != NULL) {
-        item_del_obj(top->states);
+        item_cache_obj(manager, top->states);
     }
     lv_fragment_managed_states_t * states = fragment_attach(manager, fragment, container);
     states->in_stack = true;
@@ -188,7 +196,7 @@ bool lv_fragment_manager_send_event(lv_fragment_manager_t * manager, int code, v
     LV_ASSERT_NULL(manager);
     lv_fragment_managed_states_t * p = NULL;
     _LV_LL_READ_BACK(&manager->attached, p) {
-        if(!p->obj_created || p->destroying_obj) continue;
+        if(!p->obj_created || p->destroying_obj || p->obj_cached) continue;
         lv_fragment_t * instance = p->instance;
         if(!instance) continue;
         if(lv_fragment_manager_send_event(instance->child_manager, code, userdata)) return true;
@@ -234,6 +242,12 @@ lv_fragment_t * lv_fragment_manager_get_parent_fragment(lv_fragment_manager_t *
 static void item_create_obj(lv_fragment_managed_states_t * item)
 {
     LV_ASSERT(item->instance);
+    /*Show the cached objects again instead of creating them*/
+    if(item->obj_cached) {
+        item->obj_cached = false;
+        lv_obj_clear_flag(item->instance->obj, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
     lv_fragment_create_obj(item->instance, item->container ? *item->container : NULL);
 }
 
@@ -242,6 +256,81 @@ static void item_del_obj(lv_fragment_managed_states_t * item)
     lv_fragment_del_obj(item->instance);
 }
 
+/**
+ * Hide the objects of a fragment leaving the top of the stack if they fit into the cache, else delete them
+ * @param manager fragment manager instance
+ * @param item fragment states
+ */
+static void item_cache_obj(lv_fragment_manager_t * manager, lv_fragment_managed_states_t * item)
+{
+#if LV_FRAGMENT_CACHE_CNT
+    lv_obj_t * obj = item->instance->obj;
+    /*Already hidden objects couldn't be told apart from the cached ones*/
+    if(item->obj_created && obj && !lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) {
+        item->obj_size = get_obj_size(obj);
+        if(item->obj_size <= LV_FRAGMENT_CACHE_SIZE) {
+            lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+            item->obj_cached = true;
+            cache_trim(manager);
+            return;
+        }
+    }
+#else
+    LV_UNUSED(manager);
+#endif
+    item_del_obj(item);
+}
+
+#if LV_FRAGMENT_CACHE_CNT
+/**
+ * Delete the cached objects deepest in the stack which exceed the limits of the cache
+ * @param manager fragment manager instance
+ */
+static void cache_trim(lv_fragment_manager_t * manager)
+{
+    uint32_t cnt = 0;
+    uint32_t size = 0;
+    lv_fragment_stack_item_t * item;
+    _LV_LL_READ_BACK(&manager->stack, item) {
+        lv_fragment_managed_states_t * states = item->states;
+        if(!states->obj_cached) continue;
+
+        if(cnt < LV_FRAGMENT_CACHE_CNT && size + states->obj_size <= LV_FRAGMENT_CACHE_SIZE) {
+            cnt++;
+            size += states->obj_size;
+        }
+        else {
+            item_del_obj(states);
+        }
+    }
+}
+
+/**
+ * Estimate the memory used by an object and its children.
+ * The data allocated by the widgets themselves (e.g. the text of the labels) is not counted.
+ * @param obj pointer to an object
+ * @return the approximate size in bytes
+ */
+static uint32_t get_obj_size(const lv_obj_t * obj)
+{
+    /*Find a base in which instance size is set*/
+    const lv_obj_class_t * base = obj->class_p;
+    while(base && base->instance_size == 0) base = base->base_class;
+
+    uint32_t size = base ? base->instance_size : sizeof(lv_obj_t);
+    size += obj->style_cnt * sizeof(_lv_obj_style_t);
+    if(obj->spec_attr) {
+        size += sizeof(_lv_obj_spec_attr_t);
+        uint32_t i;
+        for(i = 0; i < obj->spec_attr->child_cnt; i++) {
+            size += sizeof(lv_obj_t *) + get_obj_size(obj->spec_attr->children[i]);
+        }
+    }
+
+    return size;
+}
+#endif
+
 /**
  * Detach, then destroy fragment
  * @param item fragment states
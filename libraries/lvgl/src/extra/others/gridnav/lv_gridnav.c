@@ -16,15 +16,11 @@
 /*********************
  *      DEFINES
  *********************/
+#define NODE_NONE   UINT16_MAX
 
 /**********************
  *      TYPEDEFS
  **********************/
-typedef struct {
-    lv_gridnav_ctrl_t ctrl;
-    lv_obj_t * focused_obj;
-} lv_gridnav_dsc_t;
-
 typedef enum {
     FIND_LEFT,
     FIND_RIGHT,
@@ -34,13 +30,45 @@ typedef enum {
     FIND_PREV_ROW_LAST_ITEM,
     FIND_FIRST_ROW,
     FIND_LAST_ROW,
+    _FIND_MODE_CNT,
 } find_mode_t;
 
+/*A focusable child and the index of the child to focus from it in each find mode*/
+typedef struct {
+    lv_obj_t * obj;
+    uint16_t next[_FIND_MODE_CNT];
+} gridnav_node_t;
+
+/*Position of a child used to find its neighbors*/
+typedef struct {
+    lv_coord_t x_center;
+    lv_coord_t y_center;
+    lv_coord_t x;           /*Distance from the left side of the content*/
+    lv_coord_t y;           /*Distance from the top side of the content*/
+    lv_coord_t right;       /*Distance from the right side of the content*/
+    lv_coord_t h_half;
+} child_pos_t;
+
+typedef struct {
+    lv_gridnav_ctrl_t ctrl;
+    lv_obj_t * focused_obj;
+    gridnav_node_t * nodes;     /*Navigation graph of the focusable children, NULL if it needs to be built*/
+    uint16_t node_cnt;
+    uint16_t focused_node;      /*Index of `focused_obj` in `nodes`*/
+} lv_gridnav_dsc_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void gridnav_event_cb(lv_event_t * e);
-static lv_obj_t * find_chid(lv_obj_t * obj, lv_obj_t * start_child, find_mode_t mode);
+static lv_obj_t * find_chid(lv_obj_t * obj, lv_gridnav_dsc_t * dsc, find_mode_t mode);
+static lv_obj_t * find_chid_scan(lv_obj_t * obj, lv_obj_t * start_child, find_mode_t mode);
+static void get_child_pos(lv_obj_t * obj, lv_obj_t * child, child_pos_t * pos);
+static bool get_err(const child_pos_t * start, const child_pos_t * child, find_mode_t mode, lv_coord_t h_max,
+                    int32_t * err);
+static bool graph_build(lv_obj_t * obj, lv_gridnav_dsc_t * dsc);
+static bool graph_is_valid(lv_obj_t * obj, lv_gridnav_dsc_t * dsc);
+static void graph_invalidate(lv_gridnav_dsc_t * dsc);
 static lv_obj_t * find_first_focusable(lv_obj_t * obj);
 static lv_obj_t * find_last_focusable(lv_obj_t * obj);
 static bool obj_is_focuable(lv_obj_t * obj);
@@ -67,6 +95,9 @@ void lv_gridnav_add(lv_obj_t * obj, lv_gridnav_ctrl_t ctrl)
     LV_ASSERT_MALLOC(dsc);
     dsc->ctrl = ctrl;
     dsc->focused_obj = NULL;
+    dsc->nodes = NULL;
+    dsc->node_cnt = 0;
+    dsc->focused_node = NODE_NONE;
     lv_obj_add_event_cb(obj, gridnav_event_cb, LV_EVENT_ALL, dsc);
 
     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLL_WITH_ARROW);
@@ -77,6 +108,7 @@ void lv_gridnav_remove(lv_obj_t * obj)
     lv_gridnav_dsc_t * dsc = lv_obj_get_event_user_data(obj, gridnav_event_cb);
     if(dsc == NULL) return; /* no gridnav on this object */
 
+    graph_invalidate(dsc);
     lv_mem_free(dsc);
     lv_obj_remove_event_cb(obj, gridnav_event_cb);
 }
@@ -130,10 +162,10 @@ static void gridnav_event_cb(lv_event_t * e)
                 lv_obj_scroll_by_bounded(dsc->focused_obj, -d, 0, LV_ANIM_ON);
             }
             else {
-                guess = find_chid(obj, dsc->focused_obj, FIND_RIGHT);
+                guess = find_chid(obj, dsc, FIND_RIGHT);
                 if(guess == NULL) {
                     if(dsc->ctrl & LV_GRIDNAV_CTRL_ROLLOVER) {
-                        guess = find_chid(obj, dsc->focused_obj, FIND_NEXT_ROW_FIRST_ITEM);
+                        guess = find_chid(obj, dsc, FIND_NEXT_ROW_FIRST_ITEM);
                         if(guess == NULL) guess = find_first_focusable(obj);
                     }
                     else {
@@ -150,10 +182,10 @@ static void gridnav_event_cb(lv_event_t * e)
                 lv_obj_scroll_by_bounded(dsc->focused_obj, d, 0, LV_ANIM_ON);
             }
             else {
-                guess = find_chid(obj, dsc->focused_obj, FIND_LEFT);
+                guess = find_chid(obj, dsc, FIND_LEFT);
                 if(guess == NULL) {
                     if(dsc->ctrl & LV_GRIDNAV_CTRL_ROLLOVER) {
-                        guess = find_chid(obj, dsc->focused_obj, FIND_PREV_ROW_LAST_ITEM);
+                        guess = find_chid(obj, dsc, FIND_PREV_ROW_LAST_ITEM);
                         if(guess == NULL) guess = find_last_focusable(obj);
                     }
                     else {
@@ -170,10 +202,10 @@ static void gridnav_event_cb(lv_event_t * e)
                 lv_obj_scroll_by_bounded(dsc->focused_obj, 0, -d, LV_ANIM_ON);
             }
             else {
-                guess = find_chid(obj, dsc->focused_obj, FIND_BOTTOM);
+                guess = find_chid(obj, dsc, FIND_BOTTOM);
                 if(guess == NULL) {
                     if(dsc->ctrl & LV_GRIDNAV_CTRL_ROLLOVER) {
-                        guess = find_chid(obj, dsc->focused_obj, FIND_FIRST_ROW);
+                        guess = find_chid(obj, dsc, FIND_FIRST_ROW);
                     }
                     else {
                         lv_group_focus_next(lv_obj_get_group(obj));
@@ -189,10 +221,10 @@ static void gridnav_event_cb(lv_event_t * e)
                 lv_obj_scroll_by_bounded(dsc->focused_obj, 0, d, LV_ANIM_ON);
             }
             else {
-                guess = find_chid(obj, dsc->focused_obj, FIND_TOP);
+                guess = find_chid(obj, dsc, FIND_TOP);
                 if(guess == NULL) {
                     if(dsc->ctrl & LV_GRIDNAV_CTRL_ROLLOVER) {
-                        guess = find_chid(obj, dsc->focused_obj, FIND_LAST_ROW);
+                        guess = find_chid(obj, dsc, FIND_LAST_ROW);
                     }
                     else {
                         lv_group_focus_prev(lv_obj_get_group(obj));
@@ -245,8 +277,13 @@ static void gridnav_event_cb(lv_event_t * e)
         lv_obj_t * target = lv_event_get_target(e);
         if(target == obj) {
             dsc->focused_obj = find_first_focusable(obj);
+            graph_invalidate(dsc);
         }
     }
+    else if(code == LV_EVENT_CHILD_CHANGED || code == LV_EVENT_SIZE_CHANGED) {
+        /*A child was added, moved, resized or the layout of the children changed*/
+        if(lv_event_get_target(e) == obj) graph_invalidate(dsc);
+    }
     else if(code == LV_EVENT_DELETE) {
         lv_gridnav_remove(obj);
     }
@@ -263,76 +300,218 @@ static void gridnav_event_cb(lv_event_t * e)
     }
 }
 
-static lv_obj_t * find_chid(lv_obj_t * obj, lv_obj_t * start_child, find_mode_t mode)
+/**
+ * Find the child to focus next using the navigation graph.
+ * The graph is built only after the children changed, so a key press takes only a pass over the flags of the children.
+ */
+static lv_obj_t * find_chid(lv_obj_t * obj, lv_gridnav_dsc_t * dsc, find_mode_t mode)
 {
-    lv_coord_t x_start = get_x_center(start_child);
-    lv_coord_t y_start = get_y_center(start_child);
+    if(dsc->nodes && !graph_is_valid(obj, dsc)) graph_invalidate(dsc);
+    if(dsc->nodes == NULL && !graph_build(obj, dsc)) {
+        return find_chid_scan(obj, dsc->focused_obj, mode);
+    }
+
+    /*The focused object was set without a key (e.g. by `lv_gridnav_set_focused`)*/
+    if(dsc->focused_node >= dsc->node_cnt || dsc->nodes[dsc->focused_node].obj != dsc->focused_obj) {
+        uint16_t i;
+        for(i = 0; i < dsc->node_cnt; i++) {
+            if(dsc->nodes[i].obj == dsc->focused_obj) break;
+        }
+        /*The focused object is not focusable anymore (e.g. it was hidden)*/
+        if(i == dsc->node_cnt) return find_chid_scan(obj, dsc->focused_obj, mode);
+        dsc->focused_node = i;
+    }
+
+    uint16_t next = dsc->nodes[dsc->focused_node].next[mode];
+    if(next == NODE_NONE) return NULL;
+
+    dsc->focused_node = next;
+    return dsc->nodes[next].obj;
+}
+
+/**
+ * Find the child to focus next by checking all the children
+ */
+static lv_obj_t * find_chid_scan(lv_obj_t * obj, lv_obj_t * start_child, find_mode_t mode)
+{
+    child_pos_t start_pos;
+    get_child_pos(obj, start_child, &start_pos);
+    lv_coord_t h_max = lv_obj_get_height(obj) + lv_obj_get_scroll_top(obj) + lv_obj_get_scroll_bottom(obj);
     uint32_t child_cnt = lv_obj_get_child_cnt(obj);
     lv_obj_t * guess = NULL;
-    lv_coord_t x_err_guess = LV_COORD_MAX;
-    lv_coord_t y_err_guess = LV_COORD_MAX;
-    lv_coord_t h_half = lv_obj_get_height(start_child) / 2;
-    lv_coord_t h_max = lv_obj_get_height(obj) + lv_obj_get_scroll_top(obj) + lv_obj_get_scroll_bottom(obj);
+    int32_t err_guess = INT32_MAX;
     uint32_t i;
     for(i = 0; i < child_cnt; i++) {
         lv_obj_t * child = lv_obj_get_child(obj, i);
         if(child == start_child) continue;
         if(obj_is_focuable(child) == false) continue;
 
-        lv_coord_t x_err = 0;
-        lv_coord_t y_err = 0;
-        switch(mode) {
-            case FIND_LEFT:
-                x_err = get_x_center(child) - x_start;
-                y_err = get_y_center(child) - y_start;
-                if(x_err >= 0) continue;    /*It's on the right*/
-                if(LV_ABS(y_err) > h_half) continue;    /*Too far*/
-                break;
-            case FIND_RIGHT:
-                x_err = get_x_center(child) - x_start;
-                y_err = get_y_center(child) - y_start;
-                if(x_err <= 0) continue;    /*It's on the left*/
-                if(LV_ABS(y_err) > h_half) continue;    /*Too far*/
-                break;
-            case FIND_TOP:
-                x_err = get_x_center(child) - x_start;
-                y_err = get_y_center(child) - y_start;
-                if(y_err >= 0) continue;    /*It's on the bottom*/
-                break;
-            case FIND_BOTTOM:
-                x_err = get_x_center(child) - x_start;
-                y_err = get_y_center(child) - y_start;
-                if(y_err <= 0) continue;    /*It's on the top*/
-                break;
-            case FIND_NEXT_ROW_FIRST_ITEM:
-                y_err = get_y_center(child) - y_start;
-                if(y_err <= 0) continue;    /*It's on the top*/
-                x_err = lv_obj_get_x(child);
-                break;
-            case FIND_PREV_ROW_LAST_ITEM:
-                y_err = get_y_center(child) - y_start;
-                if(y_err >= 0) continue;    /*It's on the bottom*/
-                x_err = obj->coords.x2 - child->coords.x2;
-                break;
-            case FIND_FIRST_ROW:
-                x_err = get_x_center(child) - x_start;
-                y_err = lv_obj_get_y(child);
-                break;
-            case FIND_LAST_ROW:
-                x_err = get_x_center(child) - x_start;
-                y_err = h_max - lv_obj_get_y(child);
-        }
+        child_pos_t pos;
+        get_child_pos(obj, child, &pos);
+        int32_t err;
+        if(!get_err(&start_pos, &pos, mode, h_max, &err)) continue;
 
-        if(guess == NULL ||
-           (y_err * y_err + x_err * x_err < y_err_guess * y_err_guess + x_err_guess * x_err_guess)) {
+        if(guess == NULL || err < err_guess) {
             guess = child;
-            x_err_guess  = x_err;
-            y_err_guess  = y_err;
+            err_guess = err;
         }
     }
     return guess;
 }
 
+static bool graph_build(lv_obj_t * obj, lv_gridnav_dsc_t * dsc)
+{
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    uint32_t node_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        if(obj_is_focuable(lv_obj_get_child(obj, i))) node_cnt++;
+    }
+
+    if(node_cnt == 0 || node_cnt >= NODE_NONE) return false;
+
+    /*Not an error, the children will be scanned on every key press*/
+    gridnav_node_t * nodes = lv_mem_alloc(node_cnt * sizeof(gridnav_node_t));
+    child_pos_t * pos = lv_mem_alloc(node_cnt * sizeof(child_pos_t));
+    if(nodes == NULL || pos == NULL) {
+        if(nodes) lv_mem_free(nodes);
+        if(pos) lv_mem_free(pos);
+        return false;
+    }
+
+    uint32_t n = 0;
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = lv_obj_get_child(obj, i);
+        if(obj_is_focuable(child)) {
+            nodes[n].obj = child;
+            get_child_pos(obj, child, &pos[n]);
+            n++;
+        }
+    }
+
+    /*The same search as `find_chid_scan` for all the children and find modes at once*/
+    lv_coord_t h_max = lv_obj_get_height(obj) + lv_obj_get_scroll_top(obj) + lv_obj_get_scroll_bottom(obj);
+    for(n = 0; n < node_cnt; n++) {
+        int32_t err_guess[_FIND_MODE_CNT];
+        uint32_t mode;
+        for(mode = 0; mode < _FIND_MODE_CNT; mode++) nodes[n].next[mode] = NODE_NONE;
+
+        for(i = 0; i < node_cnt; i++) {
+            if(i == n) continue;
+            for(mode = 0; mode < _FIND_MODE_CNT; mode++) {
+                int32_t err;
+                if(!get_err(&pos[n], &pos[i], mode, h_max, &err)) continue;
+                if(nodes[n].next[mode] == NODE_NONE || err < err_guess[mode]) {
+                    nodes[n].next[mode] = i;
+                    err_guess[mode] = err;
+                }
+            }
+        }
+    }
+
+    lv_mem_free(pos);
+    dsc->nodes = nodes;
+    dsc->node_cnt = node_cnt;
+    dsc->focused_node = NODE_NONE;
+    return true;
+}
+
+/**
+ * Check if the graph has exactly the focusable children.
+ * Changing the flags sends no events, so a child might have become focusable or not focusable since the build.
+ */
+static bool graph_is_valid(lv_obj_t * obj, lv_gridnav_dsc_t * dsc)
+{
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    uint32_t n = 0;
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = lv_obj_get_child(obj, i);
+        if(obj_is_focuable(child) == false) continue;
+        /*The nodes are in the order of the children*/
+        if(n == dsc->node_cnt || dsc->nodes[n].obj != child) return false;
+        n++;
+    }
+    return n == dsc->node_cnt;
+}
+
+static void graph_invalidate(lv_gridnav_dsc_t * dsc)
+{
+    if(dsc->nodes) lv_mem_free(dsc->nodes);
+    dsc->nodes = NULL;
+    dsc->node_cnt = 0;
+    dsc->focused_node = NODE_NONE;
+}
+
+static void get_child_pos(lv_obj_t * obj, lv_obj_t * child, child_pos_t * pos)
+{
+    pos->x_center = get_x_center(child);
+    pos->y_center = get_y_center(child);
+    pos->x = lv_obj_get_x(child);
+    pos->y = lv_obj_get_y(child);
+    /*Measured in the content so it doesn't depend on scrolling*/
+    pos->right = obj->coords.x2 - child->coords.x2 - lv_obj_get_scroll_x(obj);
+    pos->h_half = lv_obj_get_height(child) / 2;
+}
+
+/**
+ * Get the squared distance of a child from the start child in a find mode
+ * @return false if the child can't be found in this mode
+ */
+static bool get_err(const child_pos_t * start, const child_pos_t * child, find_mode_t mode, lv_coord_t h_max,
+                    int32_t * err)
+{
+    int32_t x_err = 0;
+    int32_t y_err = 0;
+    switch(mode) {
+        case FIND_LEFT:
+            x_err = child->x_center - start->x_center;
+            y_err = child->y_center - start->y_center;
+            if(x_err >= 0) return false;    /*It's on the right*/
+            if(LV_ABS(y_err) > start->h_half) return false;    /*Too far*/
+            break;
+        case FIND_RIGHT:
+            x_err = child->x_center - start->x_center;
+            y_err = child->y_center - start->y_center;
+            if(x_err <= 0) return false;    /*It's on the left*/
+            if(LV_ABS(y_err) > start->h_half) return false;    /*Too far*/
+            break;
+        case FIND_TOP:
+            x_err = child->x_center - start->x_center;
+            y_err = child->y_center - start->y_center;
+            if(y_err >= 0) return false;    /*It's on the bottom*/
+            break;
+        case FIND_BOTTOM:
+            x_err = child->x_center - start->x_center;
+            y_err = child->y_center - start->y_center;
+            if(y_err <= 0) return false;    /*It's on the top*/
+            break;
+        case FIND_NEXT_ROW_FIRST_ITEM:
+            y_err = child->y_center - start->y_center;
+            if(y_err <= 0) return false;    /*It's on the top*/
+            x_err = child->x;
+            break;
+        case FIND_PREV_ROW_LAST_ITEM:
+            y_err = child->y_center - start->y_center;
+            if(y_err >= 0) return false;    /*It's on the bottom*/
+            x_err = child->right;
+            break;
+        case FIND_FIRST_ROW:
+            x_err = child->x_center - start->x_center;
+            y_err = child->y;
+            break;
+        case FIND_LAST_ROW:
+            x_err = child->x_center - start->x_center;
+            y_err = h_max - child->y;
+            break;
+        default:
+            return false;
+    }
+
+    *err = y_err * y_err + x_err * x_err;
+    return true;
+}
+
 static lv_obj_t * find_first_focusable(lv_obj_t * obj)
 {
     uint32_t child_cnt = lv_obj_get_child_cnt(obj);
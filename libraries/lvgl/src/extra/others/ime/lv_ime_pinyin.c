@@ -32,6 +32,7 @@ static void lv_ime_pinyin_cand_panel_event(lv_event_t * e);
 static void init_pinyin_dict(lv_obj_t * obj, lv_pinyin_dict_t * dict);
 static void pinyin_input_proc(lv_obj_t * obj);
 static void pinyin_page_proc(lv_obj_t * obj, uint16_t btn);
+static lv_pinyin_dict_t * pinyin_search_prefix(lv_obj_t * obj, const char * py_str);
 static char * pinyin_search_matching(lv_obj_t * obj, char * py_str, uint16_t * cand_num);
 static void pinyin_ime_clear_data(lv_obj_t * obj);
 
@@ -57,14 +58,14 @@ const lv_obj_class_t lv_ime_pinyin_class = {
 };
 
 #if LV_IME_PINYIN_USE_K9_MODE
-static char * lv_btnm_def_pinyin_k9_map[LV_IME_PINYIN_K9_CAND_TEXT_NUM + 20] = {\
+static char * lv_btnm_def_pinyin_k9_map[LV_IME_PINYIN_K9_CAND_TEXT_NUM + 21] = {\
                                                                                 ",\0", "1#\0",  "abc \0", "def\0",  LV_SYMBOL_BACKSPACE"\0", "\n\0",
                                                                                 ".\0", "ghi\0", "jkl\0", "mno\0",  LV_SYMBOL_KEYBOARD"\0", "\n\0",
                                                                                 "?\0", "pqrs\0", "tuv\0", "wxyz\0",  LV_SYMBOL_NEW_LINE"\0", "\n\0",
                                                                                 LV_SYMBOL_LEFT"\0", "\0"
                                                                                };
 
-static lv_btnmatrix_ctrl_t default_kb_ctrl_k9_map[LV_IME_PINYIN_K9_CAND_TEXT_NUM + 16] = { 1 };
+static lv_btnmatrix_ctrl_t default_kb_ctrl_k9_map[LV_IME_PINYIN_K9_CAND_TEXT_NUM + 17] = { 1 };
 static char   lv_pinyin_k9_cand_str[LV_IME_PINYIN_K9_CAND_TEXT_NUM + 2][LV_IME_PINYIN_K9_MAX_INPUT] = {0};
 #endif
 
@@ -465,8 +466,8 @@ void lv_ime_pinyin_set_mode(lv_obj_t * obj, lv_ime_pinyin_mode_t mode)
 #if LV_IME_PINYIN_USE_K9_MODE
     if(pinyin_ime->mode == LV_IME_PINYIN_MODE_K9) {
         pinyin_k9_init_data(obj);
-        lv_keyboard_set_map(pinyin_ime->kb, LV_KEYBOARD_MODE_USER_1, (const char *)lv_btnm_def_pinyin_k9_map,
-                            (const)default_kb_ctrl_k9_map);
+        lv_keyboard_set_map(pinyin_ime->kb, LV_KEYBOARD_MODE_USER_1, (const char **)lv_btnm_def_pinyin_k9_map,
+                            default_kb_ctrl_k9_map);
         lv_keyboard_set_mode(pinyin_ime->kb, LV_KEYBOARD_MODE_USER_1);
     }
 #endif
@@ -557,8 +558,8 @@ static void lv_ime_pinyin_constructor(const lv_obj_class_t * class_p, lv_obj_t *
     pinyin_ime->ta_count = 0;
     pinyin_ime->cand_num = 0;
     lv_memset_00(pinyin_ime->input_char, sizeof(pinyin_ime->input_char));
-    lv_memset_00(pinyin_ime->py_num, sizeof(pinyin_ime->py_num));
-    lv_memset_00(pinyin_ime->py_pos, sizeof(pinyin_ime->py_pos));
+    pinyin_ime->dict_index = NULL;
+    pinyin_ime->dict_cnt = 0;
 
     lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
 
@@ -625,6 +626,12 @@ static void lv_ime_pinyin_destructor(const lv_obj_class_t * class_p, lv_obj_t *
 
     if(lv_obj_is_valid(pinyin_ime->cand_panel))
         lv_obj_del(pinyin_ime->cand_panel);
+
+    lv_mem_free(pinyin_ime->dict_index);
+
+#if LV_IME_PINYIN_USE_K9_MODE
+    _lv_ll_clear(&pinyin_ime->k9_legal_py_ll);
+#endif
 }
 
 static void lv_ime_pinyin_kb_event(lv_event_t * e)
@@ -712,10 +719,10 @@ static void lv_ime_pinyin_kb_event(lv_event_t * e)
         }
         else if(strcmp(txt, LV_SYMBOL_KEYBOARD) == 0) {
             if(pinyin_ime->mode == LV_IME_PINYIN_MODE_K26) {
-                lv_ime_pinyin_set_mode(pinyin_ime, LV_IME_PINYIN_MODE_K9);
+                lv_ime_pinyin_set_mode(obj, LV_IME_PINYIN_MODE_K9);
             }
             else {
-                lv_ime_pinyin_set_mode(pinyin_ime, LV_IME_PINYIN_MODE_K26);
+                lv_ime_pinyin_set_mode(obj, LV_IME_PINYIN_MODE_K26);
                 lv_keyboard_set_mode(pinyin_ime->kb, LV_KEYBOARD_MODE_TEXT_LOWER);
             }
             pinyin_ime_clear_data(obj);
@@ -867,71 +874,72 @@ static void init_pinyin_dict(lv_obj_t * obj, lv_pinyin_dict_t * dict)
 {
     lv_ime_pinyin_t * pinyin_ime = (lv_ime_pinyin_t *)obj;
 
-    char headletter = 'a';
-    uint16_t offset_sum = 0;
-    uint16_t offset_count = 0;
-    uint16_t letter_calc = 0;
-
     pinyin_ime->dict = dict;
+    lv_mem_free(pinyin_ime->dict_index);
+    pinyin_ime->dict_index = NULL;
 
-    for(uint16_t i = 0; ; i++) {
-        if((NULL == (dict[i].py)) || (NULL == (dict[i].py_mb))) {
-            headletter = dict[i - 1].py[0];
-            letter_calc = headletter - 'a';
-            pinyin_ime->py_num[letter_calc] = offset_count;
-            break;
-        }
+    uint16_t i;
+    bool sorted = true;
+    for(i = 0; (dict[i].py != NULL) && (dict[i].py_mb != NULL); i++) {
+        if(i > 0 && strcmp(dict[i - 1].py, dict[i].py) > 0) sorted = false;
+    }
+    pinyin_ime->dict_cnt = i;
 
-        if(headletter == (dict[i].py[0])) {
-            offset_count++;
-        }
-        else {
-            headletter = dict[i].py[0];
-            letter_calc = headletter - 'a';
-            pinyin_ime->py_num[letter_calc - 1] = offset_count;
-            offset_sum += offset_count;
-            pinyin_ime->py_pos[letter_calc] = offset_sum;
+    /*Sorted dictionaries can be searched directly*/
+    if(sorted) return;
 
-            offset_count = 1;
+    pinyin_ime->dict_index = lv_mem_alloc(pinyin_ime->dict_cnt * sizeof(uint16_t));
+    LV_ASSERT_MALLOC(pinyin_ime->dict_index);
+    if(pinyin_ime->dict_index == NULL) {
+        pinyin_ime->dict_cnt = 0;
+        return;
+    }
+
+    /*Insertion sort, as the dictionaries are usually sorted at least by the first letter.
+     *It's stable so the first of the equal Pinyins is found.*/
+    for(i = 0; i < pinyin_ime->dict_cnt; i++) {
+        uint16_t j = i;
+        while(j > 0 && strcmp(dict[pinyin_ime->dict_index[j - 1]].py, dict[i].py) > 0) {
+            pinyin_ime->dict_index[j] = pinyin_ime->dict_index[j - 1];
+            j--;
         }
+        pinyin_ime->dict_index[j] = i;
     }
 }
 
-static char * pinyin_search_matching(lv_obj_t * obj, char * py_str, uint16_t * cand_num)
+/*Binary search the first dictionary entry in alphabetical order which starts with `py_str`*/
+static lv_pinyin_dict_t * pinyin_search_prefix(lv_obj_t * obj, const char * py_str)
 {
     lv_ime_pinyin_t * pinyin_ime = (lv_ime_pinyin_t *)obj;
 
-    lv_pinyin_dict_t * cpHZ;
-    uint8_t index, len = 0, offset;
-    volatile uint8_t count = 0;
+    size_t len = strlen(py_str);
+    if(len == 0) return NULL;
 
-    if(*py_str == '\0')    return NULL;
-    if(*py_str == 'i')     return NULL;
-    if(*py_str == 'u')     return NULL;
-    if(*py_str == 'v')     return NULL;
+    uint16_t min = 0;
+    uint16_t max = pinyin_ime->dict_cnt;
+    while(min < max) {
+        uint16_t mid = min + (max - min) / 2;
+        uint16_t id = pinyin_ime->dict_index ? pinyin_ime->dict_index[mid] : mid;
+        if(strncmp(pinyin_ime->dict[id].py, py_str, len) < 0) min = mid + 1;
+        else max = mid;
+    }
 
-    offset = py_str[0] - 'a';
-    len = strlen(py_str);
+    if(min == pinyin_ime->dict_cnt) return NULL;
 
-    cpHZ  = &pinyin_ime->dict[pinyin_ime->py_pos[offset]];
-    count = pinyin_ime->py_num[offset];
+    lv_pinyin_dict_t * cpHZ = &pinyin_ime->dict[pinyin_ime->dict_index ? pinyin_ime->dict_index[min] : min];
+    if(strncmp(cpHZ->py, py_str, len) != 0) return NULL;
 
-    while(count--) {
-        for(index = 0; index < len; index++) {
-            if(*(py_str + index) != *((cpHZ->py) + index)) {
-                break;
-            }
-        }
+    return cpHZ;
+}
 
-        // perfect match
-        if(len == 1 || index == len) {
-            // The Chinese character in UTF-8 encoding format is 3 bytes
-            * cand_num = strlen((const char *)(cpHZ->py_mb)) / 3;
-            return (char *)(cpHZ->py_mb);
-        }
-        cpHZ++;
-    }
-    return NULL;
+static char * pinyin_search_matching(lv_obj_t * obj, char * py_str, uint16_t * cand_num)
+{
+    lv_pinyin_dict_t * cpHZ = pinyin_search_prefix(obj, py_str);
+    if(cpHZ == NULL) return NULL;
+
+    // The Chinese character in UTF-8 encoding format is 3 bytes
+    * cand_num = strlen((const char *)(cpHZ->py_mb)) / 3;
+    return (char *)(cpHZ->py_mb);
 }
 
 static void pinyin_ime_clear_data(lv_obj_t * obj)
@@ -1000,10 +1008,10 @@ static void pinyin_k9_get_legal_py(lv_obj_t * obj, char * k9_input, const char *
     }
 
     char py_comp[LV_IME_PINYIN_K9_MAX_INPUT] = {0};
-    int mark[LV_IME_PINYIN_K9_MAX_INPUT] = {0};
+    uint32_t mark[LV_IME_PINYIN_K9_MAX_INPUT] = {0};
     int index = 0;
-    int flag = 0;
-    int count = 0;
+    uint32_t flag = 0;
+    uint32_t count = 0;
 
     uint32_t ll_len = 0;
     ime_pinyin_k9_py_str_t * ll_index = NULL;
@@ -1013,25 +1021,26 @@ static void pinyin_k9_get_legal_py(lv_obj_t * obj, char * k9_input, const char *
 
     while(index != -1) {
         if(index == len) {
-            if(pinyin_k9_is_valid_py(obj, py_comp)) {
-                if((count >= ll_len) || (ll_len == 0)) {
-                    ll_index = _lv_ll_ins_tail(&pinyin_ime->k9_legal_py_ll);
-                    strcpy(ll_index->py_str, py_comp);
-                }
-                else if((count < ll_len)) {
-                    strcpy(ll_index->py_str, py_comp);
-                    ll_index = _lv_ll_get_next(&pinyin_ime->k9_legal_py_ll, ll_index);
-                }
-                count++;
+            /*Every prefix was checked so it's a valid Pinyin*/
+            if((count >= ll_len) || (ll_len == 0)) {
+                ll_index = _lv_ll_ins_tail(&pinyin_ime->k9_legal_py_ll);
+                strcpy(ll_index->py_str, py_comp);
+            }
+            else if((count < ll_len)) {
+                strcpy(ll_index->py_str, py_comp);
+                ll_index = _lv_ll_get_next(&pinyin_ime->k9_legal_py_ll, ll_index);
             }
+            count++;
             index--;
         }
         else {
             flag = mark[index];
             if(flag < strlen(py9_map[k9_input[index] - '2'])) {
                 py_comp[index] = py9_map[k9_input[index] - '2'][flag];
+                py_comp[index + 1] = '\0';
                 mark[index] = mark[index] + 1;
-                index++;
+                /*Skip the letters with which no Pinyin starts, no longer ones can be valid either*/
+                if(pinyin_k9_is_valid_py(obj, py_comp)) index++;
             }
             else {
                 mark[index] = 0;
@@ -1049,38 +1058,7 @@ static void pinyin_k9_get_legal_py(lv_obj_t * obj, char * k9_input, const char *
 /*true: visible; false: not visible*/
 static bool pinyin_k9_is_valid_py(lv_obj_t * obj, char * py_str)
 {
-    lv_ime_pinyin_t * pinyin_ime = (lv_ime_pinyin_t *)obj;
-
-    lv_pinyin_dict_t * cpHZ = NULL;
-    uint8_t index = 0, len = 0, offset = 0;
-    uint16_t ret = 1;
-    volatile uint8_t count = 0;
-
-    if(*py_str == '\0')    return false;
-    if(*py_str == 'i')     return false;
-    if(*py_str == 'u')     return false;
-    if(*py_str == 'v')     return false;
-
-    offset = py_str[0] - 'a';
-    len = strlen(py_str);
-
-    cpHZ  = &pinyin_ime->dict[pinyin_ime->py_pos[offset]];
-    count = pinyin_ime->py_num[offset];
-
-    while(count--) {
-        for(index = 0; index < len; index++) {
-            if(*(py_str + index) != *((cpHZ->py) + index)) {
-                break;
-            }
-        }
-
-        // perfect match
-        if(len == 1 || index == len) {
-            return true;
-        }
-        cpHZ++;
-    }
-    return false;
+    return pinyin_search_prefix(obj, py_str) != NULL;
 }
 
 static void pinyin_k9_fill_cand(lv_obj_t * obj)
@@ -59,8 +59,8 @@ typedef struct {
     uint16_t ta_count;          /* The number of characters entered in the text box this time */
     uint16_t cand_num;          /* Number of candidates */
     uint16_t py_page;           /* Current pinyin map pages(k26) */
-    uint16_t py_num[26];        /* Number and length of Pinyin */
-    uint16_t py_pos[26];        /* Pinyin position */
+    uint16_t * dict_index;      /* Dictionary entries sorted by Pinyin, NULL if the dictionary is sorted */
+    uint16_t dict_cnt;          /* Number of dictionary entries */
     uint8_t  mode : 1;          /* Set mode, 1: 26-key input(k26), 0: 9-key input(k9). Default: 1. */
 } lv_ime_pinyin_t;
 
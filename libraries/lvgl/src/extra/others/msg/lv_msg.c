@@ -11,34 +11,58 @@
 
 #include "../../../misc/lv_assert.h"
 #include "../../../misc/lv_ll.h"
+#include "../../../misc/lv_timer.h"
 
 /*********************
  *      DEFINES
  *********************/
+/*Number of hash buckets the subscriptions are distributed in by message ID*/
+#define SUB_BUCKET_CNT  32
 
 /**********************
  *      TYPEDEFS
  **********************/
 
-typedef struct {
+struct _obj_subs_t;
+
+typedef struct _sub_dsc_t {
     uint32_t msg_id;
     lv_msg_subscribe_cb_t callback;
     void * user_data;
     void * _priv_data;      /*Internal: used only store 'obj' in lv_obj_subscribe*/
+    struct _obj_subs_t * obj_subs;  /*Subscriptions of the same object, set only by `lv_msg_subsribe_obj`*/
+    struct _sub_dsc_t * obj_prev;
+    struct _sub_dsc_t * obj_next;
 } sub_dsc_t;
 
+/*Stored as the user data of the delete event to find the subscriptions of an object*/
+typedef struct _obj_subs_t {
+    lv_obj_t * obj;
+    sub_dsc_t * head;
+} obj_subs_t;
+
+typedef struct {
+    uint32_t msg_id;
+    const void * payload;
+} post_dsc_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
+static lv_ll_t * get_bucket(uint32_t msg_id);
 static void notify(lv_msg_t * m);
+static void remove_sub(sub_dsc_t * s);
 static void obj_notify_cb(void * s, lv_msg_t * m);
 static void obj_delete_event_cb(lv_event_t * e);
+static void post_timer_cb(lv_timer_t * t);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
-static lv_ll_t subs_ll;
+static lv_ll_t subs_ll[SUB_BUCKET_CNT];
+static lv_ll_t post_ll;
+static lv_timer_t * post_timer;
 
 /**********************
  *  GLOBAL VARIABLES
@@ -56,12 +80,18 @@ lv_event_code_t LV_EVENT_MSG_RECEIVED;
 void lv_msg_init(void)
 {
     LV_EVENT_MSG_RECEIVED = lv_event_register_id();
-    _lv_ll_init(&subs_ll, sizeof(sub_dsc_t));
+
+    uint32_t i;
+    for(i = 0; i < SUB_BUCKET_CNT; i++) {
+        _lv_ll_init(&subs_ll[i], sizeof(sub_dsc_t));
+    }
+    _lv_ll_init(&post_ll, sizeof(post_dsc_t));
+    post_timer = NULL;
 }
 
 void * lv_msg_subsribe(uint32_t msg_id, lv_msg_subscribe_cb_t cb, void * user_data)
 {
-    sub_dsc_t * s = _lv_ll_ins_tail(&subs_ll);
+    sub_dsc_t * s = _lv_ll_ins_tail(get_bucket(msg_id));
     LV_ASSERT_MALLOC(s);
     if(s == NULL) return NULL;
 
@@ -75,39 +105,77 @@ void * lv_msg_subsribe(uint32_t msg_id, lv_msg_subscribe_cb_t cb, void * user_da
 
 void * lv_msg_subsribe_obj(uint32_t msg_id, lv_obj_t * obj, void * user_data)
 {
+    /*If not added yet, add a delete event cb which automatically unsubcribes the object*/
+    obj_subs_t * obj_subs = lv_obj_get_event_user_data(obj, obj_delete_event_cb);
+    if(obj_subs == NULL) {
+        obj_subs = lv_mem_alloc(sizeof(obj_subs_t));
+        LV_ASSERT_MALLOC(obj_subs);
+        if(obj_subs == NULL) return NULL;
+
+        obj_subs->obj = obj;
+        obj_subs->head = NULL;
+        lv_obj_add_event_cb(obj, obj_delete_event_cb, LV_EVENT_DELETE, obj_subs);
+    }
+
     sub_dsc_t * s = lv_msg_subsribe(msg_id, obj_notify_cb, user_data);
     if(s == NULL) return NULL;
     s->_priv_data = obj;
 
-    /*If not added yet, add a delete event cb which automatically unsubcribes the object*/
-    sub_dsc_t * s_first = lv_obj_get_event_user_data(obj, obj_delete_event_cb);
-    if(s_first == NULL) {
-        lv_obj_add_event_cb(obj, obj_delete_event_cb, LV_EVENT_DELETE, s);
-    }
+    s->obj_subs = obj_subs;
+    s->obj_next = obj_subs->head;
+    if(obj_subs->head) obj_subs->head->obj_prev = s;
+    obj_subs->head = s;
     return s;
 }
 
 void lv_msg_unsubscribe(void * s)
 {
     LV_ASSERT_NULL(s);
-    _lv_ll_remove(&subs_ll, s);
-    lv_mem_free(s);
+    obj_subs_t * obj_subs = ((sub_dsc_t *)s)->obj_subs;
+    remove_sub(s);
+
+    /*The last subscription of the object was removed, the delete event is not required anymore*/
+    if(obj_subs && obj_subs->head == NULL) {
+        lv_obj_remove_event_cb_with_user_data(obj_subs->obj, obj_delete_event_cb, obj_subs);
+        lv_mem_free(obj_subs);
+    }
 }
 
 uint32_t lv_msg_unsubscribe_obj(uint32_t msg_id, lv_obj_t * obj)
 {
     uint32_t cnt = 0;
-    sub_dsc_t * s = _lv_ll_get_head(&subs_ll);
-    while(s) {
-        sub_dsc_t * s_next = _lv_ll_get_next(&subs_ll, s);
-        if(s->callback == obj_notify_cb &&
-           (s->msg_id == LV_MSG_ID_ANY || s->msg_id == msg_id) &&
-           (obj == NULL || s->_priv_data == obj)) {
-            lv_msg_unsubscribe(s);
-            cnt++;
+
+    /*Only the subscriptions of the object need to be checked*/
+    if(obj) {
+        obj_subs_t * obj_subs = lv_obj_get_event_user_data(obj, obj_delete_event_cb);
+        sub_dsc_t * s = obj_subs ? obj_subs->head : NULL;
+        while(s) {
+            /*`obj_subs` is freed with the last subscription, i.e. only if there is no next item*/
+            sub_dsc_t * s_next = s->obj_next;
+            if(msg_id == LV_MSG_ID_ANY || s->msg_id == LV_MSG_ID_ANY || s->msg_id == msg_id) {
+                lv_msg_unsubscribe(s);
+                cnt++;
+            }
+
+            s = s_next;
         }
 
-        s = s_next;
+        return cnt;
+    }
+
+    uint32_t i;
+    for(i = 0; i < SUB_BUCKET_CNT; i++) {
+        sub_dsc_t * s = _lv_ll_get_head(&subs_ll[i]);
+        while(s) {
+            sub_dsc_t * s_next = _lv_ll_get_next(&subs_ll[i], s);
+            if(s->callback == obj_notify_cb &&
+               (msg_id == LV_MSG_ID_ANY || s->msg_id == LV_MSG_ID_ANY || s->msg_id == msg_id)) {
+                lv_msg_unsubscribe(s);
+                cnt++;
+            }
+
+            s = s_next;
+        }
     }
 
     return cnt;
@@ -122,6 +190,33 @@ void lv_msg_send(uint32_t msg_id, const void * payload)
     notify(&m);
 }
 
+void lv_msg_post(uint32_t msg_id, const void * payload)
+{
+    /*Already posted: only the last payload will be sent*/
+    post_dsc_t * p;
+    _LV_LL_READ(&post_ll, p) {
+        if(p->msg_id == msg_id) {
+            p->payload = payload;
+            return;
+        }
+    }
+
+    p = _lv_ll_ins_tail(&post_ll);
+    LV_ASSERT_MALLOC(p);
+    if(p == NULL) return;
+
+    p->msg_id = msg_id;
+    p->payload = payload;
+
+    /*New timers are added to the head of the timer list,
+     *so the messages are sent before the displays are refreshed in the same `lv_timer_handler()`*/
+    if(post_timer == NULL) {
+        post_timer = lv_timer_create(post_timer_cb, 0, NULL);
+        LV_ASSERT_MALLOC(post_timer);
+        if(post_timer) lv_timer_set_repeat_count(post_timer, 1);
+    }
+}
+
 uint32_t lv_msg_get_id(lv_msg_t * m)
 {
     return m->id;
@@ -152,16 +247,39 @@ lv_msg_t * lv_event_get_msg(lv_event_t * e)
  *   STATIC FUNCTIONS
  **********************/
 
+static lv_ll_t * get_bucket(uint32_t msg_id)
+{
+    return &subs_ll[msg_id % SUB_BUCKET_CNT];
+}
+
 static void notify(lv_msg_t * m)
 {
-    sub_dsc_t * s;
-    _LV_LL_READ(&subs_ll, s) {
+    lv_ll_t * ll = get_bucket(m->id);
+    sub_dsc_t * s = _lv_ll_get_head(ll);
+    sub_dsc_t * s_next;
+    while(s) {
+        /*The callback can unsubscribe itself so get the next item while it's surely valid*/
+        s_next = _lv_ll_get_next(ll, s);
         if(s->msg_id == m->id && s->callback) {
             m->user_data = s->user_data;
             m->_priv_data = s->_priv_data;
             s->callback(s, m);
         }
+        s = s_next;
+    }
+}
+
+static void remove_sub(sub_dsc_t * s)
+{
+    obj_subs_t * obj_subs = s->obj_subs;
+    if(obj_subs) {
+        if(s->obj_prev) s->obj_prev->obj_next = s->obj_next;
+        else obj_subs->head = s->obj_next;
+        if(s->obj_next) s->obj_next->obj_prev = s->obj_prev;
     }
+
+    _lv_ll_remove(get_bucket(s->msg_id), s);
+    lv_mem_free(s);
 }
 
 static void obj_notify_cb(void * s, lv_msg_t * m)
@@ -172,18 +290,29 @@ static void obj_notify_cb(void * s, lv_msg_t * m)
 
 static void obj_delete_event_cb(lv_event_t * e)
 {
-    lv_obj_t * obj = lv_event_get_target(e);
+    obj_subs_t * obj_subs = lv_event_get_user_data(e);
 
-    sub_dsc_t * s = _lv_ll_get_head(&subs_ll);
-    sub_dsc_t * s_next;
-    while(s) {
-        /*On unsubscribe the list changes s becomes invalid so get next item while it's surely valid*/
-        s_next = _lv_ll_get_next(&subs_ll, s);
-        if(s->_priv_data == obj) {
-            lv_msg_unsubscribe(s);
-        }
-        s = s_next;
+    /*The event callbacks are freed with the object so only the subscriptions need to be removed*/
+    while(obj_subs->head) {
+        remove_sub(obj_subs->head);
+    }
+    lv_mem_free(obj_subs);
+}
+
+static void post_timer_cb(lv_timer_t * t)
+{
+    LV_UNUSED(t);
+
+    /*The timer deletes itself. The messages posted by the subscribers will be sent in the next cycle.*/
+    post_timer = NULL;
+    lv_ll_t ll = post_ll;
+    _lv_ll_init(&post_ll, sizeof(post_dsc_t));
+
+    post_dsc_t * p;
+    _LV_LL_READ(&ll, p) {
+        lv_msg_send(p->msg_id, p->payload);
     }
+    _lv_ll_clear(&ll);
 }
 
 #endif /*LV_USE_MSG*/
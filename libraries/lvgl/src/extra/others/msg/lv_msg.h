@@ -87,6 +87,14 @@ uint32_t lv_msg_unsubscribe_obj(uint32_t msg_id, lv_obj_t * obj);
  */
 void lv_msg_send(uint32_t msg_id, const void * payload);
 
+/**
+ * Post a message to send it later, before the next refresh of the displays.
+ * If a message with the same ID is posted again before it's sent, only the last payload will be sent once.
+ * @param msg_id        ID of the message to send
+ * @param payload       pointer to the data to send. It needs to be valid until the message is sent.
+ */
+void lv_msg_post(uint32_t msg_id, const void * payload);
+
 /**
  * Get the ID of a message object. Typically used in the subscriber callback.
  * @param m             pointer to a message object
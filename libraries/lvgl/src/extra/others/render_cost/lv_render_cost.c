@@ -0,0 +1,307 @@
+/**
+ * @file lv_render_cost.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_render_cost.h"
+#if LV_USE_RENDER_COST
+
+#include "../../../misc/lv_log.h"
+#include "../../../widgets/lv_img.h"
+#include "../../../widgets/lv_label.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t estimate(lv_obj_t * obj, const lv_area_t * clip, uint32_t * px, uint32_t * classes);
+static uint32_t get_tree_cnt(lv_obj_t * obj);
+static void analyze(lv_obj_t * obj, const lv_area_t * clip, lv_render_cost_report_t * report);
+static void get_disp_area(lv_obj_t * obj, lv_area_t * area);
+static uint32_t get_clipped_size(const lv_area_t * area, const lv_area_t * clip);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/*Nanoseconds per 1000 pixels, from the 16 bit `tests/bench` baseline at 800x480.
+ *Gradients and layers have no scene, they are assumed to cost like a blended fill.*/
+static uint32_t coefs[_LV_RENDER_COST_CLASS_NUM] = {
+    [LV_RENDER_COST_FILL] = 880,                /*Rectangle*/
+    [LV_RENDER_COST_BLEND] = 4970,              /*Rectangle + opa*/
+    [LV_RENDER_COST_RADIUS] = 2410,             /*Circle - Rectangle*/
+    [LV_RENDER_COST_GRAD] = 4970,
+    [LV_RENDER_COST_BORDER] = 830,              /*Border*/
+    [LV_RENDER_COST_SHADOW] = 9800,             /*Shadow large*/
+    [LV_RENDER_COST_IMG] = 1450,                /*Image RGB*/
+    [LV_RENDER_COST_IMG_TRANSFORM] = 20230,     /*Image RGB rotate anti aliased*/
+    [LV_RENDER_COST_TEXT] = 7630,               /*Text small*/
+    [LV_RENDER_COST_LAYER] = 4970,
+    [LV_RENDER_COST_LAYER_TRANSFORM] = 20230,
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_render_cost_set_coef(lv_render_cost_class_t cls, uint32_t ns_per_kpx)
+{
+    if(cls >= _LV_RENDER_COST_CLASS_NUM) return;
+
+    coefs[cls] = ns_per_kpx;
+}
+
+uint32_t lv_render_cost_get_coef(lv_render_cost_class_t cls)
+{
+    if(cls >= _LV_RENDER_COST_CLASS_NUM) return 0;
+
+    return coefs[cls];
+}
+
+uint32_t lv_render_cost_estimate(lv_obj_t * obj, uint32_t * classes)
+{
+    LV_ASSERT_NULL(obj);
+
+    lv_area_t clip;
+    uint32_t px;
+    uint32_t cls;
+    get_disp_area(obj, &clip);
+
+    uint32_t cost = estimate(obj, &clip, &px, &cls);
+    if(classes) *classes = cls;
+
+    return cost;
+}
+
+lv_res_t lv_render_cost_analyze(lv_obj_t * obj, uint32_t budget_us, lv_render_cost_report_t * report)
+{
+    LV_ASSERT_NULL(report);
+
+    lv_memset_00(report, sizeof(lv_render_cost_report_t));
+    report->budget_ns = budget_us * 1000;
+
+    report->items = lv_mem_alloc(get_tree_cnt(obj) * sizeof(lv_render_cost_item_t));
+    LV_ASSERT_MALLOC(report->items);
+    if(report->items == NULL) return LV_RES_INV;
+
+    lv_area_t clip;
+    get_disp_area(obj, &clip);
+    analyze(obj, &clip, report);
+
+    /*Insertion sort, the most expensive first. Screens have at most a few hundred objects.*/
+    uint32_t i;
+    for(i = 1; i < report->item_cnt; i++) {
+        lv_render_cost_item_t item = report->items[i];
+        uint32_t j = i;
+        while(j > 0 && report->items[j - 1].cost_ns < item.cost_ns) {
+            report->items[j] = report->items[j - 1];
+            j--;
+        }
+        report->items[j] = item;
+    }
+
+    return LV_RES_OK;
+}
+
+void lv_render_cost_report_free(lv_render_cost_report_t * report)
+{
+    LV_ASSERT_NULL(report);
+
+    lv_mem_free(report->items);
+    report->items = NULL;
+    report->item_cnt = 0;
+}
+
+void lv_render_cost_report_log(const lv_render_cost_report_t * report, uint32_t max_cnt)
+{
+    LV_ASSERT_NULL(report);
+
+    if(report->total_ns > report->budget_ns) {
+        LV_LOG_WARN("%" LV_PRIu32 " us, over the budget of %" LV_PRIu32 " us", report->total_ns / 1000,
+                    report->budget_ns / 1000);
+    }
+    else {
+        LV_LOG_USER("%" LV_PRIu32 " us, budget %" LV_PRIu32 " us", report->total_ns / 1000, report->budget_ns / 1000);
+    }
+
+    uint32_t i;
+    for(i = 0; i < report->item_cnt && i < max_cnt; i++) {
+        const lv_render_cost_item_t * item = &report->items[i];
+        if(item->cost_ns > report->budget_ns) {
+            LV_LOG_WARN("%p: %" LV_PRIu32 " us, %" LV_PRIu32 " px, classes 0x%" LV_PRIx32 ", over the budget",
+                        (void *)item->obj, item->cost_ns / 1000, item->px, item->classes);
+        }
+        else {
+            LV_LOG_USER("%p: %" LV_PRIu32 " us, %" LV_PRIu32 " px, classes 0x%" LV_PRIx32,
+                        (void *)item->obj, item->cost_ns / 1000, item->px, item->classes);
+        }
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Estimate the cost of an object from its main part, the area outside of `clip` is not drawn
+ */
+static uint32_t estimate(lv_obj_t * obj, const lv_area_t * clip, uint32_t * px, uint32_t * classes)
+{
+    uint32_t class_px[_LV_RENDER_COST_CLASS_NUM] = {0};
+    uint32_t size = get_clipped_size(&obj->coords, clip);
+    lv_coord_t w = lv_obj_get_width(obj);
+    lv_coord_t h = lv_obj_get_height(obj);
+
+    *px = size;
+    *classes = 0;
+
+    /*The `opa` style of the object and its parents makes everything blended*/
+    lv_opa_t bg_opa = lv_obj_get_style_bg_opa(obj, LV_PART_MAIN);
+    if(size > 0 && bg_opa > LV_OPA_MIN) {
+        bool blended = bg_opa < LV_OPA_MAX || lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN) < LV_OPA_MAX;
+        class_px[blended ? LV_RENDER_COST_BLEND : LV_RENDER_COST_FILL] += size;
+
+        if(lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE) {
+            class_px[LV_RENDER_COST_GRAD] += size;
+        }
+
+        /*Only the corners are masked*/
+        lv_coord_t r = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+        lv_coord_t r_max = LV_MIN(w, h) / 2;
+        if(r > r_max) r = r_max;
+        if(r > 0) class_px[LV_RENDER_COST_RADIUS] += LV_MIN(size, (uint32_t)4 * r * r);
+    }
+
+    if(size > 0 && lv_obj_get_style_bg_img_src(obj, LV_PART_MAIN) != NULL) {
+        class_px[LV_RENDER_COST_IMG] += size;
+    }
+
+    lv_coord_t border_w = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    if(size > 0 && border_w > 0 && lv_obj_get_style_border_opa(obj, LV_PART_MAIN) > LV_OPA_MIN &&
+       lv_obj_get_style_border_side(obj, LV_PART_MAIN) != LV_BORDER_SIDE_NONE) {
+        class_px[LV_RENDER_COST_BORDER] += LV_MIN(size, (uint32_t)2 * (w + h) * border_w);
+    }
+
+    lv_coord_t outline_w = lv_obj_get_style_outline_width(obj, LV_PART_MAIN);
+    if(outline_w > 0 && lv_obj_get_style_outline_opa(obj, LV_PART_MAIN) > LV_OPA_MIN) {
+        lv_area_t outline_area;
+        lv_area_copy(&outline_area, &obj->coords);
+        lv_area_increase(&outline_area, outline_w + lv_obj_get_style_outline_pad(obj, LV_PART_MAIN),
+                         outline_w + lv_obj_get_style_outline_pad(obj, LV_PART_MAIN));
+        uint32_t outline_size = get_clipped_size(&outline_area, clip);
+        class_px[LV_RENDER_COST_BORDER] += LV_MIN(outline_size,
+                                                  (uint32_t)2 * (lv_area_get_width(&outline_area) +
+                                                                 lv_area_get_height(&outline_area)) * outline_w);
+    }
+
+    lv_coord_t shadow_w = lv_obj_get_style_shadow_width(obj, LV_PART_MAIN);
+    if(shadow_w > 0 && lv_obj_get_style_shadow_opa(obj, LV_PART_MAIN) > LV_OPA_MIN) {
+        lv_area_t shadow_area;
+        lv_area_copy(&shadow_area, &obj->coords);
+        lv_area_move(&shadow_area, lv_obj_get_style_shadow_ofs_x(obj, LV_PART_MAIN),
+                     lv_obj_get_style_shadow_ofs_y(obj, LV_PART_MAIN));
+        lv_coord_t ext = shadow_w / 2 + lv_obj_get_style_shadow_spread(obj, LV_PART_MAIN);
+        lv_area_increase(&shadow_area, ext, ext);
+        class_px[LV_RENDER_COST_SHADOW] += get_clipped_size(&shadow_area, clip);
+    }
+
+#if LV_USE_IMG
+    if(size > 0 && lv_obj_check_type(obj, &lv_img_class)) {
+        bool transformed = lv_img_get_angle(obj) != 0 || lv_img_get_zoom(obj) != LV_IMG_ZOOM_NONE;
+        class_px[transformed ? LV_RENDER_COST_IMG_TRANSFORM : LV_RENDER_COST_IMG] += size;
+    }
+#endif
+
+#if LV_USE_LABEL
+    if(size > 0 && lv_obj_check_type(obj, &lv_label_class)) {
+        class_px[LV_RENDER_COST_TEXT] += size;
+    }
+#endif
+
+    /*The children are drawn into the layer too, but they are counted on their own*/
+    lv_layer_type_t layer_type = _lv_obj_get_layer_type(obj);
+    if(layer_type == LV_LAYER_TYPE_SIMPLE) class_px[LV_RENDER_COST_LAYER] += size;
+    else if(layer_type == LV_LAYER_TYPE_TRANSFORM) class_px[LV_RENDER_COST_LAYER_TRANSFORM] += size;
+
+    uint64_t cost = 0;
+    uint32_t i;
+    for(i = 0; i < _LV_RENDER_COST_CLASS_NUM; i++) {
+        if(class_px[i] == 0) continue;
+
+        *classes |= 1UL << i;
+        cost += (uint64_t)class_px[i] * coefs[i] / 1000;
+    }
+
+    return cost > UINT32_MAX ? UINT32_MAX : (uint32_t)cost;
+}
+
+static uint32_t get_tree_cnt(lv_obj_t * obj)
+{
+    uint32_t cnt = 1;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        cnt += get_tree_cnt(lv_obj_get_child(obj, i));
+    }
+
+    return cnt;
+}
+
+static void analyze(lv_obj_t * obj, const lv_area_t * clip, lv_render_cost_report_t * report)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) || lv_obj_get_style_opa(obj, LV_PART_MAIN) <= LV_OPA_MIN) return;
+
+    lv_render_cost_item_t item;
+    item.obj = obj;
+    item.cost_ns = estimate(obj, clip, &item.px, &item.classes);
+    if(item.cost_ns > 0) {
+        report->items[report->item_cnt++] = item;
+        report->total_ns += item.cost_ns;
+        if(item.cost_ns > report->budget_ns) report->over_budget_cnt++;
+    }
+
+    /*The children are clipped to the object unless they can overflow it*/
+    lv_area_t child_clip;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        lv_area_copy(&child_clip, clip);
+    }
+    else if(!_lv_area_intersect(&child_clip, clip, &obj->coords)) {
+        return;
+    }
+
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        analyze(lv_obj_get_child(obj, i), &child_clip, report);
+    }
+}
+
+static void get_disp_area(lv_obj_t * obj, lv_area_t * area)
+{
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    lv_area_set(area, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+}
+
+static uint32_t get_clipped_size(const lv_area_t * area, const lv_area_t * clip)
+{
+    lv_area_t clipped;
+    if(!_lv_area_intersect(&clipped, area, clip)) return 0;
+
+    return lv_area_get_size(&clipped);
+}
+
+#endif /*LV_USE_RENDER_COST*/
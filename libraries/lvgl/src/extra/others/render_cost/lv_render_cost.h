@@ -0,0 +1,121 @@
+/**
+ * @file lv_render_cost.h
+ *
+ */
+
+#ifndef LV_RENDER_COST_H
+#define LV_RENDER_COST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../core/lv_obj.h"
+
+#if LV_USE_RENDER_COST
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Cost classes of the drawing operations, each one has a cost per pixel.
+ */
+typedef enum {
+    LV_RENDER_COST_FILL,            /**< Opaque background*/
+    LV_RENDER_COST_BLEND,           /**< Semi transparent background*/
+    LV_RENDER_COST_RADIUS,          /**< Radius mask of the corners*/
+    LV_RENDER_COST_GRAD,            /**< Background gradient*/
+    LV_RENDER_COST_BORDER,          /**< Border and outline*/
+    LV_RENDER_COST_SHADOW,          /**< Shadow*/
+    LV_RENDER_COST_IMG,             /**< Image or background image*/
+    LV_RENDER_COST_IMG_TRANSFORM,   /**< Rotated or zoomed image*/
+    LV_RENDER_COST_TEXT,            /**< Text of a label*/
+    LV_RENDER_COST_LAYER,           /**< Opacity layer, e.g. `opa_layered` or `blend_mode` style*/
+    LV_RENDER_COST_LAYER_TRANSFORM, /**< Transformed layer, e.g. `transform_angle` or `transform_zoom` style*/
+    _LV_RENDER_COST_CLASS_NUM
+} lv_render_cost_class_t;
+
+typedef struct {
+    lv_obj_t * obj;
+    uint32_t cost_ns;               /**< Estimated time to draw the object without its children*/
+    uint32_t px;                    /**< Visible pixels of the object*/
+    uint32_t classes;               /**< Bit mask of the `lv_render_cost_class_t` the object uses*/
+} lv_render_cost_item_t;
+
+typedef struct {
+    lv_render_cost_item_t * items;  /**< The objects which cost anything, the most expensive first*/
+    uint32_t item_cnt;
+    uint32_t total_ns;              /**< Estimated time to draw the whole tree*/
+    uint32_t budget_ns;
+    uint32_t over_budget_cnt;       /**< Number of objects which cost more than the budget alone*/
+} lv_render_cost_report_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Set the cost of a class. The defaults were measured with `tests/bench` on a desktop,
+ * so calibrate them on the target with the benchmark demo to compare the costs with a real frame budget.
+ * @param cls           the cost class
+ * @param ns_per_kpx    time to draw 1000 pixels in nanoseconds
+ */
+void lv_render_cost_set_coef(lv_render_cost_class_t cls, uint32_t ns_per_kpx);
+
+/**
+ * Get the cost of a class
+ * @param cls   the cost class
+ * @return      time to draw 1000 pixels in nanoseconds
+ */
+uint32_t lv_render_cost_get_coef(lv_render_cost_class_t cls);
+
+/**
+ * Estimate the time to draw an object without its children, as if its whole area was refreshed
+ * @param obj       pointer to an object
+ * @param classes   store the bit mask of the used cost classes here, can be NULL
+ * @return          the estimated time in nanoseconds
+ */
+uint32_t lv_render_cost_estimate(lv_obj_t * obj, uint32_t * classes);
+
+/**
+ * Estimate the cost of every visible object in a tree, e.g. a screen.
+ * Overlapping objects are all counted, as LVGL draws all of them when their area is refreshed.
+ * @param obj       the root of the tree
+ * @param budget_us the time budget of a frame in microseconds
+ * @param report    store the result here, free it with `lv_render_cost_report_free()`
+ * @return          LV_RES_OK: success; LV_RES_INV: out of memory
+ */
+lv_res_t lv_render_cost_analyze(lv_obj_t * obj, uint32_t budget_us, lv_render_cost_report_t * report);
+
+/**
+ * Free the items of a report
+ * @param report    pointer to a report filled by `lv_render_cost_analyze()`
+ */
+void lv_render_cost_report_free(lv_render_cost_report_t * report);
+
+/**
+ * Log the most expensive objects of a report, the objects over the budget are logged as warnings
+ * @param report    pointer to a report filled by `lv_render_cost_analyze()`
+ * @param max_cnt   maximum number of objects to log
+ */
+void lv_render_cost_report_log(const lv_render_cost_report_t * report, uint32_t max_cnt);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_RENDER_COST*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_RENDER_COST_H*/
@@ -30,6 +30,7 @@
 #define DARK_COLOR_GREY        lv_color_hex(0x2f3237)
 
 #define TRANSITION_TIME         LV_THEME_DEFAULT_TRANSITION_TIME
+#define STYLE_LIST_MAX          16      /*The most styles an object gets is 14 (switch)*/
 #define BORDER_WIDTH            lv_disp_dpx(theme.disp, 2)
 #define OUTLINE_WIDTH           lv_disp_dpx(theme.disp, 3)
 
@@ -155,6 +156,13 @@ typedef struct {
     uint8_t light : 1;
 } my_theme_t;
 
+/*The styles of an object collected to add them at once*/
+typedef struct {
+    lv_obj_t * obj;
+    _lv_obj_style_t styles[STYLE_LIST_MAX];
+    uint32_t cnt;
+} style_list_t;
+
 typedef enum {
     DISP_SMALL = 3,
     DISP_MEDIUM = 2,
@@ -165,6 +173,8 @@ typedef enum {
  *  STATIC PROTOTYPES
  **********************/
 static void theme_apply(lv_theme_t * th, lv_obj_t * obj);
+static void theme_collect(lv_obj_t * obj, style_list_t * list);
+static void add_style(style_list_t * list, lv_style_t * style, lv_style_selector_t selector);
 static void style_init_reset(lv_style_t * style);
 
 /**********************
@@ -695,10 +705,20 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
 {
     LV_UNUSED(th);
 
+    /*Collect the styles first to allocate them at once instead of reallocating the array for every style*/
+    style_list_t list;
+    list.obj = obj;
+    list.cnt = 0;
+    theme_collect(obj, &list);
+    _lv_obj_add_styles(obj, list.styles, list.cnt);
+}
+
+static void theme_collect(lv_obj_t * obj, style_list_t * list)
+{
     if(lv_obj_get_parent(obj) == NULL) {
-        lv_obj_add_style(obj, &styles->scr, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+        add_style(list, &styles->scr, 0);
+        add_style(list, &styles->scrollbar, LV_PART_SCROLLBAR);
+        add_style(list, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
         return;
     }
 
@@ -711,9 +731,9 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
         }
         /*Tabview pages*/
         else if(lv_obj_check_type(lv_obj_get_parent(parent), &lv_tabview_class)) {
-            lv_obj_add_style(obj, &styles->pad_normal, 0);
-            lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-            lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+            add_style(list, &styles->pad_normal, 0);
+            add_style(list, &styles->scrollbar, LV_PART_SCROLLBAR);
+            add_style(list, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
             return;
         }
 #endif
@@ -721,16 +741,16 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
 #if LV_USE_WIN
         /*Header*/
         if(lv_obj_get_index(obj) == 0 && lv_obj_check_type(lv_obj_get_parent(obj), &lv_win_class)) {
-            lv_obj_add_style(obj, &styles->bg_color_grey, 0);
-            lv_obj_add_style(obj, &styles->pad_tiny, 0);
+            add_style(list, &styles->bg_color_grey, 0);
+            add_style(list, &styles->pad_tiny, 0);
             return;
         }
         /*Content*/
         else if(lv_obj_get_index(obj) == 1 && lv_obj_check_type(lv_obj_get_parent(obj), &lv_win_class)) {
-            lv_obj_add_style(obj, &styles->scr, 0);
-            lv_obj_add_style(obj, &styles->pad_normal, 0);
-            lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-            lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+            add_style(list, &styles->scr, 0);
+            add_style(list, &styles->pad_normal, 0);
+            add_style(list, &styles->scrollbar, LV_PART_SCROLLBAR);
+            add_style(list, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
             return;
         }
 #endif
@@ -742,29 +762,29 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
         }
 #endif
 
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+        add_style(list, &styles->card, 0);
+        add_style(list, &styles->scrollbar, LV_PART_SCROLLBAR);
+        add_style(list, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
     }
 #if LV_USE_BTN
     else if(lv_obj_check_type(obj, &lv_btn_class)) {
-        lv_obj_add_style(obj, &styles->btn, 0);
-        lv_obj_add_style(obj, &styles->bg_color_primary, 0);
-        lv_obj_add_style(obj, &styles->transition_delayed, 0);
-        lv_obj_add_style(obj, &styles->pressed, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->transition_normal, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->btn, 0);
+        add_style(list, &styles->bg_color_primary, 0);
+        add_style(list, &styles->transition_delayed, 0);
+        add_style(list, &styles->pressed, LV_STATE_PRESSED);
+        add_style(list, &styles->transition_normal, LV_STATE_PRESSED);
+        add_style(list, &styles->outline_primary, LV_STATE_FOCUS_KEY);
 #if LV_THEME_DEFAULT_GROW
-        lv_obj_add_style(obj, &styles->grow, LV_STATE_PRESSED);
+        add_style(list, &styles->grow, LV_STATE_PRESSED);
 #endif
-        lv_obj_add_style(obj, &styles->bg_color_secondary, LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->disabled, LV_STATE_DISABLED);
+        add_style(list, &styles->bg_color_secondary, LV_STATE_CHECKED);
+        add_style(list, &styles->disabled, LV_STATE_DISABLED);
 
 #if LV_USE_MENU
         if(lv_obj_check_type(lv_obj_get_parent(obj), &lv_menu_sidebar_header_cont_class) ||
            lv_obj_check_type(lv_obj_get_parent(obj), &lv_menu_main_header_cont_class)) {
-            lv_obj_add_style(obj, &styles->menu_header_btn, 0);
-            lv_obj_add_style(obj, &styles->menu_pressed, LV_STATE_PRESSED);
+            add_style(list, &styles->menu_header_btn, 0);
+            add_style(list, &styles->menu_pressed, LV_STATE_PRESSED);
         }
 #endif
     }
@@ -772,7 +792,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
 
 #if LV_USE_LINE
     else if(lv_obj_check_type(obj, &lv_line_class)) {
-        lv_obj_add_style(obj, &styles->line, 0);
+        add_style(list, &styles->line, 0);
     }
 #endif
 
@@ -780,380 +800,380 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
     else if(lv_obj_check_type(obj, &lv_btnmatrix_class)) {
 #if LV_USE_MSGBOX
         if(lv_obj_check_type(lv_obj_get_parent(obj), &lv_msgbox_class)) {
-            lv_obj_add_style(obj, &styles->msgbox_btn_bg, 0);
-            lv_obj_add_style(obj, &styles->pad_gap, 0);
-            lv_obj_add_style(obj, &styles->btn, LV_PART_ITEMS);
-            lv_obj_add_style(obj, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-            lv_obj_add_style(obj, &styles->disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
-            lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_ITEMS | LV_STATE_CHECKED);
-            lv_obj_add_style(obj, &styles->bg_color_primary_muted, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-            lv_obj_add_style(obj, &styles->bg_color_secondary_muted, LV_PART_ITEMS | LV_STATE_EDITED);
+            add_style(list, &styles->msgbox_btn_bg, 0);
+            add_style(list, &styles->pad_gap, 0);
+            add_style(list, &styles->btn, LV_PART_ITEMS);
+            add_style(list, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
+            add_style(list, &styles->disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
+            add_style(list, &styles->bg_color_primary, LV_PART_ITEMS | LV_STATE_CHECKED);
+            add_style(list, &styles->bg_color_primary_muted, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
+            add_style(list, &styles->bg_color_secondary_muted, LV_PART_ITEMS | LV_STATE_EDITED);
             return;
         }
 #endif
 #if LV_USE_TABVIEW
         if(lv_obj_check_type(lv_obj_get_parent(obj), &lv_tabview_class)) {
-            lv_obj_add_style(obj, &styles->bg_color_white, 0);
-            lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-            lv_obj_add_style(obj, &styles->tab_bg_focus, LV_STATE_FOCUS_KEY);
-            lv_obj_add_style(obj, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-            lv_obj_add_style(obj, &styles->bg_color_primary_muted, LV_PART_ITEMS | LV_STATE_CHECKED);
-            lv_obj_add_style(obj, &styles->tab_btn, LV_PART_ITEMS | LV_STATE_CHECKED);
-            lv_obj_add_style(obj, &styles->outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-            lv_obj_add_style(obj, &styles->outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
-            lv_obj_add_style(obj, &styles->tab_bg_focus, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
+            add_style(list, &styles->bg_color_white, 0);
+            add_style(list, &styles->outline_primary, LV_STATE_FOCUS_KEY);
+            add_style(list, &styles->tab_bg_focus, LV_STATE_FOCUS_KEY);
+            add_style(list, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
+            add_style(list, &styles->bg_color_primary_muted, LV_PART_ITEMS | LV_STATE_CHECKED);
+            add_style(list, &styles->tab_btn, LV_PART_ITEMS | LV_STATE_CHECKED);
+            add_style(list, &styles->outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
+            add_style(list, &styles->outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
+            add_style(list, &styles->tab_bg_focus, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
             return;
         }
 #endif
 
 #if LV_USE_CALENDAR
         if(lv_obj_check_type(lv_obj_get_parent(obj), &lv_calendar_class)) {
-            lv_obj_add_style(obj, &styles->calendar_btnm_bg, 0);
-            lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-            lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-            lv_obj_add_style(obj, &styles->calendar_btnm_day, LV_PART_ITEMS);
-            lv_obj_add_style(obj, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-            lv_obj_add_style(obj, &styles->disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
-            lv_obj_add_style(obj, &styles->outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-            lv_obj_add_style(obj, &styles->outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
+            add_style(list, &styles->calendar_btnm_bg, 0);
+            add_style(list, &styles->outline_primary, LV_STATE_FOCUS_KEY);
+            add_style(list, &styles->outline_secondary, LV_STATE_EDITED);
+            add_style(list, &styles->calendar_btnm_day, LV_PART_ITEMS);
+            add_style(list, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
+            add_style(list, &styles->disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
+            add_style(list, &styles->outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
+            add_style(list, &styles->outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
             return;
         }
 #endif
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->btn, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_ITEMS | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
+        add_style(list, &styles->card, 0);
+        add_style(list, &styles->outline_primary, LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->outline_secondary, LV_STATE_EDITED);
+        add_style(list, &styles->btn, LV_PART_ITEMS);
+        add_style(list, &styles->disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
+        add_style(list, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
+        add_style(list, &styles->bg_color_primary, LV_PART_ITEMS | LV_STATE_CHECKED);
+        add_style(list, &styles->outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
     }
 #endif
 
 #if LV_USE_BAR
     else if(lv_obj_check_type(obj, &lv_bar_class)) {
-        lv_obj_add_style(obj, &styles->bg_color_primary_muted, 0);
-        lv_obj_add_style(obj, &styles->circle, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->circle, LV_PART_INDICATOR);
+        add_style(list, &styles->bg_color_primary_muted, 0);
+        add_style(list, &styles->circle, 0);
+        add_style(list, &styles->outline_primary, LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->outline_secondary, LV_STATE_EDITED);
+        add_style(list, &styles->bg_color_primary, LV_PART_INDICATOR);
+        add_style(list, &styles->circle, LV_PART_INDICATOR);
     }
 #endif
 
 #if LV_USE_SLIDER
     else if(lv_obj_check_type(obj, &lv_slider_class)) {
-        lv_obj_add_style(obj, &styles->bg_color_primary_muted, 0);
-        lv_obj_add_style(obj, &styles->circle, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->circle, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->knob, LV_PART_KNOB);
+        add_style(list, &styles->bg_color_primary_muted, 0);
+        add_style(list, &styles->circle, 0);
+        add_style(list, &styles->outline_primary, LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->outline_secondary, LV_STATE_EDITED);
+        add_style(list, &styles->bg_color_primary, LV_PART_INDICATOR);
+        add_style(list, &styles->circle, LV_PART_INDICATOR);
+        add_style(list, &styles->knob, LV_PART_KNOB);
 #if LV_THEME_DEFAULT_GROW
-        lv_obj_add_style(obj, &styles->grow, LV_PART_KNOB | LV_STATE_PRESSED);
+        add_style(list, &styles->grow, LV_PART_KNOB | LV_STATE_PRESSED);
 #endif
-        lv_obj_add_style(obj, &styles->transition_delayed, LV_PART_KNOB);
-        lv_obj_add_style(obj, &styles->transition_normal, LV_PART_KNOB | LV_STATE_PRESSED);
+        add_style(list, &styles->transition_delayed, LV_PART_KNOB);
+        add_style(list, &styles->transition_normal, LV_PART_KNOB | LV_STATE_PRESSED);
     }
 #endif
 
 #if LV_USE_TABLE
     else if(lv_obj_check_type(obj, &lv_table_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->pad_zero, 0);
-        lv_obj_add_style(obj, &styles->no_radius, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-        lv_obj_add_style(obj, &styles->bg_color_white, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->table_cell, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->pad_normal, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->bg_color_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
+        add_style(list, &styles->card, 0);
+        add_style(list, &styles->pad_zero, 0);
+        add_style(list, &styles->no_radius, 0);
+        add_style(list, &styles->outline_primary, LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->outline_secondary, LV_STATE_EDITED);
+        add_style(list, &styles->scrollbar, LV_PART_SCROLLBAR);
+        add_style(list, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+        add_style(list, &styles->bg_color_white, LV_PART_ITEMS);
+        add_style(list, &styles->table_cell, LV_PART_ITEMS);
+        add_style(list, &styles->pad_normal, LV_PART_ITEMS);
+        add_style(list, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
+        add_style(list, &styles->bg_color_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->bg_color_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
     }
 #endif
 
 #if LV_USE_CHECKBOX
     else if(lv_obj_check_type(obj, &lv_checkbox_class)) {
-        lv_obj_add_style(obj, &styles->pad_gap, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->disabled, LV_PART_INDICATOR | LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &styles->cb_marker, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_INDICATOR | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->cb_marker_checked, LV_PART_INDICATOR | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->pressed, LV_PART_INDICATOR | LV_STATE_PRESSED);
+        add_style(list, &styles->pad_gap, 0);
+        add_style(list, &styles->outline_primary, LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->disabled, LV_PART_INDICATOR | LV_STATE_DISABLED);
+        add_style(list, &styles->cb_marker, LV_PART_INDICATOR);
+        add_style(list, &styles->bg_color_primary, LV_PART_INDICATOR | LV_STATE_CHECKED);
+        add_style(list, &styles->cb_marker_checked, LV_PART_INDICATOR | LV_STATE_CHECKED);
+        add_style(list, &styles->pressed, LV_PART_INDICATOR | LV_STATE_PRESSED);
 #if LV_THEME_DEFAULT_GROW
-        lv_obj_add_style(obj, &styles->grow, LV_PART_INDICATOR | LV_STATE_PRESSED);
+        add_style(list, &styles->grow, LV_PART_INDICATOR | LV_STATE_PRESSED);
 #endif
-        lv_obj_add_style(obj, &styles->transition_normal, LV_PART_INDICATOR | LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->transition_delayed, LV_PART_INDICATOR);
+        add_style(list, &styles->transition_normal, LV_PART_INDICATOR | LV_STATE_PRESSED);
+        add_style(list, &styles->transition_delayed, LV_PART_INDICATOR);
     }
 #endif
 
 #if LV_USE_SWITCH
     else if(lv_obj_check_type(obj, &lv_switch_class)) {
-        lv_obj_add_style(obj, &styles->bg_color_grey, 0);
-        lv_obj_add_style(obj, &styles->circle, 0);
-        lv_obj_add_style(obj, &styles->anim_fast, 0);
-        lv_obj_add_style(obj, &styles->disabled, LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_INDICATOR | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->circle, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->disabled, LV_PART_INDICATOR | LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &styles->knob, LV_PART_KNOB);
-        lv_obj_add_style(obj, &styles->bg_color_white, LV_PART_KNOB);
-        lv_obj_add_style(obj, &styles->switch_knob, LV_PART_KNOB);
-        lv_obj_add_style(obj, &styles->disabled, LV_PART_KNOB | LV_STATE_DISABLED);
-
-        lv_obj_add_style(obj, &styles->transition_normal, LV_PART_INDICATOR | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->transition_normal, LV_PART_INDICATOR);
+        add_style(list, &styles->bg_color_grey, 0);
+        add_style(list, &styles->circle, 0);
+        add_style(list, &styles->anim_fast, 0);
+        add_style(list, &styles->disabled, LV_STATE_DISABLED);
+        add_style(list, &styles->outline_primary, LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->bg_color_primary, LV_PART_INDICATOR | LV_STATE_CHECKED);
+        add_style(list, &styles->circle, LV_PART_INDICATOR);
+        add_style(list, &styles->disabled, LV_PART_INDICATOR | LV_STATE_DISABLED);
+        add_style(list, &styles->knob, LV_PART_KNOB);
+        add_style(list, &styles->bg_color_white, LV_PART_KNOB);
+        add_style(list, &styles->switch_knob, LV_PART_KNOB);
+        add_style(list, &styles->disabled, LV_PART_KNOB | LV_STATE_DISABLED);
+
+        add_style(list, &styles->transition_normal, LV_PART_INDICATOR | LV_STATE_CHECKED);
+        add_style(list, &styles->transition_normal, LV_PART_INDICATOR);
     }
 #endif
 
 #if LV_USE_CHART
     else if(lv_obj_check_type(obj, &lv_chart_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->pad_small, 0);
-        lv_obj_add_style(obj, &styles->chart_bg, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-        lv_obj_add_style(obj, &styles->chart_series, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->chart_indic, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->chart_ticks, LV_PART_TICKS);
-        lv_obj_add_style(obj, &styles->chart_series, LV_PART_CURSOR);
+        add_style(list, &styles->card, 0);
+        add_style(list, &styles->pad_small, 0);
+        add_style(list, &styles->chart_bg, 0);
+        add_style(list, &styles->scrollbar, LV_PART_SCROLLBAR);
+        add_style(list, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+        add_style(list, &styles->chart_series, LV_PART_ITEMS);
+        add_style(list, &styles->chart_indic, LV_PART_INDICATOR);
+        add_style(list, &styles->chart_ticks, LV_PART_TICKS);
+        add_style(list, &styles->chart_series, LV_PART_CURSOR);
     }
 #endif
 
 #if LV_USE_ROLLER
     else if(lv_obj_check_type(obj, &lv_roller_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->anim, 0);
-        lv_obj_add_style(obj, &styles->line_space_large, 0);
-        lv_obj_add_style(obj, &styles->text_align_center, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_SELECTED);
+        add_style(list, &styles->card, 0);
+        add_style(list, &styles->anim, 0);
+        add_style(list, &styles->line_space_large, 0);
+        add_style(list, &styles->text_align_center, 0);
+        add_style(list, &styles->outline_primary, LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->outline_secondary, LV_STATE_EDITED);
+        add_style(list, &styles->bg_color_primary, LV_PART_SELECTED);
     }
 #endif
 
 #if LV_USE_DROPDOWN
     else if(lv_obj_check_type(obj, &lv_dropdown_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->pad_small, 0);
-        lv_obj_add_style(obj, &styles->transition_delayed, 0);
-        lv_obj_add_style(obj, &styles->transition_normal, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->pressed, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->transition_normal, LV_PART_INDICATOR);
+        add_style(list, &styles->card, 0);
+        add_style(list, &styles->pad_small, 0);
+        add_style(list, &styles->transition_delayed, 0);
+        add_style(list, &styles->transition_normal, LV_STATE_PRESSED);
+        add_style(list, &styles->pressed, LV_STATE_PRESSED);
+        add_style(list, &styles->outline_primary, LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->outline_secondary, LV_STATE_EDITED);
+        add_style(list, &styles->transition_normal, LV_PART_INDICATOR);
     }
     else if(lv_obj_check_type(obj, &lv_dropdownlist_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->clip_corner, 0);
-        lv_obj_add_style(obj, &styles->line_space_large, 0);
-        lv_obj_add_style(obj, &styles->dropdown_list, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-        lv_obj_add_style(obj, &styles->bg_color_white, LV_PART_SELECTED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_SELECTED | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->pressed, LV_PART_SELECTED | LV_STATE_PRESSED);
+        add_style(list, &styles->card, 0);
+        add_style(list, &styles->clip_corner, 0);
+        add_style(list, &styles->line_space_large, 0);
+        add_style(list, &styles->dropdown_list, 0);
+        add_style(list, &styles->scrollbar, LV_PART_SCROLLBAR);
+        add_style(list, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+        add_style(list, &styles->bg_color_white, LV_PART_SELECTED);
+        add_style(list, &styles->bg_color_primary, LV_PART_SELECTED | LV_STATE_CHECKED);
+        add_style(list, &styles->pressed, LV_PART_SELECTED | LV_STATE_PRESSED);
     }
 #endif
 
 #if LV_USE_ARC
     else if(lv_obj_check_type(obj, &lv_arc_class)) {
-        lv_obj_add_style(obj, &styles->arc_indic, 0);
-        lv_obj_add_style(obj, &styles->arc_indic, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->arc_indic_primary, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->knob, LV_PART_KNOB);
+        add_style(list, &styles->arc_indic, 0);
+        add_style(list, &styles->arc_indic, LV_PART_INDICATOR);
+        add_style(list, &styles->arc_indic_primary, LV_PART_INDICATOR);
+        add_style(list, &styles->knob, LV_PART_KNOB);
     }
 #endif
 
 #if LV_USE_SPINNER
     else if(lv_obj_check_type(obj, &lv_spinner_class)) {
-        lv_obj_add_style(obj, &styles->arc_indic, 0);
-        lv_obj_add_style(obj, &styles->arc_indic, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &styles->arc_indic_primary, LV_PART_INDICATOR);
+        add_style(list, &styles->arc_indic, 0);
+        add_style(list, &styles->arc_indic, LV_PART_INDICATOR);
+        add_style(list, &styles->arc_indic_primary, LV_PART_INDICATOR);
     }
 #endif
 
 #if LV_USE_METER
     else if(lv_obj_check_type(obj, &lv_meter_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->circle, 0);
-        lv_obj_add_style(obj, &styles->meter_indic, LV_PART_INDICATOR);
+        add_style(list, &styles->card, 0);
+        add_style(list, &styles->circle, 0);
+        add_style(list, &styles->meter_indic, LV_PART_INDICATOR);
     }
 #endif
 
 #if LV_USE_TEXTAREA
     else if(lv_obj_check_type(obj, &lv_textarea_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->pad_small, 0);
-        lv_obj_add_style(obj, &styles->disabled, LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-        lv_obj_add_style(obj, &styles->ta_cursor, LV_PART_CURSOR | LV_STATE_FOCUSED);
-        lv_obj_add_style(obj, &styles->ta_placeholder, LV_PART_TEXTAREA_PLACEHOLDER);
+        add_style(list, &styles->card, 0);
+        add_style(list, &styles->pad_small, 0);
+        add_style(list, &styles->disabled, LV_STATE_DISABLED);
+        add_style(list, &styles->outline_primary, LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->outline_secondary, LV_STATE_EDITED);
+        add_style(list, &styles->scrollbar, LV_PART_SCROLLBAR);
+        add_style(list, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+        add_style(list, &styles->ta_cursor, LV_PART_CURSOR | LV_STATE_FOCUSED);
+        add_style(list, &styles->ta_placeholder, LV_PART_TEXTAREA_PLACEHOLDER);
     }
 #endif
 
 #if LV_USE_CALENDAR
     else if(lv_obj_check_type(obj, &lv_calendar_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->pad_zero, 0);
+        add_style(list, &styles->card, 0);
+        add_style(list, &styles->pad_zero, 0);
     }
 #endif
 
 #if LV_USE_CALENDAR_HEADER_ARROW
     else if(lv_obj_check_type(obj, &lv_calendar_header_arrow_class)) {
-        lv_obj_add_style(obj, &styles->calendar_header, 0);
+        add_style(list, &styles->calendar_header, 0);
     }
 #endif
 
 #if LV_USE_CALENDAR_HEADER_DROPDOWN
     else if(lv_obj_check_type(obj, &lv_calendar_header_dropdown_class)) {
-        lv_obj_add_style(obj, &styles->calendar_header, 0);
+        add_style(list, &styles->calendar_header, 0);
     }
 #endif
 
 #if LV_USE_KEYBOARD
     else if(lv_obj_check_type(obj, &lv_keyboard_class)) {
-        lv_obj_add_style(obj, &styles->scr, 0);
-        lv_obj_add_style(obj, disp_size == DISP_LARGE ? &styles->pad_small : &styles->pad_tiny, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->btn, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &styles->bg_color_white, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->keyboard_btn_bg, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->bg_color_grey, LV_PART_ITEMS | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->bg_color_primary_muted, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->bg_color_secondary_muted, LV_PART_ITEMS | LV_STATE_EDITED);
+        add_style(list, &styles->scr, 0);
+        add_style(list, disp_size == DISP_LARGE ? &styles->pad_small : &styles->pad_tiny, 0);
+        add_style(list, &styles->outline_primary, LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->outline_secondary, LV_STATE_EDITED);
+        add_style(list, &styles->btn, LV_PART_ITEMS);
+        add_style(list, &styles->disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
+        add_style(list, &styles->bg_color_white, LV_PART_ITEMS);
+        add_style(list, &styles->keyboard_btn_bg, LV_PART_ITEMS);
+        add_style(list, &styles->pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
+        add_style(list, &styles->bg_color_grey, LV_PART_ITEMS | LV_STATE_CHECKED);
+        add_style(list, &styles->bg_color_primary_muted, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->bg_color_secondary_muted, LV_PART_ITEMS | LV_STATE_EDITED);
     }
 #endif
 #if LV_USE_LIST
     else if(lv_obj_check_type(obj, &lv_list_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->list_bg, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+        add_style(list, &styles->card, 0);
+        add_style(list, &styles->list_bg, 0);
+        add_style(list, &styles->scrollbar, LV_PART_SCROLLBAR);
+        add_style(list, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
         return;
     }
     else if(lv_obj_check_type(obj, &lv_list_text_class)) {
-        lv_obj_add_style(obj, &styles->bg_color_grey, 0);
-        lv_obj_add_style(obj, &styles->list_item_grow, 0);
+        add_style(list, &styles->bg_color_grey, 0);
+        add_style(list, &styles->list_item_grow, 0);
     }
     else if(lv_obj_check_type(obj, &lv_list_btn_class)) {
-        lv_obj_add_style(obj, &styles->bg_color_white, 0);
-        lv_obj_add_style(obj, &styles->list_btn, 0);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->list_item_grow, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->list_item_grow, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->pressed, LV_STATE_PRESSED);
+        add_style(list, &styles->bg_color_white, 0);
+        add_style(list, &styles->list_btn, 0);
+        add_style(list, &styles->bg_color_primary, LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->list_item_grow, LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->list_item_grow, LV_STATE_PRESSED);
+        add_style(list, &styles->pressed, LV_STATE_PRESSED);
 
     }
 #endif
 #if LV_USE_MENU
     else if(lv_obj_check_type(obj, &lv_menu_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->menu_bg, 0);
+        add_style(list, &styles->card, 0);
+        add_style(list, &styles->menu_bg, 0);
     }
     else if(lv_obj_check_type(obj, &lv_menu_sidebar_cont_class)) {
-        lv_obj_add_style(obj, &styles->menu_sidebar_cont, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+        add_style(list, &styles->menu_sidebar_cont, 0);
+        add_style(list, &styles->scrollbar, LV_PART_SCROLLBAR);
+        add_style(list, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
     }
     else if(lv_obj_check_type(obj, &lv_menu_main_cont_class)) {
-        lv_obj_add_style(obj, &styles->menu_main_cont, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+        add_style(list, &styles->menu_main_cont, 0);
+        add_style(list, &styles->scrollbar, LV_PART_SCROLLBAR);
+        add_style(list, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
     }
     else if(lv_obj_check_type(obj, &lv_menu_cont_class)) {
-        lv_obj_add_style(obj, &styles->menu_cont, 0);
-        lv_obj_add_style(obj, &styles->menu_pressed, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &styles->bg_color_primary_muted, LV_STATE_PRESSED | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->bg_color_primary_muted, LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->menu_cont, 0);
+        add_style(list, &styles->menu_pressed, LV_STATE_PRESSED);
+        add_style(list, &styles->bg_color_primary_muted, LV_STATE_PRESSED | LV_STATE_CHECKED);
+        add_style(list, &styles->bg_color_primary_muted, LV_STATE_CHECKED);
+        add_style(list, &styles->bg_color_primary, LV_STATE_FOCUS_KEY);
     }
     else if(lv_obj_check_type(obj, &lv_menu_sidebar_header_cont_class) ||
             lv_obj_check_type(obj, &lv_menu_main_header_cont_class)) {
-        lv_obj_add_style(obj, &styles->menu_header_cont, 0);
+        add_style(list, &styles->menu_header_cont, 0);
     }
     else if(lv_obj_check_type(obj, &lv_menu_page_class)) {
-        lv_obj_add_style(obj, &styles->menu_page, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+        add_style(list, &styles->menu_page, 0);
+        add_style(list, &styles->scrollbar, LV_PART_SCROLLBAR);
+        add_style(list, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
     }
     else if(lv_obj_check_type(obj, &lv_menu_section_class)) {
-        lv_obj_add_style(obj, &styles->menu_section, 0);
+        add_style(list, &styles->menu_section, 0);
     }
     else if(lv_obj_check_type(obj, &lv_menu_separator_class)) {
-        lv_obj_add_style(obj, &styles->menu_separator, 0);
+        add_style(list, &styles->menu_separator, 0);
     }
 #endif
 #if LV_USE_MSGBOX
     else if(lv_obj_check_type(obj, &lv_msgbox_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->msgbox_bg, 0);
+        add_style(list, &styles->card, 0);
+        add_style(list, &styles->msgbox_bg, 0);
         return;
     }
     else if(lv_obj_check_type(obj, &lv_msgbox_backdrop_class)) {
-        lv_obj_add_style(obj, &styles->msgbox_backdrop_bg, 0);
+        add_style(list, &styles->msgbox_backdrop_bg, 0);
     }
 #endif
 #if LV_USE_SPINBOX
     else if(lv_obj_check_type(obj, &lv_spinbox_class)) {
-        lv_obj_add_style(obj, &styles->card, 0);
-        lv_obj_add_style(obj, &styles->pad_small, 0);
-        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &styles->outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &styles->bg_color_primary, LV_PART_CURSOR);
+        add_style(list, &styles->card, 0);
+        add_style(list, &styles->pad_small, 0);
+        add_style(list, &styles->outline_primary, LV_STATE_FOCUS_KEY);
+        add_style(list, &styles->outline_secondary, LV_STATE_EDITED);
+        add_style(list, &styles->bg_color_primary, LV_PART_CURSOR);
     }
 #endif
 #if LV_USE_TILEVIEW
     else if(lv_obj_check_type(obj, &lv_tileview_class)) {
-        lv_obj_add_style(obj, &styles->scr, 0);
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+        add_style(list, &styles->scr, 0);
+        add_style(list, &styles->scrollbar, LV_PART_SCROLLBAR);
+        add_style(list, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
     }
     else if(lv_obj_check_type(obj, &lv_tileview_tile_class)) {
-        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+        add_style(list, &styles->scrollbar, LV_PART_SCROLLBAR);
+        add_style(list, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
     }
 #endif
 
 #if LV_USE_TABVIEW
     else if(lv_obj_check_type(obj, &lv_tabview_class)) {
-        lv_obj_add_style(obj, &styles->scr, 0);
-        lv_obj_add_style(obj, &styles->pad_zero, 0);
+        add_style(list, &styles->scr, 0);
+        add_style(list, &styles->pad_zero, 0);
     }
 #endif
 
 #if LV_USE_WIN
     else if(lv_obj_check_type(obj, &lv_win_class)) {
-        lv_obj_add_style(obj, &styles->clip_corner, 0);
+        add_style(list, &styles->clip_corner, 0);
     }
 #endif
 
 #if LV_USE_COLORWHEEL
     else if(lv_obj_check_type(obj, &lv_colorwheel_class)) {
-        lv_obj_add_style(obj, &styles->colorwheel_main, 0);
-        lv_obj_add_style(obj, &styles->pad_normal, 0);
-        lv_obj_add_style(obj, &styles->bg_color_white, LV_PART_KNOB);
-        lv_obj_add_style(obj, &styles->pad_normal, LV_PART_KNOB);
+        add_style(list, &styles->colorwheel_main, 0);
+        add_style(list, &styles->pad_normal, 0);
+        add_style(list, &styles->bg_color_white, LV_PART_KNOB);
+        add_style(list, &styles->pad_normal, LV_PART_KNOB);
     }
 #endif
 
 #if LV_USE_LED
     else if(lv_obj_check_type(obj, &lv_led_class)) {
-        lv_obj_add_style(obj, &styles->led, 0);
+        add_style(list, &styles->led, 0);
     }
 #endif
 }
@@ -1162,6 +1182,19 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
  *   STATIC FUNCTIONS
  **********************/
 
+static void add_style(style_list_t * list, lv_style_t * style, lv_style_selector_t selector)
+{
+    /*Never happens with the styles of this theme, but add the collected styles if the list is full*/
+    if(list->cnt == STYLE_LIST_MAX) {
+        _lv_obj_add_styles(list->obj, list->styles, list->cnt);
+        list->cnt = 0;
+    }
+
+    list->styles[list->cnt].style = style;
+    list->styles[list->cnt].selector = selector;
+    list->cnt++;
+}
+
 static void style_init_reset(lv_style_t * style)
 {
     if(inited) {
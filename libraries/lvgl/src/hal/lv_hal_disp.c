@@ -126,7 +126,7 @@ void lv_disp_drv_init(lv_disp_drv_t * driver)
     driver->draw_ctx_size = sizeof(lv_draw_arm2d_ctx_t);
 #else
     driver->draw_ctx_init = lv_draw_sw_init_ctx;
-    driver->draw_ctx_deinit = lv_draw_sw_init_ctx;
+    driver->draw_ctx_deinit = lv_draw_sw_deinit_ctx;
     driver->draw_ctx_size = sizeof(lv_draw_sw_ctx_t);
 #endif
 
@@ -277,6 +277,8 @@ void lv_disp_drv_update(lv_disp_t * disp, lv_disp_drv_t * new_drv)
     lv_memset_00(disp->inv_areas, sizeof(disp->inv_areas));
     lv_memset_00(disp->inv_area_joined, sizeof(disp->inv_area_joined));
     disp->inv_p = 0;
+    disp->blit_ofs.x = 0;
+    disp->blit_ofs.y = 0;
     if(disp->act_scr != NULL) lv_obj_invalidate(disp->act_scr);
 
     lv_obj_tree_walk(NULL, invalidate_layout_cb, NULL);
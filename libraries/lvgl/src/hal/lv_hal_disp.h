@@ -99,6 +99,9 @@ typedef struct _lv_disp_drv_t {
     uint32_t rotated : 2;            /**< 1: turn the display by 90 degree. @warning Does not update coordinates for you!*/
     uint32_t screen_transp : 1;      /**Handle if the screen doesn't have a solid (opa == LV_OPA_COVER) background.
                                        * Use only if required because it's slower.*/
+    uint32_t scroll_blit : 1;        /**< 1: In direct mode move the already rendered pixels of the scrolled objects
+                                       * instead of redrawing them. Only if the draw buffers are shown as they are
+                                       * (e.g. RGB frame buffers) as the moved pixels are not flushed.*/
 
     uint32_t dpi : 10;              /** DPI (dot per inch) of the display. Default value is `LV_DPI_DEF`.*/
 
@@ -173,9 +176,14 @@ typedef struct _lv_disp_t {
     struct _lv_obj_t * top_layer;   /**< @see lv_disp_get_layer_top*/
     struct _lv_obj_t * sys_layer;   /**< @see lv_disp_get_layer_sys*/
     uint32_t screen_cnt;
+#if LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM
+    lv_img_dsc_t * act_scr_snapshot;    /**< Drawn instead of the active screen during screen animations*/
+    lv_img_dsc_t * prev_scr_snapshot;   /**< Drawn instead of the previous screen during screen animations*/
+#endif
     uint8_t draw_prev_over_act : 1; /**< 1: Draw previous screen over active screen*/
     uint8_t del_prev : 1;           /**< 1: Automatically delete the previous screen when the screen load anim. is ready*/
     uint8_t rendering_in_progress : 1; /**< 1: The current screen rendering is in progress*/
+    uint32_t refr_cnt;              /**< Number of refreshes which rendered something*/
 
     lv_opa_t bg_opa;                /**<Opacity of the background color or wallpaper*/
     lv_color_t bg_color;            /**< Default display color when screens are transparent*/
@@ -190,6 +198,10 @@ typedef struct _lv_disp_t {
     /** Double buffer sync areas */
     lv_ll_t sync_areas;
 
+    /*Pixels of a scrolled object to move before the next refresh. See `scroll_blit`*/
+    lv_area_t blit_area;
+    lv_point_t blit_ofs;
+
     /*Miscellaneous data*/
     uint32_t last_activity_time;        /**< Last time when there was activity on this display*/
 } lv_disp_t;
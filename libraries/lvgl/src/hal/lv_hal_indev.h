@@ -146,6 +146,11 @@ typedef struct _lv_indev_proc_t {
             lv_point_t scroll_sum; /*Count the dragged pixels to check LV_INDEV_DEF_SCROLL_LIMIT*/
             lv_point_t scroll_throw_vect;
             lv_point_t scroll_throw_vect_ori;
+            int32_t scroll_throw_v_q8;      /*Speed of the throw in 1/256 px per read period, 0: not started*/
+            int32_t scroll_throw_rem_q8;    /*The part of the move not scrolled yet in 1/256 px*/
+            uint32_t scroll_throw_tick;     /*Time of the last throw step*/
+            uint32_t scroll_throw_phase;    /*Elapsed time in the current read period [ms]*/
+            uint32_t scroll_throw_refr_cnt; /*`refr_cnt` of the display when the last step was scrolled*/
             struct _lv_obj_t * act_obj;      /*The object being pressed*/
             struct _lv_obj_t * last_obj;     /*The last object which was pressed*/
             struct _lv_obj_t * scroll_obj;   /*The object being scrolled*/
@@ -157,6 +162,7 @@ typedef struct _lv_indev_proc_t {
             lv_dir_t scroll_dir : 4;
             lv_dir_t gesture_dir : 4;
             uint8_t gesture_sent : 1;
+            uint8_t scroll_throw_wait_refr : 1; /*The last step of the throw is not refreshed yet*/
         } pointer;
         struct {
             /*Keypad data*/
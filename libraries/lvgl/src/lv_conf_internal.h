@@ -324,9 +324,14 @@
  * - LV_LAYER_SIMPLE_BUF_SIZE: [bytes] the optimal target buffer size. LVGL will try to allocate it
  * - LV_LAYER_SIMPLE_FALLBACK_BUF_SIZE: [bytes]  used if `LV_LAYER_SIMPLE_BUF_SIZE` couldn't be allocated.
  *
+ * - LV_LAYER_SIMPLE_BUF_REUSE: 1: keep the `LV_LAYER_SIMPLE_BUF_SIZE` buffer after a simple layer is drawn and reuse it
+ *   for the next simple layers instead of allocating it for each of them. The buffer stays allocated between refreshes.
+ *
  * Both buffer sizes are in bytes.
  * "Transformed layers" (where transform_angle/zoom properties are used) use larger buffers
  * and can't be drawn in chunks. So these settings affects only widgets with opacity.
+ * If the parts of a widget with opacity can't overlap (e.g. a plain rectangle or children next to each other)
+ * the opacity is applied to them directly without a layer.
  */
 #ifndef LV_LAYER_SIMPLE_BUF_SIZE
     #ifdef CONFIG_LV_LAYER_SIMPLE_BUF_SIZE
@@ -342,6 +347,17 @@
         #define LV_LAYER_SIMPLE_FALLBACK_BUF_SIZE (3 * 1024)
     #endif
 #endif
+#ifndef LV_LAYER_SIMPLE_BUF_REUSE
+    #ifdef _LV_KCONFIG_PRESENT
+        #ifdef CONFIG_LV_LAYER_SIMPLE_BUF_REUSE
+            #define LV_LAYER_SIMPLE_BUF_REUSE CONFIG_LV_LAYER_SIMPLE_BUF_REUSE
+        #else
+            #define LV_LAYER_SIMPLE_BUF_REUSE 0
+        #endif
+    #else
+        #define LV_LAYER_SIMPLE_BUF_REUSE         0
+    #endif
+#endif
 
 /*Default image cache size. Image caching keeps the images opened.
  *If only the built-in image formats are used there is no real advantage of caching. (I.e. if no new image decoder is added)
@@ -796,6 +812,38 @@
     #endif
 #endif
 
+/*1: Enable the trace points of the rendering pipeline (refresh, flush, timer handler)*/
+#ifndef LV_USE_PROFILER
+    #ifdef CONFIG_LV_USE_PROFILER
+        #define LV_USE_PROFILER CONFIG_LV_USE_PROFILER
+    #else
+        #define LV_USE_PROFILER 0
+    #endif
+#endif
+#if LV_USE_PROFILER
+    #ifndef LV_PROFILER_INCLUDE
+        #ifdef CONFIG_LV_PROFILER_INCLUDE
+            #define LV_PROFILER_INCLUDE CONFIG_LV_PROFILER_INCLUDE
+        #else
+            #define LV_PROFILER_INCLUDE <stdint.h>
+        #endif
+    #endif
+    #ifndef LV_PROFILER_BEGIN_TAG
+        #ifdef CONFIG_LV_PROFILER_BEGIN_TAG
+            #define LV_PROFILER_BEGIN_TAG CONFIG_LV_PROFILER_BEGIN_TAG
+        #else
+            #define LV_PROFILER_BEGIN_TAG(tag)
+        #endif
+    #endif
+    #ifndef LV_PROFILER_END_TAG
+        #ifdef CONFIG_LV_PROFILER_END_TAG
+            #define LV_PROFILER_END_TAG CONFIG_LV_PROFILER_END_TAG
+        #else
+            #define LV_PROFILER_END_TAG(tag)
+        #endif
+    #endif
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #ifndef LV_SPRINTF_CUSTOM
     #ifdef CONFIG_LV_SPRINTF_CUSTOM
@@ -1462,6 +1510,16 @@
         #define LV_USE_IMG        1   /*Requires: lv_label*/
     #endif
 #endif
+#if LV_USE_IMG
+    /*Memory of the rotated and zoomed images kept by `lv_img_set_transform_cache()` in bytes (0: disable)*/
+    #ifndef LV_IMG_TRANSFORM_CACHE_SIZE
+        #ifdef CONFIG_LV_IMG_TRANSFORM_CACHE_SIZE
+            #define LV_IMG_TRANSFORM_CACHE_SIZE CONFIG_LV_IMG_TRANSFORM_CACHE_SIZE
+        #else
+            #define LV_IMG_TRANSFORM_CACHE_SIZE 0
+        #endif
+    #endif
+#endif
 
 #ifndef LV_USE_LABEL
     #ifdef _LV_KCONFIG_PRESENT
@@ -2141,6 +2199,25 @@
         #define LV_USE_BMP 0
     #endif
 #endif
+#if LV_USE_BMP
+    /*Size of the buffer of the rows read from the file at once [bytes]. At least one row is read*/
+    #ifndef LV_BMP_READ_BUF_SIZE
+        #ifdef CONFIG_LV_BMP_READ_BUF_SIZE
+            #define LV_BMP_READ_BUF_SIZE CONFIG_LV_BMP_READ_BUF_SIZE
+        #else
+            #define LV_BMP_READ_BUF_SIZE (4 * 1024U)
+        #endif
+    #endif
+    /*Decode the whole image at once if it's at most this size [bytes] (0: disable).
+     *The decoded image is kept in the image cache (`LV_IMG_CACHE_DEF_SIZE`)*/
+    #ifndef LV_BMP_DECODE_MAX_SIZE
+        #ifdef CONFIG_LV_BMP_DECODE_MAX_SIZE
+            #define LV_BMP_DECODE_MAX_SIZE CONFIG_LV_BMP_DECODE_MAX_SIZE
+        #else
+            #define LV_BMP_DECODE_MAX_SIZE 0
+        #endif
+    #endif
+#endif
 
 /* JPG + split JPG decoder library.
  * Split JPG is a custom format optimized for embedded systems. */
@@ -2244,6 +2321,16 @@
         #define LV_USE_RLOTTIE 0
     #endif
 #endif
+#if LV_USE_RLOTTIE
+    /*Keep every converted frame of an animation if all of them fit into this many bytes (0: disable)*/
+    #ifndef LV_RLOTTIE_FRAME_CACHE_SIZE
+        #ifdef CONFIG_LV_RLOTTIE_FRAME_CACHE_SIZE
+            #define LV_RLOTTIE_FRAME_CACHE_SIZE CONFIG_LV_RLOTTIE_FRAME_CACHE_SIZE
+        #else
+            #define LV_RLOTTIE_FRAME_CACHE_SIZE 0
+        #endif
+    #endif
+#endif
 
 /*FFmpeg library for image decoding and playing videos
  *Supports all major image formats so do not enable other image decoder with it*/
@@ -2277,6 +2364,17 @@
         #define LV_USE_SNAPSHOT 0
     #endif
 #endif
+#if LV_USE_SNAPSHOT
+    /*1: Animate snapshots of the screens in `lv_scr_load_anim` instead of rendering the screens in every frame.
+     *Requires memory for two screen sized images during the animation*/
+    #ifndef LV_SNAPSHOT_SCR_LOAD_ANIM
+        #ifdef CONFIG_LV_SNAPSHOT_SCR_LOAD_ANIM
+            #define LV_SNAPSHOT_SCR_LOAD_ANIM CONFIG_LV_SNAPSHOT_SCR_LOAD_ANIM
+        #else
+            #define LV_SNAPSHOT_SCR_LOAD_ANIM 0
+        #endif
+    #endif
+#endif
 
 /*1: Enable Monkey test*/
 #ifndef LV_USE_MONKEY
@@ -2304,6 +2402,25 @@
         #define LV_USE_FRAGMENT 0
     #endif
 #endif
+#if LV_USE_FRAGMENT
+    /*Number of views in the navigation stack hidden instead of deleted on push. (0: disable caching)
+     *The cached views are shown again on pop without creating them again*/
+    #ifndef LV_FRAGMENT_CACHE_CNT
+        #ifdef CONFIG_LV_FRAGMENT_CACHE_CNT
+            #define LV_FRAGMENT_CACHE_CNT CONFIG_LV_FRAGMENT_CACHE_CNT
+        #else
+            #define LV_FRAGMENT_CACHE_CNT 0
+        #endif
+    #endif
+    /*Approximate memory the cached views of a fragment manager can use [bytes]*/
+    #ifndef LV_FRAGMENT_CACHE_SIZE
+        #ifdef CONFIG_LV_FRAGMENT_CACHE_SIZE
+            #define LV_FRAGMENT_CACHE_SIZE CONFIG_LV_FRAGMENT_CACHE_SIZE
+        #else
+            #define LV_FRAGMENT_CACHE_SIZE (16 * 1024U)
+        #endif
+    #endif
+#endif
 
 /*1: Support using images as font in label or span widgets */
 #ifndef LV_USE_IMGFONT
@@ -2323,6 +2440,15 @@
     #endif
 #endif
 
+/*1: Enable estimating the rendering cost of the objects*/
+#ifndef LV_USE_RENDER_COST
+    #ifdef CONFIG_LV_USE_RENDER_COST
+        #define LV_USE_RENDER_COST CONFIG_LV_USE_RENDER_COST
+    #else
+        #define LV_USE_RENDER_COST 0
+    #endif
+#endif
+
 /*1: Enable Pinyin input method*/
 /*Requires: lv_keyboard*/
 #ifndef LV_USE_IME_PINYIN
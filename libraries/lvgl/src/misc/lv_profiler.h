@@ -0,0 +1,47 @@
+/**
+ * @file lv_profiler.h
+ *
+ */
+
+#ifndef LV_PROFILER_H
+#define LV_PROFILER_H
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lv_conf_internal.h"
+
+/*Included outside of `extern "C"`, the profiler header may contain C++ code*/
+#if LV_USE_PROFILER && defined(LV_PROFILER_INCLUDE)
+#include LV_PROFILER_INCLUDE
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#if LV_USE_PROFILER
+
+/*Begin/end a trace slice named after the current function*/
+#define LV_PROFILER_BEGIN    LV_PROFILER_BEGIN_TAG(__func__)
+#define LV_PROFILER_END      LV_PROFILER_END_TAG(__func__)
+
+#else
+
+#define LV_PROFILER_BEGIN
+#define LV_PROFILER_END
+#define LV_PROFILER_BEGIN_TAG(tag)
+#define LV_PROFILER_END_TAG(tag)
+
+#endif /*LV_USE_PROFILER*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_PROFILER_H*/
@@ -11,6 +11,7 @@
 #include "lv_mem.h"
 #include "lv_ll.h"
 #include "lv_gc.h"
+#include "lv_profiler.h"
 
 /*********************
  *      DEFINES
@@ -81,6 +82,8 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
         return 1;
     }
 
+    LV_PROFILER_BEGIN;
+
     static uint32_t idle_period_start = 0;
     static uint32_t busy_time         = 0;
 
@@ -142,6 +145,7 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
     already_running = false; /*Release the mutex*/
 
     TIMER_TRACE("finished (%d ms until the next timer call)", time_till_next);
+    LV_PROFILER_END;
     return time_till_next;
 }
 
@@ -21,6 +21,9 @@
  *********************/
 #define MY_CLASS &lv_canvas_class
 
+#define BLUR_TILE_BUF_SIZE  (8 * 1024)  /*Memory of the column tiles of the vertical blur*/
+#define BLUR_DIV_R_MAX      4096        /*Sums of larger radii are divided, the reciprocal wouldn't be exact*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -32,6 +35,9 @@ static void lv_canvas_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj
 static void lv_canvas_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void init_fake_disp(lv_obj_t * canvas, lv_disp_t * disp, lv_disp_drv_t * drv, lv_area_t * clip_area);
 static void deinit_fake_disp(lv_obj_t * canvas, lv_disp_t * disp);
+static bool blur_is_true_color(lv_img_cf_t cf);
+static void blur_hor_true_color(lv_canvas_t * canvas, const lv_area_t * a, uint16_t r);
+static void blur_ver_true_color(lv_canvas_t * canvas, const lv_area_t * a, uint16_t r);
 
 /**********************
  *  STATIC VARIABLES
@@ -244,6 +250,12 @@ void lv_canvas_blur_hor(lv_obj_t * obj, const lv_area_t * area, uint16_t r)
         a.y2 = canvas->dsc.header.h - 1;
     }
 
+    if(blur_is_true_color(canvas->dsc.header.cf)) {
+        if(a.x1 <= a.x2 && a.y1 <= a.y2) blur_hor_true_color(canvas, &a, r);
+        lv_obj_invalidate(obj);
+        return;
+    }
+
     lv_color_t color = lv_obj_get_style_img_recolor(obj, LV_PART_MAIN);
 
     uint16_t r_back = r / 2;
@@ -372,6 +384,12 @@ void lv_canvas_blur_ver(lv_obj_t * obj, const lv_area_t * area, uint16_t r)
         a.y2 = canvas->dsc.header.h - 1;
     }
 
+    if(blur_is_true_color(canvas->dsc.header.cf)) {
+        if(a.x1 <= a.x2 && a.y1 <= a.y2) blur_ver_true_color(canvas, &a, r);
+        lv_obj_invalidate(obj);
+        return;
+    }
+
     lv_color_t color = lv_obj_get_style_img_recolor(obj, LV_PART_MAIN);
 
     uint16_t r_back = r / 2;
@@ -827,4 +845,172 @@ static void deinit_fake_disp(lv_obj_t * canvas, lv_disp_t * disp)
     lv_mem_free(disp->driver->draw_ctx);
 }
 
+/**
+ * The true color formats are blurred with running sums of the unpacked channels, the others pixel by pixel
+ */
+static bool blur_is_true_color(lv_img_cf_t cf)
+{
+    return cf == LV_IMG_CF_TRUE_COLOR || cf == LV_IMG_CF_TRUE_COLOR_ALPHA || cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
+}
+
+/**
+ * Unpack pixels to 4 bytes per pixel: red, green, blue and alpha (`LV_OPA_COVER` without alpha)
+ */
+static void blur_unpack(const uint8_t * px, lv_coord_t cnt, uint32_t px_size, bool has_alpha, uint8_t * ch)
+{
+    for(lv_coord_t i = 0; i < cnt; i++) {
+        lv_color_t c;
+        lv_memcpy(&c, px, sizeof(c));
+        ch[0] = LV_COLOR_GET_R(c);
+        ch[1] = LV_COLOR_GET_G(c);
+        ch[2] = LV_COLOR_GET_B(c);
+        ch[3] = has_alpha ? px[px_size - 1] : LV_OPA_COVER;
+        px += px_size;
+        ch += 4;
+    }
+}
+
+static inline uint32_t blur_div(uint32_t sum, uint32_t inv, uint16_t r)
+{
+    /*Exact as the sums are at most `255 * r`*/
+    return inv ? (uint32_t)(((uint64_t)sum * inv) >> 32) : sum / r;
+}
+
+/**
+ * Store the average of the sums of a pixel
+ */
+static inline void blur_store(uint8_t * px, const uint32_t * sum, uint32_t inv, uint16_t r, uint32_t px_size,
+                              bool has_alpha)
+{
+    /*Like the pixel by pixel blur, keep the color of the pixels which are fully transparent in the whole window*/
+    if(sum[3]) {
+        lv_color_t c;
+        LV_COLOR_SET_R(c, blur_div(sum[0], inv, r));
+        LV_COLOR_SET_G(c, blur_div(sum[1], inv, r));
+        LV_COLOR_SET_B(c, blur_div(sum[2], inv, r));
+#if LV_COLOR_DEPTH == 32
+        c.ch.alpha = 0xff;
+#endif
+        lv_memcpy(px, &c, sizeof(c));
+    }
+    if(has_alpha) px[px_size - 1] = (uint8_t)blur_div(sum[3], inv, r);
+}
+
+static uint32_t blur_get_inv(uint16_t r)
+{
+    return (r > 1 && r < BLUR_DIV_R_MAX) ? (uint32_t)((((uint64_t)1) << 32) / r + 1) : 0;
+}
+
+/**
+ * Blur the rows of the area with running sums, the pixels of a row are unpacked once
+ */
+static void blur_hor_true_color(lv_canvas_t * canvas, const lv_area_t * a, uint16_t r)
+{
+    lv_coord_t r_back = (r - 1) / 2;
+    lv_coord_t r_front = r / 2;
+    bool has_alpha = lv_img_cf_has_alpha(canvas->dsc.header.cf);
+    uint32_t px_size = has_alpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    uint32_t stride = px_size * canvas->dsc.header.w;
+    uint32_t inv = blur_get_inv(r);
+
+    /*The pixels which can be in the window of the area, the ones out of the canvas are clamped to the edge*/
+    lv_coord_t x_lo = LV_MAX(0, a->x1 - r_back);
+    lv_coord_t x_hi = LV_MIN(canvas->dsc.header.w - 1, a->x2 + 1 + r_front);
+    uint8_t * ch = lv_mem_buf_get((x_hi - x_lo + 1) * 4);
+    if(ch == NULL) return;
+
+    for(lv_coord_t y = a->y1; y <= a->y2; y++) {
+        uint8_t * row = (uint8_t *)canvas->dsc.data + y * stride;
+        blur_unpack(row + x_lo * px_size, x_hi - x_lo + 1, px_size, has_alpha, ch);
+
+        uint32_t sum[4] = {0, 0, 0, 0};
+        for(lv_coord_t x = a->x1 - r_back; x <= a->x1 + r_front; x++) {
+            const uint8_t * c = ch + (LV_CLAMP(x_lo, x, x_hi) - x_lo) * 4;
+            sum[0] += c[0];
+            sum[1] += c[1];
+            sum[2] += c[2];
+            sum[3] += c[3];
+        }
+
+        for(lv_coord_t x = a->x1; x <= a->x2; x++) {
+            blur_store(row + x * px_size, sum, inv, r, px_size, has_alpha);
+
+            const uint8_t * c_out = ch + (LV_MAX(x - r_back, x_lo) - x_lo) * 4;
+            const uint8_t * c_in = ch + (LV_MIN(x + 1 + r_front, x_hi) - x_lo) * 4;
+            sum[0] += c_in[0] - c_out[0];
+            sum[1] += c_in[1] - c_out[1];
+            sum[2] += c_in[2] - c_out[2];
+            sum[3] += c_in[3] - c_out[3];
+        }
+    }
+
+    lv_mem_buf_release(ch);
+}
+
+/**
+ * Blur the columns of the area with running sums. The columns are processed in tiles, row by row, so the memory is
+ * read in order. The original pixels of the rows already blurred but still in the window are kept in a ring buffer.
+ */
+static void blur_ver_true_color(lv_canvas_t * canvas, const lv_area_t * a, uint16_t r)
+{
+    lv_coord_t r_back = (r - 1) / 2;
+    lv_coord_t r_front = r / 2;
+    lv_coord_t h = canvas->dsc.header.h;
+    bool has_alpha = lv_img_cf_has_alpha(canvas->dsc.header.cf);
+    uint32_t px_size = has_alpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    uint32_t stride = px_size * canvas->dsc.header.w;
+    uint32_t inv = blur_get_inv(r);
+    uint8_t * data = (uint8_t *)canvas->dsc.data;
+
+    /*The row leaving the window was blurred at most `r_back` rows before*/
+    lv_coord_t ring_rows = LV_MIN(r_back + 1, a->y2 - a->y1 + 1);
+    uint32_t col_size = ring_rows * 4 + 4 + 4 * sizeof(uint32_t);
+    lv_coord_t tile_w = LV_CLAMP(1, (lv_coord_t)(BLUR_TILE_BUF_SIZE / col_size), a->x2 - a->x1 + 1);
+
+    uint8_t * tmp = lv_mem_buf_get(tile_w * 4);
+    uint32_t * sum = lv_mem_buf_get(tile_w * 4 * sizeof(uint32_t));
+    uint8_t * ring = lv_mem_buf_get(ring_rows * tile_w * 4);
+    if(tmp == NULL || sum == NULL || ring == NULL) {
+        if(tmp) lv_mem_buf_release(tmp);
+        if(sum) lv_mem_buf_release(sum);
+        if(ring) lv_mem_buf_release(ring);
+        return;
+    }
+
+    for(lv_coord_t tx = a->x1; tx <= a->x2; tx += tile_w) {
+        lv_coord_t tw = LV_MIN(tile_w, a->x2 - tx + 1);
+        uint8_t * tile = data + tx * px_size;
+
+        lv_memset_00(sum, tw * 4 * sizeof(uint32_t));
+        for(lv_coord_t y = a->y1 - r_back; y <= a->y1 + r_front; y++) {
+            blur_unpack(tile + LV_CLAMP(0, y, h - 1) * stride, tw, px_size, has_alpha, tmp);
+            for(lv_coord_t i = 0; i < tw * 4; i++) sum[i] += tmp[i];
+        }
+
+        for(lv_coord_t y = a->y1; y <= a->y2; y++) {
+            uint8_t * row = tile + y * stride;
+            blur_unpack(row, tw, px_size, has_alpha, ring + ((y - a->y1) % ring_rows) * tw * 4);
+            for(lv_coord_t i = 0; i < tw; i++) {
+                blur_store(row + i * px_size, &sum[i * 4], inv, r, px_size, has_alpha);
+            }
+            if(y == a->y2) break;
+
+            /*The row leaving the window is blurred already if it's in the area*/
+            lv_coord_t y_out = LV_MAX(y - r_back, 0);
+            const uint8_t * c_out = tmp;
+            if(y_out >= a->y1) c_out = ring + ((y_out - a->y1) % ring_rows) * tw * 4;
+            else blur_unpack(tile + y_out * stride, tw, px_size, has_alpha, tmp);
+            for(lv_coord_t i = 0; i < tw * 4; i++) sum[i] -= c_out[i];
+
+            lv_coord_t y_in = LV_MIN(y + 1 + r_front, h - 1);
+            blur_unpack(tile + y_in * stride, tw, px_size, has_alpha, tmp);
+            for(lv_coord_t i = 0; i < tw * 4; i++) sum[i] += tmp[i];
+        }
+    }
+
+    lv_mem_buf_release(tmp);
+    lv_mem_buf_release(sum);
+    lv_mem_buf_release(ring);
+}
+
 #endif
@@ -16,15 +16,27 @@
 #include "../misc/lv_txt.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_log.h"
+#include "../core/lv_refr.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS &lv_img_class
 
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    #define TRANSFORM_CACHE_MAX_RES 2047    /*Largest width and height of an `lv_img_header_t`*/
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+typedef struct _lv_img_transform_cache_t {
+    lv_img_dsc_t dsc;   /*The transformed pixels, they are drawn without transformation*/
+    lv_area_t area;     /*The transformed area relative to the image*/
+    uint32_t size;      /*Allocated bytes, counted in `transform_cache_used`*/
+} lv_img_transform_cache_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -33,6 +45,12 @@ static void lv_img_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_img_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_img_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_img(lv_event_t * e);
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+static void transform_cache_free(lv_img_t * img);
+static void transform_cache_reset(lv_obj_t * obj);
+static const lv_img_transform_cache_t * transform_cache_get(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx,
+                                                            const lv_draw_img_dsc_t * dsc);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -47,6 +65,10 @@ const lv_obj_class_t lv_img_class = {
     .base_class = &lv_obj_class
 };
 
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+static uint32_t transform_cache_used;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -103,6 +125,10 @@ void lv_img_set_src(lv_obj_t * obj, const void * src)
         return;
     }
 
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    transform_cache_reset(obj);
+#endif
+
     lv_img_header_t header;
     lv_img_decoder_get_info(src, &header);
 
@@ -200,6 +226,9 @@ void lv_img_set_angle(lv_obj_t * obj, int16_t angle)
     lv_obj_invalidate_area(obj, &a);
 
     img->angle = angle;
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    transform_cache_reset(obj);
+#endif
 
     /* Disable invalidations because lv_obj_refresh_ext_draw_size would invalidate
      * the whole ext draw area */
@@ -234,6 +263,9 @@ void lv_img_set_pivot(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
 
     img->pivot.x = x;
     img->pivot.y = y;
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    transform_cache_reset(obj);
+#endif
 
     /* Disable invalidations because lv_obj_refresh_ext_draw_size would invalidate
      * the whole ext draw area */
@@ -269,6 +301,9 @@ void lv_img_set_zoom(lv_obj_t * obj, uint16_t zoom)
     lv_obj_invalidate_area(obj, &a);
 
     img->zoom = zoom;
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    transform_cache_reset(obj);
+#endif
 
     /* Disable invalidations because lv_obj_refresh_ext_draw_size would invalidate
      * the whole ext draw area */
@@ -291,6 +326,9 @@ void lv_img_set_antialias(lv_obj_t * obj, bool antialias)
     if(antialias == img->antialias) return;
 
     img->antialias = antialias;
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    transform_cache_reset(obj);
+#endif
     lv_obj_invalidate(obj);
 }
 
@@ -304,6 +342,19 @@ void lv_img_set_size_mode(lv_obj_t * obj, lv_img_size_mode_t mode)
     lv_obj_invalidate(obj);
 }
 
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+void lv_img_set_transform_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_img_t * img = (lv_img_t *)obj;
+    if(en == img->transform_cache_en) return;
+
+    if(!en) transform_cache_free(img);
+    img->transform_cache_en = en;
+    transform_cache_reset(obj);
+}
+#endif
+
 /*=====================
  * Getter functions
  *====================*/
@@ -378,6 +429,20 @@ lv_img_size_mode_t lv_img_get_size_mode(lv_obj_t * obj)
     return img->obj_size_mode;
 }
 
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+bool lv_img_get_transform_cache(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_img_t * img = (lv_img_t *)obj;
+    return img->transform_cache_en ? true : false;
+}
+
+uint32_t lv_img_get_transform_cache_used(void)
+{
+    return transform_cache_used;
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -402,6 +467,12 @@ static void lv_img_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     img->pivot.x = 0;
     img->pivot.y = 0;
     img->obj_size_mode = LV_IMG_SIZE_MODE_VIRTUAL;
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    img->transform_cache_en = 0;
+    img->transform_cache_skip = 0;
+    img->transform_refr_cnt = 0;
+    img->transform_cache = NULL;
+#endif
 
     lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_add_flag(obj, LV_OBJ_FLAG_ADV_HITTEST);
@@ -413,6 +484,9 @@ static void lv_img_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 {
     LV_UNUSED(class_p);
     lv_img_t * img = (lv_img_t *)obj;
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    transform_cache_free(img);
+#endif
     if(img->src_type == LV_IMG_SRC_FILE || img->src_type == LV_IMG_SRC_SYMBOL) {
         lv_mem_free((void *)img->src);
         img->src      = NULL;
@@ -644,6 +718,14 @@ static void draw_img(lv_event_t * e)
                 img_dsc.pivot.y = img->pivot.y;
                 img_dsc.antialias = img->antialias;
 
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+                /*Draw the kept transformed image as it is*/
+                const lv_img_transform_cache_t * transform_cache = transform_cache_get(obj, draw_ctx, &img_dsc);
+                lv_draw_img_dsc_t cache_dsc = img_dsc;
+                cache_dsc.angle = 0;
+                cache_dsc.zoom = LV_IMG_ZOOM_NONE;
+#endif
+
                 lv_area_t img_clip_area;
                 img_clip_area.x1 = bg_coords.x1 + pleft;
                 img_clip_area.y1 = bg_coords.y1 + ptop;
@@ -667,6 +749,14 @@ static void draw_img(lv_event_t * e)
                     coords_tmp.x2 = coords_tmp.x1 + img->w - 1;
 
                     for(; coords_tmp.x1 < img_max_area.x2; coords_tmp.x1 += img_size_final.x, coords_tmp.x2 += img_size_final.x) {
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+                        if(transform_cache) {
+                            lv_area_t cache_coords = transform_cache->area;
+                            lv_area_move(&cache_coords, coords_tmp.x1, coords_tmp.y1);
+                            lv_draw_img(draw_ctx, &cache_dsc, &cache_coords, &transform_cache->dsc);
+                            continue;
+                        }
+#endif
                         lv_draw_img(draw_ctx, &img_dsc, &coords_tmp, img->src);
                     }
                 }
@@ -688,4 +778,123 @@ static void draw_img(lv_event_t * e)
     }
 }
 
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+static void transform_cache_free(lv_img_t * img)
+{
+    if(img->transform_cache == NULL) return;
+
+    /*A new cache can be allocated at the same address*/
+    lv_img_cache_invalidate_src(&img->transform_cache->dsc);
+    transform_cache_used -= img->transform_cache->size;
+    lv_mem_free(img->transform_cache);
+    img->transform_cache = NULL;
+}
+
+/**
+ * Free the transformed image as the transformation or the source has changed.
+ * It's not created again until a refresh has drawn the image without changes.
+ */
+static void transform_cache_reset(lv_obj_t * obj)
+{
+    lv_img_t * img = (lv_img_t *)obj;
+    if(!img->transform_cache_en) return;
+
+    transform_cache_free(img);
+    img->transform_cache_skip = 0;
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    img->transform_refr_cnt = disp ? disp->refr_cnt : 0;
+}
+
+static const lv_img_transform_cache_t * transform_cache_get(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx,
+                                                            const lv_draw_img_dsc_t * dsc)
+{
+    lv_img_t * img = (lv_img_t *)obj;
+    if(img->transform_cache) return img->transform_cache;
+    if(!img->transform_cache_en || img->transform_cache_skip) return NULL;
+    if(img->angle == 0 && img->zoom == LV_IMG_ZOOM_NONE) return NULL;
+    if(draw_ctx->draw_transform == NULL) return NULL;
+
+    /*Still animated?*/
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    if(disp == NULL || disp->refr_cnt == img->transform_refr_cnt) return NULL;
+
+    lv_area_t area;
+    _lv_img_buf_get_transformed_area(&area, img->w, img->h, img->angle, img->zoom, &img->pivot);
+    lv_coord_t w = lv_area_get_width(&area);
+    lv_coord_t h = lv_area_get_height(&area);
+    if(w > TRANSFORM_CACHE_MAX_RES || h > TRANSFORM_CACHE_MAX_RES) return NULL;
+
+    uint32_t px_cnt = (uint32_t)w * h;
+    uint32_t size = sizeof(lv_img_transform_cache_t) + px_cnt * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    if(transform_cache_used + size > LV_IMG_TRANSFORM_CACHE_SIZE) return NULL;
+
+    /*Only the fully decoded images are transformed, see `lv_draw_img`*/
+    _lv_img_cache_entry_t * cdsc = _lv_img_cache_open(img->src, dsc->recolor, dsc->frame_id);
+    if(cdsc == NULL) {
+        img->transform_cache_skip = 1;
+        return NULL;
+    }
+
+    lv_img_cf_t cf;
+    if(lv_img_cf_is_chroma_keyed(cdsc->dec_dsc.header.cf)) cf = LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
+    else if(LV_IMG_CF_ALPHA_8BIT == cdsc->dec_dsc.header.cf) cf = LV_IMG_CF_ALPHA_8BIT;
+    else if(LV_IMG_CF_RGB565A8 == cdsc->dec_dsc.header.cf) cf = LV_IMG_CF_RGB565A8;
+    else if(lv_img_cf_has_alpha(cdsc->dec_dsc.header.cf)) cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    else cf = LV_IMG_CF_TRUE_COLOR;
+
+    lv_img_transform_cache_t * cache = NULL;
+    if(cdsc->dec_dsc.error_msg || cdsc->dec_dsc.img_data == NULL || cf == LV_IMG_CF_ALPHA_8BIT) {
+        img->transform_cache_skip = 1;
+    }
+    else {
+        cache = lv_mem_alloc(size);
+    }
+
+    if(cache) {
+        uint8_t * data = (uint8_t *)(cache + 1);
+        const uint8_t * src_buf = cdsc->dec_dsc.img_data;
+        lv_memset_00(&cache->dsc, sizeof(cache->dsc));
+        cache->dsc.header.w = w;
+        cache->dsc.header.h = h;
+        cache->dsc.data_size = px_cnt * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        cache->dsc.data = data;
+        cache->area = area;
+        cache->size = size;
+
+#if LV_COLOR_DEPTH == 16
+        /*The colors and the alpha are in separate planes so they are blended directly*/
+        cache->dsc.header.cf = LV_IMG_CF_RGB565A8;
+        lv_draw_transform(draw_ctx, &area, src_buf, img->w, img->h, img->w, dsc, cf,
+                          (lv_color_t *)data, data + px_cnt * sizeof(lv_color_t));
+#else
+        cache->dsc.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+        lv_color_t * cbuf = lv_mem_buf_get(w * sizeof(lv_color_t));
+        lv_opa_t * abuf = lv_mem_buf_get(w);
+        lv_area_t row = area;
+        for(row.y1 = area.y1; row.y1 <= area.y2; row.y1++) {
+            row.y2 = row.y1;
+            lv_draw_transform(draw_ctx, &row, src_buf, img->w, img->h, img->w, dsc, cf, cbuf, abuf);
+            for(lv_coord_t x = 0; x < w; x++) {
+                lv_memcpy_small(data, &cbuf[x], LV_IMG_PX_SIZE_ALPHA_BYTE - 1);
+                data[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = abuf[x];
+                data += LV_IMG_PX_SIZE_ALPHA_BYTE;
+            }
+        }
+        lv_mem_buf_release(abuf);
+        lv_mem_buf_release(cbuf);
+#endif
+
+        transform_cache_used += size;
+        img->transform_cache = cache;
+    }
+
+    /*Automatically close images with no caching*/
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    lv_img_decoder_close(&cdsc->dec_dsc);
+#endif
+
+    return cache;
+}
+#endif
+
 #endif
@@ -50,6 +50,12 @@ typedef struct {
     uint8_t cf : 5;        /*Color format from `lv_img_color_format_t`*/
     uint8_t antialias : 1; /*Apply anti-aliasing in transformations (rotate, zoom)*/
     uint8_t obj_size_mode: 2; /*Image size mode when image size and object size is different.*/
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    uint8_t transform_cache_en : 1;    /*Keep the transformed image, see `lv_img_set_transform_cache()`*/
+    uint8_t transform_cache_skip : 1;  /*The source can't be transformed at once, don't try again until it's changed*/
+    uint32_t transform_refr_cnt;       /*`refr_cnt` of the display when the transformation was changed*/
+    struct _lv_img_transform_cache_t * transform_cache;   /*The transformed image or NULL*/
+#endif
 } lv_img_t;
 
 extern const lv_obj_class_t lv_img_class;
@@ -156,6 +162,18 @@ void lv_img_set_antialias(lv_obj_t * obj, bool antialias);
  * @param mode      the new size mode.
  */
 void lv_img_set_size_mode(lv_obj_t * obj, lv_img_size_mode_t mode);
+
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+/**
+ * Keep the rotated and zoomed image once its angle, zoom, pivot and source haven't changed for a refresh.
+ * Redrawing it only copies the kept pixels. All the kept images share `LV_IMG_TRANSFORM_CACHE_SIZE` bytes.
+ * Call `lv_img_set_src()` again if the pixels of the source are modified.
+ * @param obj       pointer to an image object
+ * @param en        true: enable the cache; false: disable it and free the kept image
+ */
+void lv_img_set_transform_cache(lv_obj_t * obj, bool en);
+#endif
+
 /*=====================
  * Getter functions
  *====================*/
@@ -216,6 +234,21 @@ bool lv_img_get_antialias(lv_obj_t * obj);
  */
 lv_img_size_mode_t lv_img_get_size_mode(lv_obj_t * obj);
 
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+/**
+ * Get whether the transformed image is kept
+ * @param obj       pointer to an image object
+ * @return          true: the cache is enabled; false: disabled
+ */
+bool lv_img_get_transform_cache(lv_obj_t * obj);
+
+/**
+ * Get the memory used by the transformed images of all the image objects
+ * @return          size in bytes, at most `LV_IMG_TRANSFORM_CACHE_SIZE`
+ */
+uint32_t lv_img_get_transform_cache_used(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,539 @@
+/**
+ * @file lv_bench.c
+ *
+ * Headless benchmark of the rendering stack.
+ *
+ * Every scene of the benchmark demo is rendered at a fixed virtual time step into an in-memory display, so the
+ * rendered frames and the allocations only depend on the code, not on the speed of the host. The rotation kernels of
+ * the port, the invalidated area joining of the refresh, creating the widgets demo, decoding a BMP file through the
+ * stdio and POSIX file system drivers, blurring a canvas and redrawing a rotated image with and without the transform
+ * cache are measured too.
+ *
+ * Everything is run `--repeat` times and the fastest run is kept. The results are printed as CSV:
+ * `name,frames,ns_per_frame,px_per_s,allocs`. With `--baseline <file>` they are compared against a previous output and
+ * the program fails if any of them regressed.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "lvgl.h"
+#include "lv_demos.h"
+#if LV_BENCH_USE_PORT_ROTATE
+#include "lvgl_v8_port_rotate.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BENCH_HOR_RES           800
+#define BENCH_VER_RES           480
+#define BENCH_BUF_LINES         20          /*Same as `LVGL_PORT_BUFFER_SIZE_HEIGHT` of the port*/
+#define BENCH_FRAME_MS          LV_DISP_DEF_REFR_PERIOD
+#define BENCH_SCENE_MS          1050        /*A bit longer than a demo scene, so its report timer fires*/
+#define BENCH_ROTATE_ITER       20
+#define BENCH_JOIN_ITER         20000
+#define BENCH_CREATE_ITER       10
+#define BENCH_BMP_ITER          10
+#define BENCH_BMP_NAME          "lv_bench.bmp"
+#define BENCH_PATH_MAX          256
+#define BENCH_BLUR_ITER         10
+#define BENCH_IMG_SIZE          120
+#define BENCH_IMG_FRAMES        50
+#define BENCH_RESULT_MAX        128
+#define BENCH_NAME_MAX          48
+#define BENCH_TOLERANCE_DEF     20
+#define BENCH_REPEAT_DEF        3
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    char name[BENCH_NAME_MAX];
+    uint32_t frames;
+    double ns_per_frame;
+    double px_per_s;
+    uint32_t allocs;
+} bench_result_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint64_t time_ns(void);
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+static void bench_scenes(void);
+#if LV_BENCH_USE_PORT_ROTATE
+static void bench_rotate(void);
+#endif
+static void bench_join_area(void);
+static void bench_widgets_create(void);
+static void bench_bmp(void);
+static void bench_canvas_blur(void);
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+static void bench_img_transform(void);
+#endif
+static void result_add(const char * name, uint32_t frames, uint64_t ns, uint64_t px, uint32_t allocs);
+static const bench_result_t * result_find(const char * name);
+static int compare_baseline(const char * path, double tolerance, bool alloc_only);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint32_t alloc_cnt;
+static uint64_t flushed_px;
+static lv_disp_t * disp;
+static bench_result_t results[BENCH_RESULT_MAX];
+static uint32_t result_cnt;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_assert_fail(void)
+{
+    fprintf(stderr, "LVGL assertion failed\n");
+    abort();
+}
+
+void * lv_bench_alloc(size_t size)
+{
+    alloc_cnt++;
+    return malloc(size);
+}
+
+void * lv_bench_realloc(void * p, size_t size)
+{
+    alloc_cnt++;
+    return realloc(p, size);
+}
+
+void lv_bench_free(void * p)
+{
+    free(p);
+}
+
+int main(int argc, char * argv[])
+{
+    const char * baseline = NULL;
+    double tolerance = BENCH_TOLERANCE_DEF;
+    bool alloc_only = false;
+    int repeat = BENCH_REPEAT_DEF;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            baseline = argv[++i];
+        }
+        else if(strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = atof(argv[++i]);
+        }
+        else if(strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = atoi(argv[++i]);
+        }
+        else if(strcmp(argv[i], "--alloc-only") == 0) {
+            alloc_only = true;
+        }
+        else {
+            fprintf(stderr, "Usage: %s [--baseline <csv>] [--tolerance <percent>] [--repeat <n>] [--alloc-only]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    lv_init();
+
+    static lv_color_t buf[BENCH_HOR_RES * BENCH_BUF_LINES];
+    static lv_disp_draw_buf_t draw_buf;
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, BENCH_HOR_RES * BENCH_BUF_LINES);
+
+    static lv_disp_drv_t disp_drv;
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = BENCH_HOR_RES;
+    disp_drv.ver_res = BENCH_VER_RES;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    disp = lv_disp_drv_register(&disp_drv);
+
+    for(int i = 0; i < repeat; i++) {
+        bench_scenes();
+#if LV_BENCH_USE_PORT_ROTATE
+        bench_rotate();
+#endif
+        bench_join_area();
+        bench_widgets_create();
+        bench_bmp();
+        bench_canvas_blur();
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+        bench_img_transform();
+#endif
+    }
+
+    printf("name,frames,ns_per_frame,px_per_s,allocs\n");
+    for(uint32_t i = 0; i < result_cnt; i++) {
+        printf("%s,%" PRIu32 ",%.0f,%.0f,%" PRIu32 "\n", results[i].name, results[i].frames, results[i].ns_per_frame,
+               results[i].px_per_s, results[i].allocs);
+    }
+
+    return baseline ? compare_baseline(baseline, tolerance, alloc_only) : 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint64_t time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    LV_UNUSED(color_p);
+
+    flushed_px += lv_area_get_size(area);
+    lv_disp_flush_ready(drv);
+}
+
+static void bench_scenes(void)
+{
+    uint32_t scene_cnt = lv_demo_benchmark_get_scene_cnt() * 2;
+    uint32_t frames = BENCH_SCENE_MS / BENCH_FRAME_MS;
+
+    for(uint32_t scene_no = 0; scene_no < scene_cnt; scene_no++) {
+        lv_demo_benchmark_run_scene((int_fast16_t)scene_no);
+
+        /*The first frame draws the whole screen, it's not part of the scene*/
+        lv_tick_inc(BENCH_FRAME_MS);
+        lv_timer_handler();
+
+        uint64_t ns = 0;
+        flushed_px = 0;
+        alloc_cnt = 0;
+        for(uint32_t i = 0; i < frames; i++) {
+            lv_tick_inc(BENCH_FRAME_MS);
+            uint64_t start = time_ns();
+            lv_timer_handler();
+            ns += time_ns() - start;
+        }
+
+        char name[BENCH_NAME_MAX];
+        lv_snprintf(name, sizeof(name), "%s%s", lv_demo_benchmark_get_scene_name((int_fast16_t)scene_no),
+                    (scene_no & 1) ? " + opa" : "");
+        result_add(name, frames, ns, flushed_px, alloc_cnt);
+
+        lv_demo_benchmark_close();
+    }
+}
+
+#if LV_BENCH_USE_PORT_ROTATE
+static void bench_rotate(void)
+{
+    static lv_color_t from[BENCH_HOR_RES * BENCH_VER_RES];
+    static lv_color_t to[BENCH_HOR_RES * BENCH_VER_RES];
+    static const uint16_t rotates[] = {90, 180, 270};
+
+    for(uint32_t i = 0; i < sizeof(from) / sizeof(from[0]); i++) {
+        from[i] = lv_color_hex(i * 2654435761U);
+    }
+
+    for(uint32_t r = 0; r < sizeof(rotates) / sizeof(rotates[0]); r++) {
+        alloc_cnt = 0;
+        uint64_t start = time_ns();
+        for(uint32_t i = 0; i < BENCH_ROTATE_ITER; i++) {
+            rotate_copy_pixel((const uint8_t *)from, (uint8_t *)to, 0, 0, BENCH_HOR_RES - 1, BENCH_VER_RES - 1,
+                              BENCH_HOR_RES, BENCH_VER_RES, rotates[r]);
+        }
+        uint64_t ns = time_ns() - start;
+
+        char name[BENCH_NAME_MAX];
+        lv_snprintf(name, sizeof(name), "Port rotate %d", rotates[r]);
+        result_add(name, BENCH_ROTATE_ITER, ns, (uint64_t)BENCH_ROTATE_ITER * BENCH_HOR_RES * BENCH_VER_RES, alloc_cnt);
+    }
+}
+#endif
+
+/*Join a fixed, pseudo random set of invalidated areas, like small widgets updated in the same frame*/
+static void bench_join_area(void)
+{
+    static lv_area_t areas[LV_INV_BUF_SIZE];
+    uint32_t seed = 0x1234567;
+
+    for(uint32_t i = 0; i < LV_INV_BUF_SIZE; i++) {
+        seed = seed * 1103515245 + 12345;
+        lv_coord_t x = (lv_coord_t)((seed >> 8) % (BENCH_HOR_RES - 100));
+        seed = seed * 1103515245 + 12345;
+        lv_coord_t y = (lv_coord_t)((seed >> 8) % (BENCH_VER_RES - 60));
+        seed = seed * 1103515245 + 12345;
+        lv_area_set(&areas[i], x, y, x + 20 + (lv_coord_t)((seed >> 8) % 80), y + 10 + (lv_coord_t)((seed >> 16) % 50));
+    }
+
+    lv_disp_t * disp_ori = _lv_refr_get_disp_refreshing();
+    _lv_refr_set_disp_refreshing(disp);
+
+    uint64_t ns = 0;
+    alloc_cnt = 0;
+    for(uint32_t i = 0; i < BENCH_JOIN_ITER; i++) {
+        lv_memcpy(disp->inv_areas, areas, sizeof(areas));
+        lv_memset_00(disp->inv_area_joined, sizeof(disp->inv_area_joined));
+        disp->inv_p = LV_INV_BUF_SIZE;
+
+        uint64_t start = time_ns();
+        _lv_refr_join_area();
+        ns += time_ns() - start;
+    }
+
+    disp->inv_p = 0;
+    _lv_refr_set_disp_refreshing(disp_ori);
+
+    result_add("Refr join area", BENCH_JOIN_ITER, ns, 0, alloc_cnt);
+}
+
+/*Build the screens of the widgets demo, i.e. create the widgets and apply the theme to them*/
+static void bench_widgets_create(void)
+{
+    uint64_t ns = 0;
+    alloc_cnt = 0;
+    for(uint32_t i = 0; i < BENCH_CREATE_ITER; i++) {
+        uint64_t start = time_ns();
+        lv_demo_widgets();
+        ns += time_ns() - start;
+        lv_demo_widgets_close();
+    }
+
+    result_add("Widgets demo create", BENCH_CREATE_ITER, ns, 0, alloc_cnt);
+}
+
+/*Decode a full screen BMP file line by line, as the image drawing does when the image isn't cached*/
+static void bench_bmp(void)
+{
+    static const char letters[] = {'A', 'B'};
+    static const char * names[] = {"BMP decode stdio", "BMP decode posix"};
+    static uint8_t line[BENCH_HOR_RES * sizeof(lv_color_t)];
+    uint32_t row_size = (BENCH_HOR_RES * LV_COLOR_SIZE / 8 + 3) & ~3U;
+    uint8_t header[54] = {'B', 'M'};
+    uint32_t u32;
+    uint16_t u16;
+
+    /*In a new directory, so parallel runs don't overwrite each other's file*/
+    const char * tmp_dir = getenv("TMPDIR");
+    char dir[BENCH_PATH_MAX];
+    char path[BENCH_PATH_MAX];
+    snprintf(dir, sizeof(dir), "%s/lv_bench_XXXXXX", tmp_dir && tmp_dir[0] ? tmp_dir : "/tmp");
+    if(mkdtemp(dir) == NULL) {
+        fprintf(stderr, "Can't create a directory for %s\n", BENCH_BMP_NAME);
+        exit(2);
+    }
+
+    FILE * f = NULL;
+    if(snprintf(path, sizeof(path), "%s/" BENCH_BMP_NAME, dir) < (int)sizeof(path)) f = fopen(path, "wb");
+    if(f == NULL) {
+        fprintf(stderr, "Can't create %s\n", path);
+        rmdir(dir);
+        exit(2);
+    }
+    u32 = sizeof(header) + row_size * BENCH_VER_RES;
+    memcpy(header + 2, &u32, 4);
+    u32 = sizeof(header);
+    memcpy(header + 10, &u32, 4);
+    u32 = 40;
+    memcpy(header + 14, &u32, 4);
+    u32 = BENCH_HOR_RES;
+    memcpy(header + 18, &u32, 4);
+    u32 = BENCH_VER_RES;
+    memcpy(header + 22, &u32, 4);
+    u16 = 1;
+    memcpy(header + 26, &u16, 2);
+    u16 = LV_COLOR_DEPTH == 32 ? 24 : LV_COLOR_DEPTH;
+    memcpy(header + 28, &u16, 2);
+    fwrite(header, 1, sizeof(header), f);
+    for(uint32_t i = 0; i < row_size * BENCH_VER_RES; i++) fputc((int)(i * 2654435761U >> 24), f);
+    fclose(f);
+
+    for(uint32_t p = 0; p < sizeof(letters) / sizeof(letters[0]); p++) {
+        char fs_path[BENCH_PATH_MAX + 2];
+        snprintf(fs_path, sizeof(fs_path), "%c:%s", letters[p], path);
+        uint64_t ns = 0;
+        alloc_cnt = 0;
+        for(uint32_t i = 0; i < BENCH_BMP_ITER; i++) {
+            uint64_t start = time_ns();
+            lv_img_decoder_dsc_t dsc;
+            if(lv_img_decoder_open(&dsc, fs_path, lv_color_white(), 0) != LV_RES_OK) {
+                fprintf(stderr, "Can't decode %s\n", fs_path);
+                exit(2);
+            }
+            for(lv_coord_t y = 0; y < BENCH_VER_RES; y++) {
+                lv_img_decoder_read_line(&dsc, 0, y, BENCH_HOR_RES, line);
+            }
+            lv_img_decoder_close(&dsc);
+            ns += time_ns() - start;
+        }
+
+        result_add(names[p], BENCH_BMP_ITER, ns, (uint64_t)BENCH_BMP_ITER * BENCH_HOR_RES * BENCH_VER_RES, alloc_cnt);
+    }
+
+    remove(path);
+    rmdir(dir);
+}
+
+/*Blur a canvas horizontally then vertically, as for a frosted glass background, with several radii and areas*/
+static void bench_canvas_blur(void)
+{
+    static lv_color_t buf[BENCH_HOR_RES * BENCH_VER_RES];
+    static const lv_coord_t sizes[][2] = {{160, 120}, {480, 272}};
+    static const uint16_t radii[] = {4, 16, 64};
+
+    for(uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        lv_coord_t w = sizes[s][0];
+        lv_coord_t h = sizes[s][1];
+        lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+        lv_canvas_set_buffer(canvas, buf, w, h, LV_IMG_CF_TRUE_COLOR);
+
+        for(uint32_t r = 0; r < sizeof(radii) / sizeof(radii[0]); r++) {
+            for(uint32_t i = 0; i < (uint32_t)w * h; i++) {
+                buf[i] = lv_color_hex(i * 2654435761U);
+            }
+
+            alloc_cnt = 0;
+            uint64_t start = time_ns();
+            for(uint32_t i = 0; i < BENCH_BLUR_ITER; i++) {
+                lv_canvas_blur_hor(canvas, NULL, radii[r]);
+                lv_canvas_blur_ver(canvas, NULL, radii[r]);
+            }
+            uint64_t ns = time_ns() - start;
+
+            char name[BENCH_NAME_MAX];
+            lv_snprintf(name, sizeof(name), "Canvas blur %dx%d r%d", w, h, radii[r]);
+            result_add(name, BENCH_BLUR_ITER, ns, (uint64_t)BENCH_BLUR_ITER * w * h, alloc_cnt);
+        }
+
+        lv_obj_del(canvas);
+    }
+}
+
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+static void bench_img_transform(void)
+{
+    static lv_color_t px[BENCH_IMG_SIZE * BENCH_IMG_SIZE];
+    static lv_img_dsc_t dsc;
+    static const char * names[] = {"Image rotated", "Image rotated cached"};
+
+    for(uint32_t i = 0; i < sizeof(px) / sizeof(px[0]); i++) {
+        px[i] = lv_color_hex(i * 2654435761U);
+    }
+    dsc.header.cf = LV_IMG_CF_TRUE_COLOR;
+    dsc.header.w = BENCH_IMG_SIZE;
+    dsc.header.h = BENCH_IMG_SIZE;
+    dsc.data_size = sizeof(px);
+    dsc.data = (const uint8_t *)px;
+
+    for(uint32_t c = 0; c < 2; c++) {
+        lv_obj_t * img = lv_img_create(lv_scr_act());
+        lv_img_set_src(img, &dsc);
+        lv_obj_center(img);
+        lv_img_set_angle(img, 300);
+        lv_img_set_zoom(img, 384);
+        lv_img_set_transform_cache(img, c == 1);
+
+        /*The cache is created by the second refresh*/
+        lv_refr_now(disp);
+        lv_obj_invalidate(img);
+        lv_refr_now(disp);
+
+        uint64_t ns = 0;
+        flushed_px = 0;
+        alloc_cnt = 0;
+        for(uint32_t i = 0; i < BENCH_IMG_FRAMES; i++) {
+            lv_obj_invalidate(img);
+            uint64_t start = time_ns();
+            lv_refr_now(disp);
+            ns += time_ns() - start;
+        }
+        result_add(names[c], BENCH_IMG_FRAMES, ns, flushed_px, alloc_cnt);
+
+        lv_obj_del(img);
+        lv_refr_now(disp);
+    }
+}
+#endif
+
+/*Keep the fastest run, the allocations of the first run are kept as the caches are warm after it*/
+static void result_add(const char * name, uint32_t frames, uint64_t ns, uint64_t px, uint32_t allocs)
+{
+    bench_result_t * res = (bench_result_t *)result_find(name);
+    if(res != NULL) {
+        double ns_per_frame = frames ? (double)ns / frames : 0;
+        if(ns_per_frame < res->ns_per_frame) {
+            res->ns_per_frame = ns_per_frame;
+            res->px_per_s = ns ? (double)px * 1e9 / (double)ns : 0;
+        }
+        return;
+    }
+
+    if(result_cnt >= BENCH_RESULT_MAX) {
+        fprintf(stderr, "Too many results, increase `BENCH_RESULT_MAX`\n");
+        exit(2);
+    }
+
+    res = &results[result_cnt++];
+    lv_snprintf(res->name, sizeof(res->name), "%s", name);
+    res->frames = frames;
+    res->ns_per_frame = frames ? (double)ns / frames : 0;
+    res->px_per_s = ns ? (double)px * 1e9 / (double)ns : 0;
+    res->allocs = allocs;
+}
+
+static const bench_result_t * result_find(const char * name)
+{
+    for(uint32_t i = 0; i < result_cnt; i++) {
+        if(strcmp(results[i].name, name) == 0) return &results[i];
+    }
+
+    return NULL;
+}
+
+/*Any extra allocation is a regression, the time is allowed to be `tolerance` percent slower*/
+static int compare_baseline(const char * path, double tolerance, bool alloc_only)
+{
+    FILE * f = fopen(path, "r");
+    if(f == NULL) {
+        fprintf(stderr, "Can't open the baseline %s\n", path);
+        return 2;
+    }
+
+    int regressions = 0;
+    char line[128];
+    while(fgets(line, sizeof(line), f)) {
+        bench_result_t base;
+        if(sscanf(line, "%47[^,],%" SCNu32 ",%lf,%lf,%" SCNu32, base.name, &base.frames, &base.ns_per_frame,
+                  &base.px_per_s, &base.allocs) != 5) {
+            continue;
+        }
+
+        const bench_result_t * res = result_find(base.name);
+        if(res == NULL) {
+            fprintf(stderr, "%s: missing\n", base.name);
+            regressions++;
+            continue;
+        }
+        if(res->allocs > base.allocs) {
+            fprintf(stderr, "%s: allocs %" PRIu32 " -> %" PRIu32 "\n", base.name, base.allocs, res->allocs);
+            regressions++;
+        }
+        if(!alloc_only && res->ns_per_frame > base.ns_per_frame * (1 + tolerance / 100)) {
+            fprintf(stderr, "%s: ns/frame %.0f -> %.0f (+%.1f%%)\n", base.name, base.ns_per_frame, res->ns_per_frame,
+                    (res->ns_per_frame / base.ns_per_frame - 1) * 100);
+            regressions++;
+        }
+    }
+    fclose(f);
+
+    if(regressions) fprintf(stderr, "%d regression(s) against %s\n", regressions, path);
+
+    return regressions ? 1 : 0;
+}
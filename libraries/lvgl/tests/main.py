@@ -24,14 +24,20 @@ test_options = {
     'OPTIONS_TEST_DEFHEAP': 'Test config, LVGL heap, 32 bit color depth',
 }
 
+bench_options = {
+    'OPTIONS_BENCH': 'Benchmark config, 16 bit color depth',
+}
+
 
 def is_valid_option_name(option_name):
-    return option_name in build_only_options or option_name in test_options
+    return option_name in build_only_options or option_name in test_options or option_name in bench_options
 
 
 def get_option_description(option_name):
     if option_name in build_only_options:
         return build_only_options[option_name]
+    if option_name in bench_options:
+        return bench_options[option_name]
     return test_options[option_name]
 
 
@@ -126,6 +132,21 @@ def run_tests(options_name):
         ['ctest', '--timeout', '30', '--parallel', str(os.cpu_count()), '--output-on-failure'])
 
 
+def run_bench(options_name, baseline, tolerance):
+    '''Run the benchmark and compare it with the baseline.'''
+
+    print()
+    print()
+    label = 'Running benchmark for %s' % options_abbrev(options_name)
+    print('=' * len(label))
+    print(label)
+    print('=' * len(label), flush=True)
+
+    os.chdir(lvgl_test_dir)
+    subprocess.check_call([os.path.join(get_build_dir(options_name), 'lv_bench'),
+                           '--baseline', baseline, '--tolerance', str(tolerance)])
+
+
 def generate_code_coverage_report():
     '''Produce code coverage test reports for the test execution.'''
     global lvgl_test_dir
@@ -171,13 +192,20 @@ if __name__ == "__main__":
                         help='clean existing build artifacts before operation.')
     parser.add_argument('--report', action='store_true',
                         help='generate code coverage report for tests.')
-    parser.add_argument('actions', nargs='*', choices=['build', 'test'],
-                        help='build: compile build tests, test: compile/run executable tests.')
+    parser.add_argument('--baseline', default='bench/baseline.csv',
+                        help='benchmark results to compare with.')
+    parser.add_argument('--tolerance', type=float, default=20,
+                        help='allowed benchmark slowdown in percent.')
+    parser.add_argument('actions', nargs='*', choices=['build', 'test', 'bench'],
+                        help='''build: compile build tests, test: compile/run executable tests,
+                        bench: compile/run the benchmark and compare it with the baseline.''')
 
     args = parser.parse_args()
 
     if args.build_options:
         options_to_build = args.build_options
+    elif args.actions == ['bench']:
+        options_to_build = bench_options
     else:
         if 'build' in args.actions:
             if 'test' in args.actions:
@@ -196,9 +224,15 @@ if __name__ == "__main__":
 
     for options_name in options_to_build:
         is_test = options_name in test_options
-        build_type = 'Debug'
+        is_bench = options_name in bench_options
+        build_type = 'RelWithDebInfo' if is_bench else 'Debug'
         build_tests(options_name, build_type, args.clean)
-        if is_test:
+        if is_bench:
+            try:
+                run_bench(options_name, args.baseline, args.tolerance)
+            except subprocess.CalledProcessError as e:
+                sys.exit(e.returncode)
+        elif is_test:
             try:
                 run_tests(options_name)
             except subprocess.CalledProcessError as e:
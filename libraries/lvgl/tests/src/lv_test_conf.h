@@ -32,6 +32,17 @@ void lv_test_assert_fail(void);
 uint32_t custom_tick_get(void);
 #define LV_TICK_CUSTOM_SYS_TIME_EXPR custom_tick_get()
 
+#ifdef LV_BUILD_BENCH
+/*Count the allocations of LVGL in the benchmark*/
+#include <stddef.h>
+void * lv_bench_alloc(size_t size);
+void * lv_bench_realloc(void * p, size_t size);
+void lv_bench_free(void * p);
+#define LV_MEM_CUSTOM_ALLOC   lv_bench_alloc
+#define LV_MEM_CUSTOM_FREE    lv_bench_free
+#define LV_MEM_CUSTOM_REALLOC lv_bench_realloc
+#endif
+
 typedef void * lv_user_data_t;
 
 /**********************
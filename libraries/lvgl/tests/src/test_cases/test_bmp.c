@@ -0,0 +1,123 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BMP_24BIT_PATH      "../src/examples/libs/bmp/example_24bit.bmp"
+#define BMP_32BIT_PATH      "../src/examples/libs/bmp/example_32bit.bmp"
+#define BMP_SMALL_PATH      "src/test_files/bmp_24bit_13x9.bmp"
+
+static lv_color32_t * ref_px;
+static int ref_w;
+static int ref_h;
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    free(ref_px);
+    ref_px = NULL;
+}
+
+/*Decode the file pixel by pixel, top row first*/
+static void ref_decode(const char * path)
+{
+    FILE * f = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t * data = malloc(size);
+    TEST_ASSERT_EQUAL(size, fread(data, 1, size, f));
+    fclose(f);
+
+    uint32_t offset;
+    uint16_t bpp;
+    memcpy(&offset, data + 10, 4);
+    memcpy(&ref_w, data + 18, 4);
+    memcpy(&ref_h, data + 22, 4);
+    memcpy(&bpp, data + 28, 2);
+    uint32_t row_size = ((bpp * ref_w + 31) / 32) * 4;
+
+    ref_px = malloc(ref_w * ref_h * sizeof(lv_color32_t));
+    for(int y = 0; y < ref_h; y++) {
+        const uint8_t * row = data + offset + (ref_h - 1 - y) * row_size;
+        for(int x = 0; x < ref_w; x++) {
+            const uint8_t * p = row + x * (bpp / 8);
+            lv_color32_t * c = &ref_px[y * ref_w + x];
+            c->ch.blue = p[0];
+            c->ch.green = p[1];
+            c->ch.red = p[2];
+            c->ch.alpha = bpp == 32 ? p[3] : 0xff;
+        }
+    }
+    free(data);
+}
+
+static void check_lines(const char * src)
+{
+    lv_img_decoder_dsc_t dsc;
+    lv_color32_t line[128];
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, src, lv_color_black(), 0));
+    TEST_ASSERT_NULL(dsc.img_data);
+    TEST_ASSERT_EQUAL(ref_w, dsc.header.w);
+    TEST_ASSERT_EQUAL(ref_h, dsc.header.h);
+
+    /*Top-down as the drawing does*/
+    for(int y = 0; y < ref_h; y++) {
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, y, ref_w, (uint8_t *)line));
+        TEST_ASSERT_EQUAL_MEMORY(&ref_px[y * ref_w], line, ref_w * sizeof(lv_color32_t));
+    }
+
+    /*Bottom-up and partial lines*/
+    for(int y = ref_h - 1; y >= 0; y -= 3) {
+        int x = y % 17;
+        int len = ref_w - x - y % 5;
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, x, y, len, (uint8_t *)line));
+        TEST_ASSERT_EQUAL_MEMORY(&ref_px[y * ref_w + x], line, len * sizeof(lv_color32_t));
+    }
+
+    lv_img_decoder_close(&dsc);
+}
+
+void test_bmp_24bit_lines(void)
+{
+    ref_decode(BMP_24BIT_PATH);
+    check_lines("A:" BMP_24BIT_PATH);
+    check_lines("B:" BMP_24BIT_PATH);
+}
+
+void test_bmp_32bit_lines(void)
+{
+    ref_decode(BMP_32BIT_PATH);
+    check_lines("A:" BMP_32BIT_PATH);
+    check_lines("B:" BMP_32BIT_PATH);
+}
+
+void test_bmp_small_image_decoded_at_once(void)
+{
+    ref_decode(BMP_SMALL_PATH);
+    TEST_ASSERT_LESS_OR_EQUAL(LV_BMP_DECODE_MAX_SIZE, ref_w * ref_h * sizeof(lv_color32_t));
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, "B:" BMP_SMALL_PATH, lv_color_black(), 0));
+    TEST_ASSERT_NOT_NULL(dsc.img_data);
+    TEST_ASSERT_EQUAL_MEMORY(ref_px, dsc.img_data, ref_w * ref_h * sizeof(lv_color32_t));
+    lv_img_decoder_close(&dsc);
+}
+
+void test_bmp_missing_file(void)
+{
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_open(&dsc, "B:src/test_files/missing.bmp", lv_color_black(), 0));
+}
+
+#endif
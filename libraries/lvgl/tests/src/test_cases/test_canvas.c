@@ -0,0 +1,123 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define CANVAS_W    37
+#define CANVAS_H    23
+
+static lv_obj_t * canvas;
+
+void setUp(void)
+{
+    canvas = lv_canvas_create(lv_scr_act());
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+/*The reference filter works on the channels of the 32 bit colors*/
+#if LV_COLOR_DEPTH == 32
+static lv_color_t buf[CANVAS_W * CANVAS_H];
+static lv_color_t ori[CANVAS_W * CANVAS_H];
+static lv_color_t ref[CANVAS_W * CANVAS_H];
+
+static void fill_buf(bool has_alpha)
+{
+    uint32_t seed = 0x1234567;
+    for(uint32_t i = 0; i < CANVAS_W * CANVAS_H; i++) {
+        seed = seed * 1103515245 + 12345;
+        buf[i] = lv_color_hex(seed >> 8);
+        /*Some fully transparent spots to check that their color is kept*/
+        buf[i].ch.alpha = has_alpha ? ((i % 11) < 3 ? 0 : (seed & 0xff)) : 0xff;
+    }
+    lv_memcpy(ori, buf, sizeof(buf));
+    lv_memcpy(ref, buf, sizeof(buf));
+}
+
+/*Average of the window of every pixel, the pixels out of the canvas are clamped to the edge*/
+static void ref_blur(const lv_area_t * area, uint16_t r, bool hor, bool has_alpha)
+{
+    lv_area_t a = {0, 0, CANVAS_W - 1, CANVAS_H - 1};
+    if(area) _lv_area_intersect(&a, &a, area);
+    int32_t r_back = (r - 1) / 2;
+    int32_t r_front = r / 2;
+
+    for(int32_t y = a.y1; y <= a.y2; y++) {
+        for(int32_t x = a.x1; x <= a.x2; x++) {
+            uint32_t sum[4] = {0, 0, 0, 0};
+            for(int32_t d = -r_back; d <= r_front; d++) {
+                int32_t sx = hor ? LV_CLAMP(0, x + d, CANVAS_W - 1) : x;
+                int32_t sy = hor ? y : LV_CLAMP(0, y + d, CANVAS_H - 1);
+                lv_color_t c = ori[sy * CANVAS_W + sx];
+                sum[0] += c.ch.red;
+                sum[1] += c.ch.green;
+                sum[2] += c.ch.blue;
+                sum[3] += has_alpha ? c.ch.alpha : LV_OPA_COVER;
+            }
+            lv_color_t * c = &ref[y * CANVAS_W + x];
+            if(sum[3]) {
+                c->ch.red = sum[0] / r;
+                c->ch.green = sum[1] / r;
+                c->ch.blue = sum[2] / r;
+            }
+            c->ch.alpha = has_alpha ? sum[3] / r : 0xff;
+        }
+    }
+}
+
+static void check_blur(lv_img_cf_t cf, const lv_area_t * area, uint16_t r)
+{
+    bool has_alpha = cf == LV_IMG_CF_TRUE_COLOR_ALPHA;
+    lv_canvas_set_buffer(canvas, buf, CANVAS_W, CANVAS_H, cf);
+
+    fill_buf(has_alpha);
+    lv_canvas_blur_hor(canvas, area, r);
+    ref_blur(area, r, true, has_alpha);
+    TEST_ASSERT_EQUAL_MEMORY(ref, buf, sizeof(buf));
+
+    fill_buf(has_alpha);
+    lv_canvas_blur_ver(canvas, area, r);
+    ref_blur(area, r, false, has_alpha);
+    TEST_ASSERT_EQUAL_MEMORY(ref, buf, sizeof(buf));
+}
+#endif
+
+void test_canvas_blur_matches_box_filter(void)
+{
+#if LV_COLOR_DEPTH == 32
+    static const uint16_t radii[] = {1, 2, 3, 4, 9, 30, 100};
+    static const lv_img_cf_t cfs[] = {LV_IMG_CF_TRUE_COLOR, LV_IMG_CF_TRUE_COLOR_ALPHA};
+    lv_area_t inner = {5, 3, 30, 19};
+    lv_area_t outside = {-10, -4, 12, 40};
+
+    for(uint32_t c = 0; c < sizeof(cfs) / sizeof(cfs[0]); c++) {
+        for(uint32_t i = 0; i < sizeof(radii) / sizeof(radii[0]); i++) {
+            check_blur(cfs[c], NULL, radii[i]);
+            check_blur(cfs[c], &inner, radii[i]);
+            check_blur(cfs[c], &outside, radii[i]);
+        }
+    }
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_canvas_blur_out_of_canvas(void)
+{
+#if LV_COLOR_DEPTH == 32
+    lv_area_t area = {CANVAS_W + 5, 0, CANVAS_W + 10, 5};
+    lv_canvas_set_buffer(canvas, buf, CANVAS_W, CANVAS_H, LV_IMG_CF_TRUE_COLOR);
+    fill_buf(false);
+
+    lv_canvas_blur_hor(canvas, &area, 5);
+    lv_canvas_blur_ver(canvas, &area, 5);
+    TEST_ASSERT_EQUAL_MEMORY(ori, buf, sizeof(buf));
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
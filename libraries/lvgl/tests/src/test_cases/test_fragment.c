@@ -0,0 +1,132 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_FRAGMENT && LV_FRAGMENT_CACHE_CNT
+
+typedef struct {
+    lv_fragment_t base;
+    uint32_t create_cnt;
+    uint32_t event_cnt;
+} test_fragment_t;
+
+static lv_obj_t * container;
+static lv_fragment_manager_t * manager;
+
+static lv_obj_t * test_create_obj(lv_fragment_t * self, lv_obj_t * parent)
+{
+    ((test_fragment_t *)self)->create_cnt++;
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_label_create(obj);
+    return obj;
+}
+
+static bool test_event(lv_fragment_t * self, int code, void * userdata)
+{
+    LV_UNUSED(code);
+    LV_UNUSED(userdata);
+    ((test_fragment_t *)self)->event_cnt++;
+    return false;
+}
+
+static const lv_fragment_class_t test_cls = {
+    .create_obj_cb = test_create_obj,
+    .event_cb = test_event,
+    .instance_size = sizeof(test_fragment_t)
+};
+
+static test_fragment_t * push(void)
+{
+    lv_fragment_t * fragment = lv_fragment_create(&test_cls, NULL);
+    lv_fragment_manager_push(manager, fragment, &container);
+    return (test_fragment_t *)fragment;
+}
+
+#endif
+
+void setUp(void)
+{
+#if LV_USE_FRAGMENT && LV_FRAGMENT_CACHE_CNT
+    container = lv_obj_create(lv_scr_act());
+    manager = lv_fragment_manager_create(NULL);
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_FRAGMENT && LV_FRAGMENT_CACHE_CNT
+    lv_fragment_manager_del(manager);
+    lv_obj_clean(lv_scr_act());
+#endif
+}
+
+void test_fragment_cache_pop(void)
+{
+#if LV_USE_FRAGMENT && LV_FRAGMENT_CACHE_CNT
+    test_fragment_t * f1 = push();
+    lv_obj_t * obj1 = f1->base.obj;
+    test_fragment_t * f2 = push();
+
+    TEST_ASSERT_EQUAL_PTR(obj1, f1->base.obj);
+    TEST_ASSERT_TRUE(lv_obj_has_flag(obj1, LV_OBJ_FLAG_HIDDEN));
+    TEST_ASSERT_TRUE(f1->base.managed->obj_cached);
+
+    /*The cached fragment doesn't receive events*/
+    lv_fragment_manager_send_event(manager, 0, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, f2->event_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, f1->event_cnt);
+
+    lv_fragment_manager_pop(manager);
+    TEST_ASSERT_EQUAL_PTR(obj1, f1->base.obj);
+    TEST_ASSERT_FALSE(lv_obj_has_flag(obj1, LV_OBJ_FLAG_HIDDEN));
+    TEST_ASSERT_EQUAL_UINT32(1, f1->create_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_obj_get_child_cnt(container));
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_fragment_cache_limit(void)
+{
+#if LV_USE_FRAGMENT && LV_FRAGMENT_CACHE_CNT
+    test_fragment_t * f[LV_FRAGMENT_CACHE_CNT + 2];
+    uint32_t i;
+    for(i = 0; i < LV_FRAGMENT_CACHE_CNT + 2; i++) {
+        f[i] = push();
+    }
+
+    /*The deepest one is deleted*/
+    TEST_ASSERT_NULL(f[0]->base.obj);
+    TEST_ASSERT_EQUAL_UINT32(LV_FRAGMENT_CACHE_CNT + 1, lv_obj_get_child_cnt(container));
+
+    for(i = LV_FRAGMENT_CACHE_CNT + 1; i > 1; i--) {
+        lv_fragment_manager_pop(manager);
+        TEST_ASSERT_EQUAL_UINT32(1, f[i - 1]->create_cnt);
+    }
+
+    lv_fragment_manager_pop(manager);
+    TEST_ASSERT_NOT_NULL(f[0]->base.obj);
+    TEST_ASSERT_EQUAL_UINT32(2, f[0]->create_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_obj_get_child_cnt(container));
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_fragment_cache_remove(void)
+{
+#if LV_USE_FRAGMENT && LV_FRAGMENT_CACHE_CNT
+    test_fragment_t * f1 = push();
+    push();
+
+    /*Removing a cached fragment deletes its objects*/
+    lv_fragment_manager_remove(manager, &f1->base);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_obj_get_child_cnt(container));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_fragment_manager_get_stack_size(manager));
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
@@ -0,0 +1,197 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_GRIDNAV
+
+#define ROW_CNT 10
+#define COL_CNT 10
+
+static lv_obj_t * cont;
+
+static void send_key(uint32_t key)
+{
+    lv_event_send(cont, LV_EVENT_KEY, &key);
+}
+
+static lv_obj_t * get_focused(void)
+{
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(cont); i++) {
+        lv_obj_t * child = lv_obj_get_child(cont, i);
+        if(lv_obj_has_state(child, LV_STATE_FOCUS_KEY)) return child;
+    }
+    return NULL;
+}
+
+static lv_obj_t * get_item(uint32_t row, uint32_t col)
+{
+    return lv_obj_get_child(cont, row * COL_CNT + col);
+}
+
+#endif
+
+void setUp(void)
+{
+#if LV_USE_GRIDNAV
+    cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 500, 300);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+
+    uint32_t i;
+    for(i = 0; i < ROW_CNT * COL_CNT; i++) {
+        lv_obj_t * btn = lv_btn_create(cont);
+        lv_obj_set_size(btn, 35, 40);
+    }
+
+    lv_gridnav_add(cont, LV_GRIDNAV_CTRL_ROLLOVER);
+    lv_obj_update_layout(cont);
+    lv_event_send(cont, LV_EVENT_FOCUSED, NULL);
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_GRIDNAV
+    lv_obj_clean(lv_scr_act());
+#endif
+}
+
+void test_gridnav_arrows(void)
+{
+#if LV_USE_GRIDNAV
+    TEST_ASSERT_EQUAL_PTR(get_item(0, 0), get_focused());
+
+    send_key(LV_KEY_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(get_item(0, 1), get_focused());
+    send_key(LV_KEY_DOWN);
+    send_key(LV_KEY_DOWN);
+    TEST_ASSERT_EQUAL_PTR(get_item(2, 1), get_focused());
+    send_key(LV_KEY_LEFT);
+    TEST_ASSERT_EQUAL_PTR(get_item(2, 0), get_focused());
+    send_key(LV_KEY_UP);
+    TEST_ASSERT_EQUAL_PTR(get_item(1, 0), get_focused());
+
+    /*Rollover*/
+    send_key(LV_KEY_LEFT);
+    TEST_ASSERT_EQUAL_PTR(get_item(0, COL_CNT - 1), get_focused());
+    send_key(LV_KEY_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(get_item(1, 0), get_focused());
+    send_key(LV_KEY_UP);
+    send_key(LV_KEY_UP);
+    TEST_ASSERT_EQUAL_PTR(get_item(ROW_CNT - 1, 0), get_focused());
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_gridnav_set_focused(void)
+{
+#if LV_USE_GRIDNAV
+    lv_gridnav_set_focused(cont, get_item(5, 5), LV_ANIM_OFF);
+    send_key(LV_KEY_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(get_item(5, 6), get_focused());
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_gridnav_scrolled(void)
+{
+#if LV_USE_GRIDNAV
+    /*Only the scroll position changes, not the relative position of the children*/
+    send_key(LV_KEY_DOWN);
+    lv_obj_scroll_by(cont, 0, -200, LV_ANIM_OFF);
+    send_key(LV_KEY_DOWN);
+    TEST_ASSERT_EQUAL_PTR(get_item(2, 0), get_focused());
+    send_key(LV_KEY_LEFT);
+    TEST_ASSERT_EQUAL_PTR(get_item(1, COL_CNT - 1), get_focused());
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_gridnav_layout_changed(void)
+{
+#if LV_USE_GRIDNAV
+    /*The items move to the next row*/
+    lv_obj_del(get_item(0, 2));
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_PTR(get_item(0, 0), get_focused());
+    send_key(LV_KEY_RIGHT);
+    send_key(LV_KEY_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(get_item(0, 2), get_focused());
+
+    /*Wider items, so less of them in a row*/
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(cont); i++) {
+        lv_obj_set_width(lv_obj_get_child(cont, i), 60);
+    }
+    lv_obj_update_layout(cont);
+    lv_gridnav_set_focused(cont, lv_obj_get_child(cont, 0), LV_ANIM_OFF);
+    send_key(LV_KEY_DOWN);
+    TEST_ASSERT_EQUAL_PTR(lv_obj_get_child(cont, 6), get_focused());
+
+    /*New item*/
+    lv_obj_t * btn = lv_btn_create(cont);
+    lv_obj_add_flag(btn, LV_OBJ_FLAG_IGNORE_LAYOUT);
+    lv_obj_set_pos(btn, 0, 20);
+    lv_obj_update_layout(cont);
+    send_key(LV_KEY_UP);
+    TEST_ASSERT_EQUAL_PTR(btn, get_focused());
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_gridnav_hidden(void)
+{
+#if LV_USE_GRIDNAV
+    /*No event is sent about flags, but hidden items should be skipped*/
+    send_key(LV_KEY_RIGHT);
+    lv_obj_add_flag(get_item(0, 2), LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_IGNORE_LAYOUT);
+    send_key(LV_KEY_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(get_item(0, 3), get_focused());
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_gridnav_shown(void)
+{
+#if LV_USE_GRIDNAV
+    /*Out of the layout, so only its flags change when it's shown*/
+    lv_obj_t * last = get_item(0, COL_CNT - 1);
+    lv_obj_t * btn = lv_btn_create(cont);
+    lv_obj_add_flag(btn, LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_IGNORE_LAYOUT);
+    lv_obj_set_size(btn, 35, 40);
+    lv_obj_set_pos(btn, lv_obj_get_x(last) + 50, lv_obj_get_y(last));
+    lv_obj_update_layout(cont);
+
+    /*The graph is built without the hidden item*/
+    lv_gridnav_set_focused(cont, last, LV_ANIM_OFF);
+    send_key(LV_KEY_LEFT);
+    send_key(LV_KEY_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(last, get_focused());
+
+    lv_obj_clear_flag(btn, LV_OBJ_FLAG_HIDDEN);
+    send_key(LV_KEY_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(btn, get_focused());
+
+    /*Becomes focusable by being clickable again*/
+    lv_obj_clear_flag(btn, LV_OBJ_FLAG_CLICKABLE);
+    send_key(LV_KEY_LEFT);
+    TEST_ASSERT_EQUAL_PTR(last, get_focused());
+    send_key(LV_KEY_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(get_item(1, 0), get_focused());
+    send_key(LV_KEY_LEFT);
+    lv_obj_add_flag(btn, LV_OBJ_FLAG_CLICKABLE);
+    send_key(LV_KEY_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(btn, get_focused());
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
@@ -0,0 +1,128 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_IME_PINYIN
+
+static lv_obj_t * ime;
+static lv_obj_t * kb;
+
+static void press(const char * txt)
+{
+    lv_btnmatrix_t * btnm = (lv_btnmatrix_t *)kb;
+    uint16_t i;
+    for(i = 0; i < btnm->btn_cnt; i++) {
+        if(strcmp(lv_btnmatrix_get_btn_text(kb, i), txt) == 0) {
+            lv_btnmatrix_set_selected_btn(kb, i);
+            lv_event_send(kb, LV_EVENT_VALUE_CHANGED, NULL);
+            return;
+        }
+    }
+
+    TEST_FAIL_MESSAGE("Button not found");
+}
+
+static void type(const char * py)
+{
+    char txt[2] = {0};
+    while(*py) {
+        txt[0] = *py;
+        press(txt);
+        py++;
+    }
+}
+
+/*First character on the candidate panel*/
+static const char * get_cand(void)
+{
+    return lv_btnmatrix_get_btn_text(lv_ime_pinyin_get_cand_panel(ime), 1);
+}
+
+#endif
+
+void setUp(void)
+{
+#if LV_USE_IME_PINYIN
+    ime = lv_ime_pinyin_create(lv_scr_act());
+    kb = lv_keyboard_create(lv_scr_act());
+    lv_ime_pinyin_set_keyboard(ime, kb);
+    lv_keyboard_set_textarea(kb, lv_textarea_create(lv_scr_act()));
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_IME_PINYIN
+    lv_obj_clean(lv_scr_act());
+#endif
+}
+
+void test_ime_pinyin_prefix(void)
+{
+#if LV_USE_IME_PINYIN
+    /*"zuo" is before "zu" in the default dictionary*/
+    type("zu");
+    TEST_ASSERT_EQUAL_STRING("足", get_cand());
+    type("o");
+    TEST_ASSERT_EQUAL_STRING("左", get_cand());
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_ime_pinyin_custom_dict(void)
+{
+#if LV_USE_IME_PINYIN
+    static lv_pinyin_dict_t dict[] = {
+        { "ni", "你" },
+        { "hao", "好" },
+        { "ha", "哈" },
+        {NULL, NULL}
+    };
+
+    lv_ime_pinyin_set_dict(ime, dict);
+    type("h");
+    TEST_ASSERT_EQUAL_STRING("哈", get_cand());
+    type("ao");
+    TEST_ASSERT_EQUAL_STRING("好", get_cand());
+    press(LV_SYMBOL_OK);
+    type("n");
+    TEST_ASSERT_EQUAL_STRING("你", get_cand());
+
+    /*No index is required for sorted dictionaries*/
+    static lv_pinyin_dict_t sorted_dict[] = {
+        { "ha", "哈" },
+        { "hao", "好" },
+        {NULL, NULL}
+    };
+    lv_ime_pinyin_set_dict(ime, sorted_dict);
+    TEST_ASSERT_NULL(((lv_ime_pinyin_t *)ime)->dict_index);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_ime_pinyin_k9_legal_py(void)
+{
+#if LV_USE_IME_PINYIN && LV_IME_PINYIN_USE_K9_MODE
+    lv_ime_pinyin_set_mode(ime, LV_IME_PINYIN_MODE_K9);
+    press("wxyz");
+    press("tuv");
+
+    static const char * expected[] = {"wu", "xu", "yu", "zu"};
+    lv_ime_pinyin_t * pinyin_ime = (lv_ime_pinyin_t *)ime;
+    TEST_ASSERT_EQUAL_UINT16(4, pinyin_ime->k9_legal_py_count);
+
+    ime_pinyin_k9_py_str_t * py = _lv_ll_get_head(&pinyin_ime->k9_legal_py_ll);
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_STRING(expected[i], py->py_str);
+        py = _lv_ll_get_next(&pinyin_ime->k9_legal_py_ll, py);
+    }
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
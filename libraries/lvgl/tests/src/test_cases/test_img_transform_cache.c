@@ -0,0 +1,226 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_scr_act());
+}
+
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+
+#define IMG_W       64
+#define IMG_H       48
+#define FB_SIZE     (800 * 480)
+
+extern lv_color_t test_fb[];
+
+static uint8_t img_data[IMG_W * IMG_H * LV_IMG_PX_SIZE_ALPHA_BYTE];
+static lv_img_dsc_t img_dsc;
+static lv_color_t ref_fb[FB_SIZE];
+
+static const lv_img_dsc_t * create_src(lv_img_cf_t cf)
+{
+    uint32_t px_size = cf == LV_IMG_CF_TRUE_COLOR_ALPHA ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    uint8_t * px = img_data;
+    for(uint32_t i = 0; i < IMG_W * IMG_H; i++) {
+        lv_color_t c = lv_color_hex(i * 2654435761U);
+        lv_memcpy(px, &c, sizeof(c));
+        if(cf == LV_IMG_CF_TRUE_COLOR_ALPHA) px[px_size - 1] = (i * 7) & 0xff;
+        px += px_size;
+    }
+
+    img_dsc.header.always_zero = 0;
+    img_dsc.header.cf = cf;
+    img_dsc.header.w = IMG_W;
+    img_dsc.header.h = IMG_H;
+    img_dsc.data_size = IMG_W * IMG_H * px_size;
+    img_dsc.data = img_data;
+    return &img_dsc;
+}
+
+static lv_obj_t * create_img(lv_img_cf_t cf, lv_coord_t x, lv_coord_t y)
+{
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, create_src(cf));
+    lv_obj_set_pos(img, x, y);
+    lv_img_set_angle(img, 300);
+    lv_img_set_zoom(img, 384);
+    return img;
+}
+
+static void refr_all(void)
+{
+    lv_area_t a;
+    lv_area_set(&a, 0, 0, lv_disp_get_hor_res(NULL) - 1, lv_disp_get_ver_res(NULL) - 1);
+    _lv_inv_area(NULL, &a);
+    _lv_disp_refr_timer(NULL);
+}
+
+static bool is_cached(lv_obj_t * obj)
+{
+    return ((lv_img_t *)obj)->transform_cache != NULL;
+}
+
+static void check_same_render(lv_img_cf_t cf)
+{
+    lv_obj_t * img1 = create_img(cf, 100, 80);
+    lv_obj_set_style_img_recolor(img1, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_style_img_recolor_opa(img1, LV_OPA_30, 0);
+    lv_obj_t * img2 = create_img(cf, 400, 200);
+    lv_obj_set_style_img_opa(img2, LV_OPA_70, 0);
+    /*Both fit into the cache*/
+    lv_img_set_zoom(img1, 200);
+    lv_img_set_zoom(img2, 200);
+
+    refr_all();
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_img_set_transform_cache(img1, true);
+    lv_img_set_transform_cache(img2, true);
+    refr_all();
+    TEST_ASSERT_FALSE(is_cached(img1));
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+    /*Created by the second refresh without changes, then only drawn*/
+    refr_all();
+    TEST_ASSERT_TRUE(is_cached(img1));
+    TEST_ASSERT_TRUE(is_cached(img2));
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+    refr_all();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+#endif
+
+void test_img_transform_cache_same_render_true_color(void)
+{
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    check_same_render(LV_IMG_CF_TRUE_COLOR);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_img_transform_cache_same_render_true_color_alpha(void)
+{
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    check_same_render(LV_IMG_CF_TRUE_COLOR_ALPHA);
+#else
+    TEST_PASS();
+#endif
+}
+
+/*The tiles are drawn from the same kept image*/
+void test_img_transform_cache_tiled(void)
+{
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    lv_obj_t * img = create_img(LV_IMG_CF_TRUE_COLOR_ALPHA, 100, 80);
+    lv_img_set_zoom(img, 200);
+    lv_obj_set_size(img, IMG_W * 3, IMG_H * 2);
+    lv_img_set_transform_cache(img, true);
+
+    refr_all();
+    refr_all();
+    TEST_ASSERT_TRUE(is_cached(img));
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+    refr_all();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_img_transform_cache_dropped_on_change(void)
+{
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    lv_obj_t * img = create_img(LV_IMG_CF_TRUE_COLOR, 100, 80);
+    lv_img_set_transform_cache(img, true);
+    refr_all();
+    refr_all();
+    TEST_ASSERT_TRUE(is_cached(img));
+    TEST_ASSERT_NOT_EQUAL(0, lv_img_get_transform_cache_used());
+
+    /*Not created while animated*/
+    for(int i = 1; i <= 3; i++) {
+        lv_img_set_angle(img, 300 + i * 10);
+        TEST_ASSERT_FALSE(is_cached(img));
+        TEST_ASSERT_EQUAL(0, lv_img_get_transform_cache_used());
+        refr_all();
+        TEST_ASSERT_FALSE(is_cached(img));
+    }
+    refr_all();
+    TEST_ASSERT_TRUE(is_cached(img));
+
+    lv_img_set_zoom(img, 300);
+    TEST_ASSERT_FALSE(is_cached(img));
+    refr_all();
+    refr_all();
+    TEST_ASSERT_TRUE(is_cached(img));
+
+    lv_img_set_pivot(img, 0, 0);
+    TEST_ASSERT_FALSE(is_cached(img));
+    refr_all();
+    refr_all();
+    TEST_ASSERT_TRUE(is_cached(img));
+
+    lv_img_set_src(img, &img_dsc);
+    TEST_ASSERT_FALSE(is_cached(img));
+
+    /*No transformation, nothing to keep*/
+    lv_img_set_angle(img, 0);
+    lv_img_set_zoom(img, LV_IMG_ZOOM_NONE);
+    refr_all();
+    refr_all();
+    TEST_ASSERT_FALSE(is_cached(img));
+
+    lv_img_set_angle(img, 450);
+    refr_all();
+    refr_all();
+    TEST_ASSERT_TRUE(is_cached(img));
+    lv_img_set_transform_cache(img, false);
+    TEST_ASSERT_FALSE(is_cached(img));
+    TEST_ASSERT_EQUAL(0, lv_img_get_transform_cache_used());
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_img_transform_cache_budget(void)
+{
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    lv_obj_t * img1 = create_img(LV_IMG_CF_TRUE_COLOR, 100, 80);
+    lv_obj_t * img2 = create_img(LV_IMG_CF_TRUE_COLOR, 400, 80);
+    lv_obj_t * img3 = create_img(LV_IMG_CF_TRUE_COLOR, 100, 300);
+    lv_img_set_transform_cache(img1, true);
+    lv_img_set_transform_cache(img2, true);
+    refr_all();
+    refr_all();
+
+    /*Only one of them fits, the image without cache is not counted*/
+    TEST_ASSERT_TRUE(is_cached(img1));
+    TEST_ASSERT_FALSE(is_cached(img2));
+    TEST_ASSERT_FALSE(is_cached(img3));
+    uint32_t used = lv_img_get_transform_cache_used();
+    TEST_ASSERT_LESS_OR_EQUAL(LV_IMG_TRANSFORM_CACHE_SIZE, used);
+    TEST_ASSERT_GREATER_THAN(LV_IMG_TRANSFORM_CACHE_SIZE, used * 2);
+
+    /*The freed memory is used by the other image*/
+    lv_obj_del(img1);
+    TEST_ASSERT_EQUAL(0, lv_img_get_transform_cache_used());
+    refr_all();
+    TEST_ASSERT_TRUE(is_cached(img2));
+    TEST_ASSERT_EQUAL(used, lv_img_get_transform_cache_used());
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
@@ -0,0 +1,126 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../src/draw/sw/lv_draw_sw.h"
+
+#include "unity/unity.h"
+
+extern lv_color_t test_fb[];
+
+static lv_obj_t * create_rect(lv_obj_t * parent, lv_coord_t x, lv_coord_t y, lv_color_t color)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, 40, 40);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, color, 0);
+    return obj;
+}
+
+static void dummy_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+}
+
+static lv_color_t get_px(lv_coord_t x, lv_coord_t y)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    return test_fb[y * lv_disp_get_hor_res(NULL) + x];
+}
+
+static void assert_color_near(lv_color_t expected, lv_color_t actual)
+{
+    TEST_ASSERT_INT_WITHIN(4, LV_COLOR_GET_R(expected), LV_COLOR_GET_R(actual));
+    TEST_ASSERT_INT_WITHIN(4, LV_COLOR_GET_G(expected), LV_COLOR_GET_G(actual));
+    TEST_ASSERT_INT_WITHIN(4, LV_COLOR_GET_B(expected), LV_COLOR_GET_B(actual));
+}
+
+void setUp(void)
+{
+    lv_obj_remove_style_all(lv_scr_act());
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_layer_flat_rect_same_as_layer(void)
+{
+    lv_obj_t * obj = create_rect(lv_scr_act(), 10, 10, lv_palette_main(LV_PALETTE_RED));
+    lv_obj_set_style_opa_layered(obj, LV_OPA_50, 0);
+
+    /*Drawn without a layer*/
+    lv_color_t flat = get_px(30, 30);
+
+    /*An event callback could draw anything so a layer is used*/
+    lv_obj_add_event_cb(obj, dummy_event_cb, LV_EVENT_ALL, NULL);
+    lv_color_t layered = get_px(30, 30);
+
+    assert_color_near(layered, flat);
+    assert_color_near(lv_color_mix(lv_palette_main(LV_PALETTE_RED), lv_color_white(), LV_OPA_50), flat);
+}
+
+void test_layer_overlapping_children(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(parent);
+    lv_obj_set_size(parent, 200, 200);
+    lv_obj_set_style_opa_layered(parent, LV_OPA_50, 0);
+
+    /*Not overlapping children are blended one by one.
+     *A layer couldn't be used here as the parent is transparent and `LV_COLOR_SCREEN_TRANSP` is 0*/
+    create_rect(parent, 0, 0, lv_palette_main(LV_PALETTE_RED));
+    lv_obj_t * blue = create_rect(parent, 100, 0, lv_palette_main(LV_PALETTE_BLUE));
+    lv_color_t blue_mixed = lv_color_mix(lv_palette_main(LV_PALETTE_BLUE), lv_color_white(), LV_OPA_50);
+    assert_color_near(lv_color_mix(lv_palette_main(LV_PALETTE_RED), lv_color_white(), LV_OPA_50), get_px(20, 20));
+    assert_color_near(blue_mixed, get_px(130, 20));
+
+    /*The parent and the children overlap so only the top child should be visible in the overlapping area*/
+    lv_obj_set_style_bg_opa(parent, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(parent, lv_color_white(), 0);
+    lv_obj_set_x(blue, 20);
+    assert_color_near(blue_mixed, get_px(30, 20));
+}
+
+void test_layer_buf_reuse(void)
+{
+#if LV_LAYER_SIMPLE_BUF_REUSE
+    lv_obj_t * obj = create_rect(lv_scr_act(), 10, 10, lv_palette_main(LV_PALETTE_RED));
+    lv_obj_set_style_opa_layered(obj, LV_OPA_50, 0);
+    lv_obj_add_event_cb(obj, dummy_event_cb, LV_EVENT_ALL, NULL);
+
+    lv_draw_sw_ctx_t * draw_ctx = (lv_draw_sw_ctx_t *)lv_disp_get_default()->driver->draw_ctx;
+    get_px(0, 0);
+    void * layer_buf = draw_ctx->layer_buf;
+    TEST_ASSERT_NOT_NULL(layer_buf);
+
+    get_px(0, 0);
+    TEST_ASSERT_EQUAL_PTR(layer_buf, draw_ctx->layer_buf);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_layer_buf_not_kept_for_transform(void)
+{
+#if LV_LAYER_SIMPLE_BUF_REUSE
+    lv_obj_t * obj = create_rect(lv_scr_act(), 10, 10, lv_palette_main(LV_PALETTE_RED));
+    lv_obj_set_style_transform_angle(obj, 300, 0);
+
+    lv_draw_sw_ctx_t * draw_ctx = (lv_draw_sw_ctx_t *)lv_disp_get_default()->driver->draw_ctx;
+    if(draw_ctx->layer_buf) {
+        lv_mem_free(draw_ctx->layer_buf);
+        draw_ctx->layer_buf = NULL;
+    }
+
+    /*The small transformed layer is allocated with its own size*/
+    get_px(0, 0);
+    TEST_ASSERT_NULL(draw_ctx->layer_buf);
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
@@ -0,0 +1,150 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_MSG
+
+#define MSG_A   1
+#define MSG_B   (MSG_A + 32)    /*Another ID in the same hash bucket*/
+
+static uint32_t cnt;
+static const void * last_payload;
+
+static void sub_cb(void * s, lv_msg_t * m)
+{
+    LV_UNUSED(s);
+    cnt++;
+    last_payload = lv_msg_get_payload(m);
+}
+
+static void unsub_self_cb(void * s, lv_msg_t * m)
+{
+    LV_UNUSED(m);
+    cnt++;
+    lv_msg_unsubscribe(s);
+}
+
+static void obj_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    cnt++;
+}
+
+#endif
+
+void setUp(void)
+{
+#if LV_USE_MSG
+    cnt = 0;
+    last_payload = NULL;
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_MSG
+    lv_obj_clean(lv_scr_act());
+#endif
+}
+
+void test_msg_send_only_to_id(void)
+{
+#if LV_USE_MSG
+    void * s1 = lv_msg_subscribe(MSG_A, sub_cb, NULL);
+    void * s2 = lv_msg_subscribe(MSG_B, sub_cb, NULL);
+
+    static int32_t value;
+    lv_msg_send(MSG_A, &value);
+    TEST_ASSERT_EQUAL_UINT32(1, cnt);
+    TEST_ASSERT_EQUAL_PTR(&value, last_payload);
+
+    lv_msg_unsubscribe(s1);
+    lv_msg_send(MSG_A, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, cnt);
+
+    lv_msg_send(MSG_B, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, cnt);
+    lv_msg_unsubscribe(s2);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_msg_unsubscribe_in_callback(void)
+{
+#if LV_USE_MSG
+    lv_msg_subscribe(MSG_A, unsub_self_cb, NULL);
+    void * s = lv_msg_subscribe(MSG_A, sub_cb, NULL);
+
+    lv_msg_send(MSG_A, NULL);
+    lv_msg_send(MSG_A, NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, cnt);
+    lv_msg_unsubscribe(s);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_msg_obj(void)
+{
+#if LV_USE_MSG
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_add_event_cb(obj, obj_event_cb, LV_EVENT_MSG_RECEIVED, NULL);
+    lv_msg_subscribe_obj(MSG_A, obj, NULL);
+    lv_msg_subscribe_obj(MSG_B, obj, NULL);
+    void * s = lv_msg_subscribe_obj(MSG_B + 1, obj, NULL);
+
+    lv_msg_send(MSG_A, NULL);
+    lv_msg_send(MSG_B, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, cnt);
+
+    lv_msg_unsubscribe(s);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_msg_unsubscribe_obj(MSG_A, obj));
+    lv_msg_send(MSG_A, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, cnt);
+
+    /*The delete event is removed with the last subscription*/
+    TEST_ASSERT_EQUAL_UINT32(1, lv_msg_unsubscribe_obj(LV_MSG_ID_ANY, obj));
+    TEST_ASSERT_EQUAL(1, obj->spec_attr->event_dsc_cnt);
+    lv_msg_send(MSG_B, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, cnt);
+
+    /*Unsubscribed when deleted*/
+    lv_msg_subscribe_obj(MSG_A, obj, NULL);
+    lv_obj_del(obj);
+    lv_msg_send(MSG_A, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, cnt);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_msg_post_coalesced(void)
+{
+#if LV_USE_MSG
+    void * s = lv_msg_subscribe(MSG_A, sub_cb, NULL);
+
+    static int32_t v1, v2;
+    lv_msg_post(MSG_A, &v1);
+    lv_msg_post(MSG_A, &v2);
+    TEST_ASSERT_EQUAL_UINT32(0, cnt);
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, cnt);
+    TEST_ASSERT_EQUAL_PTR(&v2, last_payload);
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, cnt);
+
+    lv_msg_post(MSG_A, &v1);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, cnt);
+    TEST_ASSERT_EQUAL_PTR(&v1, last_payload);
+    lv_msg_unsubscribe(s);
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
@@ -0,0 +1,139 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_RENDER_COST
+
+static lv_obj_t * create_rect(lv_obj_t * parent, lv_coord_t w, lv_coord_t h)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    return obj;
+}
+
+#endif
+
+void setUp(void)
+{
+#if LV_USE_RENDER_COST
+    lv_obj_remove_style_all(lv_scr_act());
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_RENDER_COST
+    lv_obj_clean(lv_scr_act());
+#endif
+}
+
+void test_render_cost_fill(void)
+{
+#if LV_USE_RENDER_COST
+    lv_obj_t * obj = create_rect(lv_scr_act(), 100, 100);
+    lv_obj_update_layout(obj);
+
+    uint32_t classes;
+    uint32_t cost = lv_render_cost_estimate(obj, &classes);
+    TEST_ASSERT_EQUAL_UINT32(1UL << LV_RENDER_COST_FILL, classes);
+    TEST_ASSERT_EQUAL_UINT32(10 * lv_render_cost_get_coef(LV_RENDER_COST_FILL), cost);
+
+    lv_obj_set_style_bg_opa(obj, LV_OPA_50, 0);
+    lv_obj_set_style_radius(obj, 10, 0);
+    cost = lv_render_cost_estimate(obj, &classes);
+    TEST_ASSERT_EQUAL_UINT32((1UL << LV_RENDER_COST_BLEND) | (1UL << LV_RENDER_COST_RADIUS), classes);
+    TEST_ASSERT_EQUAL_UINT32(10 * lv_render_cost_get_coef(LV_RENDER_COST_BLEND) +
+                             lv_render_cost_get_coef(LV_RENDER_COST_RADIUS) * 400 / 1000, cost);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_render_cost_clip_to_screen(void)
+{
+#if LV_USE_RENDER_COST
+    lv_obj_t * obj = create_rect(lv_scr_act(), 100, 100);
+    lv_obj_set_pos(obj, -50, 0);
+    lv_obj_update_layout(obj);
+
+    TEST_ASSERT_EQUAL_UINT32(5 * lv_render_cost_get_coef(LV_RENDER_COST_FILL), lv_render_cost_estimate(obj, NULL));
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_render_cost_shadow_and_layer(void)
+{
+#if LV_USE_RENDER_COST
+    lv_obj_t * obj = create_rect(lv_scr_act(), 100, 100);
+    lv_obj_set_pos(obj, 100, 100);
+    lv_obj_set_style_shadow_width(obj, 20, 0);
+    lv_obj_set_style_opa_layered(obj, LV_OPA_50, 0);
+    lv_obj_update_layout(obj);
+
+    uint32_t classes;
+    lv_render_cost_estimate(obj, &classes);
+    TEST_ASSERT_EQUAL_UINT32((1UL << LV_RENDER_COST_FILL) | (1UL << LV_RENDER_COST_SHADOW) | (1UL << LV_RENDER_COST_LAYER),
+                             classes);
+
+    /*Without a layer everything is blended*/
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_OPA_LAYERED, 0);
+    lv_obj_set_style_opa(lv_scr_act(), LV_OPA_50, 0);
+    lv_render_cost_estimate(obj, &classes);
+    TEST_ASSERT_EQUAL_UINT32((1UL << LV_RENDER_COST_BLEND) | (1UL << LV_RENDER_COST_SHADOW), classes);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_render_cost_analyze(void)
+{
+#if LV_USE_RENDER_COST
+    lv_obj_t * big = create_rect(lv_scr_act(), 400, 400);
+    lv_obj_t * small = create_rect(lv_scr_act(), 10, 10);
+    lv_obj_t * hidden = create_rect(lv_scr_act(), 400, 400);
+    lv_obj_add_flag(hidden, LV_OBJ_FLAG_HIDDEN);
+
+    /*Clipped by its parent*/
+    lv_obj_t * child = create_rect(small, 100, 100);
+    lv_obj_update_layout(lv_scr_act());
+
+    uint32_t small_cost = lv_render_cost_estimate(small, NULL);
+    lv_render_cost_report_t report;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_render_cost_analyze(lv_scr_act(), small_cost / 1000 + 1, &report));
+
+    TEST_ASSERT_EQUAL_UINT32(3, report.item_cnt);
+    TEST_ASSERT_EQUAL_PTR(big, report.items[0].obj);
+    TEST_ASSERT_EQUAL_UINT32(400 * 400, report.items[0].px);
+    TEST_ASSERT_EQUAL_PTR(child, report.items[2].obj);
+    TEST_ASSERT_EQUAL_UINT32(100, report.items[2].px);
+    TEST_ASSERT_EQUAL_UINT32(report.items[0].cost_ns + report.items[1].cost_ns + report.items[2].cost_ns,
+                             report.total_ns);
+    TEST_ASSERT_EQUAL_UINT32(1, report.over_budget_cnt);
+
+    lv_render_cost_report_log(&report, 10);
+    lv_render_cost_report_free(&report);
+    TEST_ASSERT_NULL(report.items);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_render_cost_coef(void)
+{
+#if LV_USE_RENDER_COST
+    uint32_t coef = lv_render_cost_get_coef(LV_RENDER_COST_TEXT);
+    lv_render_cost_set_coef(LV_RENDER_COST_TEXT, 1234);
+    TEST_ASSERT_EQUAL_UINT32(1234, lv_render_cost_get_coef(LV_RENDER_COST_TEXT));
+    lv_render_cost_set_coef(LV_RENDER_COST_TEXT, coef);
+
+    TEST_ASSERT_EQUAL_UINT32(0, lv_render_cost_get_coef(_LV_RENDER_COST_CLASS_NUM));
+#else
+    TEST_PASS();
+#endif
+}
+
+#endif
@@ -16,4 +16,213 @@ void test_screen_load_no_crash(void)
     lv_scr_load_anim(screen_with_anim_2, LV_SCR_LOAD_ANIM_OVER_RIGHT, 1000, 500, false);
 }
 
+#if LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM
+
+#define FB_SIZE     (800 * 480)
+
+extern lv_color_t test_fb[];
+
+static lv_color_t ref_fb[FB_SIZE];
+
+static lv_obj_t * create_screen(lv_palette_t palette)
+{
+    lv_obj_t * scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_palette_lighten(palette, 3), 0);
+    lv_obj_t * btn = lv_btn_create(scr);
+    lv_obj_set_pos(btn, 100, 80);
+    lv_obj_set_style_bg_color(btn, lv_palette_main(palette), 0);
+    lv_obj_t * label = lv_label_create(btn);
+    lv_label_set_text(label, "Snapshot");
+    return scr;
+}
+
+/*With the system heap the snapshots are always taken. Two full screen snapshots don't fit into
+ *the LVGL heap of the tests, so there the animation falls back to rendering the screens in every frame*/
+static void assert_snapshots_taken(void)
+{
+#if LV_MEM_CUSTOM
+    lv_disp_t * d = lv_disp_get_default();
+    TEST_ASSERT_NOT_NULL(d->act_scr_snapshot);
+    TEST_ASSERT_NOT_NULL(d->prev_scr_snapshot);
+#endif
+}
+
+/*Jump to the half of the running screen load animations*/
+static void anim_to_half(lv_obj_t * scr1, lv_obj_t * scr2)
+{
+    /*The first run calls the start callback*/
+    lv_anim_refr_now();
+
+    lv_anim_t * a = lv_anim_get(scr1, NULL);
+    if(a) a->act_time = a->time / 2;
+    a = lv_anim_get(scr2, NULL);
+    if(a) a->act_time = a->time / 2;
+    lv_anim_refr_now();
+}
+
+static void refr_all(void)
+{
+    lv_area_t a;
+    lv_area_set(&a, 0, 0, lv_disp_get_hor_res(NULL) - 1, lv_disp_get_ver_res(NULL) - 1);
+    _lv_inv_area(NULL, &a);
+    _lv_disp_refr_timer(NULL);
+}
+
+static void finish_anim(lv_obj_t * scr)
+{
+    lv_anim_t * a = lv_anim_get(scr, NULL);
+    a->act_time = a->time;
+    lv_anim_refr_now();
+}
+
+/*The snapshots should look the same as the rendered screens*/
+static void assert_same_as_rendered(void)
+{
+    lv_disp_t * d = lv_disp_get_default();
+
+    refr_all();
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_img_dsc_t * act_scr_snapshot = d->act_scr_snapshot;
+    lv_img_dsc_t * prev_scr_snapshot = d->prev_scr_snapshot;
+    d->act_scr_snapshot = NULL;
+    d->prev_scr_snapshot = NULL;
+    refr_all();
+    d->act_scr_snapshot = act_scr_snapshot;
+    d->prev_scr_snapshot = prev_scr_snapshot;
+
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+static void test_move_anim(lv_scr_load_anim_t anim_type)
+{
+    lv_disp_t * d = lv_disp_get_default();
+    lv_obj_t * old_scr = lv_scr_act();
+    lv_obj_t * new_scr = create_screen(LV_PALETTE_BLUE);
+    lv_obj_t * label = lv_label_create(old_scr);
+    lv_label_set_text(label, "Old screen");
+    lv_obj_center(label);
+
+    lv_scr_load_anim(new_scr, anim_type, 1000, 0, false);
+    anim_to_half(old_scr, new_scr);
+    assert_snapshots_taken();
+    assert_same_as_rendered();
+
+    /*Rendered as usual after the animation*/
+    finish_anim(new_scr);
+    TEST_ASSERT_NULL(d->act_scr_snapshot);
+    TEST_ASSERT_NULL(d->prev_scr_snapshot);
+
+    lv_scr_load(old_scr);
+    lv_obj_del(label);
+    lv_obj_del(new_scr);
+}
+
+#endif
+
+void test_screen_load_snapshot_move(void)
+{
+#if LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM
+    test_move_anim(LV_SCR_LOAD_ANIM_MOVE_LEFT);
+    test_move_anim(LV_SCR_LOAD_ANIM_OVER_BOTTOM);
+    test_move_anim(LV_SCR_LOAD_ANIM_OUT_RIGHT);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_screen_load_snapshot_fade(void)
+{
+#if LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM
+    lv_disp_t * d = lv_disp_get_default();
+    lv_obj_t * old_scr = lv_scr_act();
+    lv_obj_t * new_scr = create_screen(LV_PALETTE_BLUE);
+
+    lv_scr_load_anim(new_scr, LV_SCR_LOAD_ANIM_FADE_IN, 1000, 0, false);
+    anim_to_half(old_scr, new_scr);
+    assert_snapshots_taken();
+    refr_all();
+
+    /*The screen is faded as a whole, so the button is not mixed with the background of its screen.
+     *Without the snapshot the opacity is applied to the widgets one by one.*/
+    if(d->act_scr_snapshot) {
+        lv_color_t expected = lv_color_mix(lv_palette_main(LV_PALETTE_BLUE), lv_obj_get_style_bg_color(old_scr, 0),
+                                           lv_obj_get_style_opa(new_scr, 0));
+        lv_color_t px = test_fb[100 * lv_disp_get_hor_res(NULL) + 104];
+        TEST_ASSERT_INT_WITHIN(1, LV_COLOR_GET_R(expected), LV_COLOR_GET_R(px));
+        TEST_ASSERT_INT_WITHIN(1, LV_COLOR_GET_G(expected), LV_COLOR_GET_G(px));
+        TEST_ASSERT_INT_WITHIN(1, LV_COLOR_GET_B(expected), LV_COLOR_GET_B(px));
+    }
+
+    finish_anim(new_scr);
+    TEST_ASSERT_NULL(d->act_scr_snapshot);
+    TEST_ASSERT_NULL(d->prev_scr_snapshot);
+    lv_scr_load(old_scr);
+    lv_obj_del(new_scr);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_screen_load_snapshot_style_opa(void)
+{
+#if LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_opa(&style, LV_OPA_70);
+
+    lv_obj_t * old_scr = lv_scr_act();
+    lv_obj_t * new_scr = create_screen(LV_PALETTE_BLUE);
+    lv_obj_add_style(new_scr, &style, 0);
+
+    lv_scr_load_anim(new_scr, LV_SCR_LOAD_ANIM_MOVE_LEFT, 1000, 0, false);
+    anim_to_half(old_scr, new_scr);
+    assert_snapshots_taken();
+
+    /*The opacity of the style is not overridden by a local one after taking the snapshot*/
+    lv_style_value_t v;
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_obj_get_local_style_prop(new_scr, LV_STYLE_OPA, &v, 0));
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_70, lv_obj_get_style_opa(new_scr, 0));
+
+    finish_anim(new_scr);
+    lv_scr_load(old_scr);
+    lv_obj_del(new_scr);
+    lv_style_reset(&style);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_screen_load_snapshot_interrupted(void)
+{
+#if LV_USE_SNAPSHOT && LV_SNAPSHOT_SCR_LOAD_ANIM
+    lv_disp_t * d = lv_disp_get_default();
+    lv_obj_t * old_scr = lv_scr_act();
+    lv_obj_t * scr1 = create_screen(LV_PALETTE_RED);
+    lv_obj_t * scr2 = create_screen(LV_PALETTE_GREEN);
+
+    lv_scr_load_anim(scr1, LV_SCR_LOAD_ANIM_MOVE_TOP, 1000, 0, false);
+    anim_to_half(old_scr, scr1);
+    assert_snapshots_taken();
+
+    /*The first animation is finished immediately and its snapshots are freed*/
+    lv_scr_load_anim(scr2, LV_SCR_LOAD_ANIM_NONE, 1000, 0, false);
+    TEST_ASSERT_NULL(d->act_scr_snapshot);
+    TEST_ASSERT_NULL(d->prev_scr_snapshot);
+
+    /*No snapshots are required if the screens don't move*/
+    anim_to_half(scr1, scr2);
+    TEST_ASSERT_NULL(d->act_scr_snapshot);
+
+    finish_anim(scr2);
+
+    lv_scr_load(old_scr);
+    lv_obj_del(scr1);
+    lv_obj_del(scr2);
+#else
+    TEST_PASS();
+#endif
+}
+
+
 #endif
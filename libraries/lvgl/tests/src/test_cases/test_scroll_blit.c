@@ -0,0 +1,151 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define BUF_PX_CNT  (800 * 480)
+
+static lv_obj_t * cont;
+/*Not allocated from the LVGL heap as they don't fit into it next to the display buffer*/
+static lv_color_t ref_buf[BUF_PX_CNT];
+static lv_color_t buf2[BUF_PX_CNT];
+
+/*The buffer rendered last*/
+static lv_color_t * get_buf(void)
+{
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_default()->driver->draw_buf;
+    if(draw_buf->buf2 == NULL) return draw_buf->buf1;
+    return draw_buf->buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1;
+}
+
+static uint32_t get_buf_size(void)
+{
+    return lv_disp_get_hor_res(NULL) * lv_disp_get_ver_res(NULL) * sizeof(lv_color_t);
+}
+
+static uint32_t get_inv_size(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    uint32_t size = 0;
+    uint16_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        size += lv_area_get_size(&disp->inv_areas[i]);
+    }
+    return size;
+}
+
+/*Compare the refreshed buffer with a full redraw*/
+static void assert_same_as_redraw(void)
+{
+    lv_refr_now(NULL);
+    lv_memcpy(ref_buf, get_buf(), get_buf_size());
+
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(get_buf(), ref_buf, get_buf_size());
+}
+
+void setUp(void)
+{
+    lv_disp_drv_t * drv = lv_disp_get_default()->driver;
+    drv->direct_mode = 1;
+    drv->scroll_blit = 1;
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(ref_buf), get_buf_size());
+
+    cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 300, 200);
+    lv_obj_set_pos(cont, 50, 30);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_obj_t * btn = lv_btn_create(cont);
+        lv_obj_set_width(btn, 400);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "Item %"LV_PRIu32, i);
+    }
+
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_disp_drv_t * drv = lv_disp_get_default()->driver;
+    drv->direct_mode = 0;
+    drv->scroll_blit = 0;
+    if(drv->draw_buf->buf2) {
+        drv->draw_buf->buf2 = NULL;
+        drv->draw_buf->buf_act = drv->draw_buf->buf1;
+        /*The areas to sync are kept for the next refresh of the second buffer*/
+        _lv_ll_clear(&lv_disp_get_default()->sync_areas);
+    }
+    /*The screen keeps its `spec_attr`, allocated for its first child*/
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_scroll_blit_vertical(void)
+{
+    lv_obj_scroll_by(cont, 0, -15, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL(-15, lv_disp_get_default()->blit_ofs.y);
+    TEST_ASSERT_LESS_THAN_UINT32(300 * 200 / 2, get_inv_size());
+    assert_same_as_redraw();
+
+    lv_obj_scroll_by(cont, 0, 10, LV_ANIM_OFF);
+    assert_same_as_redraw();
+}
+
+void test_scroll_blit_more_steps(void)
+{
+    lv_obj_scroll_by(cont, 0, -7, LV_ANIM_OFF);
+    lv_obj_scroll_by(cont, -20, -30, LV_ANIM_OFF);
+    lv_obj_scroll_by(cont, 5, 12, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL(-15, lv_disp_get_default()->blit_ofs.x);
+    TEST_ASSERT_EQUAL(-25, lv_disp_get_default()->blit_ofs.y);
+    assert_same_as_redraw();
+}
+
+void test_scroll_blit_changed_before_scroll(void)
+{
+    /*Invalidated but not redrawn yet before the pixels are moved*/
+    lv_obj_t * btn = lv_obj_get_child(cont, 2);
+    lv_obj_set_style_bg_color(btn, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_scroll_by(cont, 0, -25, LV_ANIM_OFF);
+    assert_same_as_redraw();
+}
+
+void test_scroll_blit_double_buffered(void)
+{
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_default()->driver->draw_buf;
+    draw_buf->buf2 = buf2;
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    lv_obj_scroll_by(cont, 0, -15, LV_ANIM_OFF);
+    assert_same_as_redraw();
+    lv_obj_scroll_by(cont, -10, -5, LV_ANIM_OFF);
+    assert_same_as_redraw();
+}
+
+void test_scroll_blit_covered(void)
+{
+    /*Drawn on the container so its pixels can't be moved*/
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_pos(obj, 100, 100);
+    lv_refr_now(NULL);
+
+    lv_obj_scroll_by(cont, 0, -15, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL(0, lv_disp_get_default()->blit_ofs.y);
+    assert_same_as_redraw();
+}
+
+void test_scroll_blit_disabled(void)
+{
+    lv_disp_get_default()->driver->direct_mode = 0;
+    lv_obj_scroll_by(cont, 0, -15, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL(0, lv_disp_get_default()->blit_ofs.y);
+}
+
+#endif
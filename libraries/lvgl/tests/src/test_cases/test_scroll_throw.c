@@ -0,0 +1,105 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_indev.h"
+
+static lv_obj_t * cont;
+static uint32_t scroll_cnt;
+static uint32_t same_refr_cnt;
+static uint32_t last_refr_cnt;
+static bool released;
+
+static void scroll_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    if(released) {
+        uint32_t refr_cnt = lv_disp_get_default()->refr_cnt;
+        if(scroll_cnt > 0 && refr_cnt == last_refr_cnt) same_refr_cnt++;
+        last_refr_cnt = refr_cnt;
+        scroll_cnt++;
+    }
+}
+
+static void fling(lv_coord_t dy)
+{
+    lv_test_mouse_move_to(200, 400);
+    lv_test_mouse_press();
+    lv_test_indev_wait(50);
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_test_mouse_move_by(0, dy);
+        lv_test_indev_wait(lv_test_mouse_indev->driver->read_timer->period);
+    }
+
+    released = true;
+    lv_test_mouse_release();
+}
+
+static bool is_throwing(void)
+{
+    return lv_indev_get_scroll_obj(lv_test_mouse_indev) != NULL;
+}
+
+void setUp(void)
+{
+    scroll_cnt = 0;
+    same_refr_cnt = 0;
+    released = false;
+
+    cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 400, 460);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    lv_obj_add_event_cb(cont, scroll_event_cb, LV_EVENT_SCROLL, NULL);
+
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_obj_t * btn = lv_btn_create(cont);
+        lv_obj_set_width(btn, lv_pct(100));
+        lv_obj_clear_flag(btn, LV_OBJ_FLAG_CLICKABLE);
+    }
+
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_test_mouse_release();
+    lv_test_indev_wait(50);
+    lv_timer_set_period(lv_test_mouse_indev->driver->read_timer, LV_INDEV_DEF_READ_PERIOD);
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_scroll_throw_once_per_refresh(void)
+{
+    /*The indev is read many times in a refresh period*/
+    lv_timer_set_period(lv_test_mouse_indev->driver->read_timer, 5);
+
+    fling(-20);
+    lv_coord_t y_release = lv_obj_get_scroll_y(cont);
+    uint32_t t = lv_tick_get();
+    while(is_throwing() && lv_tick_elaps(t) < 3000) {
+        lv_test_indev_wait(5);
+    }
+
+    TEST_ASSERT_FALSE(is_throwing());
+    TEST_ASSERT_GREATER_THAN(3, scroll_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, same_refr_cnt);
+    TEST_ASSERT_GREATER_THAN(y_release + 100, lv_obj_get_scroll_y(cont));
+}
+
+void test_scroll_throw_stop_on_press(void)
+{
+    fling(-30);
+    lv_test_indev_wait(100);
+    TEST_ASSERT_TRUE(is_throwing());
+
+    lv_test_mouse_press();
+    lv_test_indev_wait(50);
+    lv_coord_t y = lv_obj_get_scroll_y(cont);
+    lv_test_indev_wait(100);
+    TEST_ASSERT_EQUAL(y, lv_obj_get_scroll_y(cont));
+}
+
+#endif
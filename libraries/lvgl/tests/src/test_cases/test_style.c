@@ -106,4 +106,41 @@ void test_inherit_meta_with_lower_precedence_style(void)
     TEST_ASSERT_EQUAL_HEX(lv_color_hex(0xff0000).full, lv_obj_get_style_text_color(grandchild, LV_PART_MAIN).full);
 }
 
+void test_add_styles_same_as_add_style(void)
+{
+    static lv_style_t style1, style2, style3;
+    lv_style_init(&style1);
+    lv_style_init(&style2);
+    lv_style_init(&style3);
+
+    /*With a local style and existing normal styles*/
+    lv_obj_t * obj1 = lv_obj_create(lv_scr_act());
+    lv_obj_t * obj2 = lv_obj_create(lv_scr_act());
+    lv_obj_set_style_bg_color(obj1, lv_color_hex(0xff0000), 0);
+    lv_obj_set_style_bg_color(obj2, lv_color_hex(0xff0000), 0);
+
+    lv_obj_add_style(obj1, &style1, 0);
+    lv_obj_add_style(obj1, &style2, LV_STATE_PRESSED);
+    lv_obj_add_style(obj1, &style3, LV_PART_INDICATOR);
+
+    _lv_obj_style_t styles[3];
+    lv_memset_00(styles, sizeof(styles));
+    styles[0].style = &style1;
+    styles[0].selector = 0;
+    styles[1].style = &style2;
+    styles[1].selector = LV_STATE_PRESSED;
+    styles[2].style = &style3;
+    styles[2].selector = LV_PART_INDICATOR;
+    _lv_obj_add_styles(obj2, styles, 3);
+
+    TEST_ASSERT_EQUAL(obj1->style_cnt, obj2->style_cnt);
+    uint32_t i;
+    for(i = 0; i < obj1->style_cnt; i++) {
+        TEST_ASSERT_EQUAL_UINT32(obj1->styles[i].selector, obj2->styles[i].selector);
+        TEST_ASSERT_EQUAL(obj1->styles[i].is_local, obj2->styles[i].is_local);
+        /*The local styles are allocated for the objects*/
+        if(!obj1->styles[i].is_local) TEST_ASSERT_EQUAL_PTR(obj1->styles[i].style, obj2->styles[i].style);
+    }
+}
+
 #endif
@@ -9,10 +9,10 @@
 #define ESP_UTILS_LOG_TAG "LvPort"
 #include "esp_lib_utils.h"
 #include "lvgl_v8_port.h"
+#include "lvgl_v8_port_rotate.h"
 
 using namespace esp_panel::drivers;
 
-#define LVGL_PORT_ENABLE_ROTATION_OPTIMIZED     (1)
 #define LVGL_PORT_BUFFER_NUM_MAX                (2)
 
 static SemaphoreHandle_t lvgl_mux = nullptr;                  // LVGL mutex
@@ -36,168 +36,6 @@ static void *get_next_frame_buffer(LCD *lcd)
 
     return next_fb;
 }
-
-__attribute__((always_inline))
-static inline void copy_pixel_8bpp(uint8_t *to, const uint8_t *from)
-{
-    *to++ = *from++;
-}
-
-__attribute__((always_inline))
-static inline void copy_pixel_16bpp(uint8_t *to, const uint8_t *from)
-{
-    *(uint16_t *)to++ = *(const uint16_t *)from++;
-}
-
-__attribute__((always_inline))
-static inline void copy_pixel_24bpp(uint8_t *to, const uint8_t *from)
-{
-    *to++ = *from++;
-    *to++ = *from++;
-    *to++ = *from++;
-}
-
-#define _COPY_PIXEL(_bpp, to, from) copy_pixel_##_bpp##bpp(to, from)
-#define COPY_PIXEL(_bpp, to, from)  _COPY_PIXEL(_bpp, to, from)
-
-#define ROTATE_90_ALL_BPP() \
-    { \
-        to_bytes_per_line = h * to_bytes_per_piexl; \
-        to_index_const = (w - x_start - 1) * to_bytes_per_line; \
-        for (int from_y = y_start; from_y < y_end + 1; from_y++) { \
-            from_index = from_y * from_bytes_per_line + x_start * from_bytes_per_piexl; \
-            to_index = to_index_const + from_y * to_bytes_per_piexl; \
-            for (int from_x = x_start; from_x < x_end + 1; from_x++) { \
-                COPY_PIXEL(LV_COLOR_DEPTH, to + to_index, from + from_index); \
-                from_index += from_bytes_per_piexl; \
-                to_index -= to_bytes_per_line; \
-            } \
-        } \
-    }
-
-/**
- * @brief Optimized transpose function for RGB565 format.
- *
- * @note  ESP32-P4 1024x600 full-screen: 738ms -> 34ms
- * @note  ESP32-S3 480x480  full-screen: 380ms -> 37ms
- */
-#define ROTATE_90_OPTIMIZED_16BPP(block_w, block_h) \
-    { \
-        for (int i = 0; i < h; i += block_h) { \
-            max_height = (i + block_h > h) ? h : (i + block_h); \
-            for (int j = 0; j < w; j += block_w) { \
-                max_width = (j + block_w > w) ? w : (j + block_w); \
-                start_y = w - 1 - j;   \
-                for (int x = i; x < max_height; x++) { \
-                    from_next = (uint16_t *)from + x * w; \
-                    for (int y = j, mirrored_y = start_y; y < max_width; y += 4, mirrored_y -= 4) { \
-                        ((uint16_t *)to)[(mirrored_y) * h + x] = *((uint32_t *)(from_next + y)) & 0xFFFF; \
-                        ((uint16_t *)to)[(mirrored_y - 1) * h + x] = (*((uint32_t *)(from_next + y)) >> 16) & 0xFFFF; \
-                        ((uint16_t *)to)[(mirrored_y - 2) * h + x] = *((uint32_t *)(from_next + y + 2)) & 0xFFFF; \
-                        ((uint16_t *)to)[(mirrored_y - 3) * h + x] = (*((uint32_t *)(from_next + y + 2)) >> 16) & 0xFFFF; \
-                    } \
-                } \
-            } \
-        } \
-    }
-
-#define ROTATE_180_ALL_BPP() \
-    { \
-        to_bytes_per_line = w * to_bytes_per_piexl; \
-        to_index_const = (h - 1) * to_bytes_per_line + (w - x_start - 1) * to_bytes_per_piexl; \
-        for (int from_y = y_start; from_y < y_end + 1; from_y++) { \
-            from_index = from_y * from_bytes_per_line + x_start * from_bytes_per_piexl; \
-            to_index = to_index_const - from_y * to_bytes_per_line; \
-            for (int from_x = x_start; from_x < x_end + 1; from_x++) { \
-                COPY_PIXEL(LV_COLOR_DEPTH, to + to_index, from + from_index); \
-                from_index += from_bytes_per_piexl; \
-                to_index -= to_bytes_per_piexl; \
-            } \
-        } \
-    }
-
-#define ROTATE_270_OPTIMIZED_16BPP(block_w, block_h) \
-    { \
-        for (int i = 0; i < h; i += block_h) { \
-            max_height = i + block_h > h ? h : i + block_h; \
-            for (int j = 0; j < w; j += block_w) { \
-                max_width = j + block_w > w ? w : j + block_w; \
-                for (int x = i; x < max_height; x++) { \
-                    from_next = (uint16_t *)from + x * w; \
-                    for (int y = j; y < max_width; y += 4) { \
-                        ((uint16_t *)to)[y * h + (h - 1 - x)] = *((uint32_t *)(from_next + y)) & 0xFFFF; \
-                        ((uint16_t *)to)[(y + 1) * h + (h - 1 - x)] = (*((uint32_t *)(from_next + y)) >> 16) & 0xFFFF; \
-                        ((uint16_t *)to)[(y + 2) * h + (h - 1 - x)] = *((uint32_t *)(from_next + y + 2)) & 0xFFFF; \
-                        ((uint16_t *)to)[(y + 3) * h + (h - 1 - x)] = (*((uint32_t *)(from_next + y + 2)) >> 16) & 0xFFFF; \
-                    } \
-                } \
-            } \
-        } \
-    }
-
-#define ROTATE_270_ALL_BPP() \
-    { \
-        to_bytes_per_line = h * to_bytes_per_piexl; \
-        from_index_const = x_start * from_bytes_per_piexl; \
-        to_index_const = x_start * to_bytes_per_line + (h - 1) * to_bytes_per_piexl; \
-        for (int from_y = y_start; from_y < y_end + 1; from_y++) { \
-            from_index = from_y * from_bytes_per_line + from_index_const; \
-            to_index = to_index_const - from_y * to_bytes_per_piexl; \
-            for (int from_x = x_start; from_x < x_end + 1; from_x++) { \
-                COPY_PIXEL(LV_COLOR_DEPTH, to + to_index, from + from_index); \
-                from_index += from_bytes_per_piexl; \
-                to_index += to_bytes_per_line; \
-            } \
-        } \
-    }
-
-__attribute__((always_inline))
-IRAM_ATTR static inline void rotate_copy_pixel(
-    const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, uint16_t w,
-    uint16_t h, uint16_t rotate
-)
-{
-    int from_bytes_per_piexl = sizeof(lv_color_t);
-    int from_bytes_per_line = w * from_bytes_per_piexl;
-    int from_index = 0;
-
-    int to_bytes_per_piexl = LV_COLOR_DEPTH >> 3;
-    int to_bytes_per_line;
-    int to_index = 0;
-    int to_index_const = 0;
-
-#if (LV_COLOR_DEPTH == 16) && LVGL_PORT_ENABLE_ROTATION_OPTIMIZED
-    int max_height = 0;
-    int max_width = 0;
-    int start_y = 0;
-    uint16_t *from_next = NULL;
-#endif
-
-    // uint32_t time = esp_log_timestamp();
-    switch (rotate) {
-    case 90:
-#if (LV_COLOR_DEPTH == 16) && LVGL_PORT_ENABLE_ROTATION_OPTIMIZED
-        ROTATE_90_OPTIMIZED_16BPP(32, 256);
-#else
-        ROTATE_90_ALL_BPP();
-#endif
-        break;
-    case 180:
-        ROTATE_180_ALL_BPP();
-        break;
-    case 270:
-#if (LV_COLOR_DEPTH == 16) && LVGL_PORT_ENABLE_ROTATION_OPTIMIZED
-        ROTATE_270_OPTIMIZED_16BPP(32, 256);
-#else
-        int from_index_const = 0;
-        ROTATE_270_ALL_BPP();
-#endif
-        break;
-    default:
-        break;
-    }
-    // ESP_LOGI(TAG, "rotate: end, time used:%d", (int)(esp_log_timestamp() - time));
-}
 #endif /* LVGL_PORT_ROTATION_DEGREE */
 
 #if LVGL_PORT_AVOID_TEAR
@@ -551,6 +389,34 @@ void rounder_callback(lv_disp_drv_t *drv, lv_area_t *area)
     }
 }
 
+#if ESP_UTILS_CONF_PERF_ENABLE || ESP_UTILS_CONF_TRACE_ENABLE
+static void flush_callback_instrumented(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    ESP_UTILS_TRACE_SCOPE("flush_callback");
+    ESP_UTILS_PERF_COUNTER_ADD("port.flush", 1);
+    ESP_UTILS_PERF_COUNTER_ADD("port.flush_px", lv_area_get_size(area));
+    {
+        ESP_UTILS_PERF_HISTOGRAM_SCOPE_US("port.flush_us");
+        flush_callback(drv, area, color_map);
+    }
+}
+#endif
+
+#if ESP_UTILS_CONF_PERF_ENABLE
+/* Called by LVGL after each refresh, with the rendering time and the number of rendered pixels */
+static void monitor_callback(lv_disp_drv_t *drv, uint32_t time_ms, uint32_t px)
+{
+    static const uint32_t time_bounds[] = {2, 5, 10, 16, 33, 50, 100};
+
+    static esp_utils_perf_metric_t *const refr_time_ms = esp_utils_perf_register_histogram(
+                "lvgl.refr_time_ms", time_bounds, sizeof(time_bounds) / sizeof(time_bounds[0])
+            );
+    esp_utils_perf_histogram_record(refr_time_ms, time_ms);
+    ESP_UTILS_PERF_COUNTER_ADD("lvgl.refr", 1);
+    ESP_UTILS_PERF_COUNTER_ADD("lvgl.refr_px", px);
+}
+#endif
+
 static lv_disp_t *display_init(LCD *lcd)
 {
     ESP_UTILS_CHECK_FALSE_RETURN(lcd != nullptr, nullptr, "Invalid LCD device");
@@ -604,7 +470,14 @@ static lv_disp_t *display_init(LCD *lcd)
 
     ESP_UTILS_LOGD("Register display driver to LVGL");
     lv_disp_drv_init(&disp_drv);
+#if ESP_UTILS_CONF_PERF_ENABLE || ESP_UTILS_CONF_TRACE_ENABLE
+    disp_drv.flush_cb = flush_callback_instrumented;
+#else
     disp_drv.flush_cb = flush_callback;
+#endif
+#if ESP_UTILS_CONF_PERF_ENABLE
+    disp_drv.monitor_cb = monitor_callback;
+#endif
 #if (LVGL_PORT_ROTATION_DEGREE == 90) || (LVGL_PORT_ROTATION_DEGREE == 270)
     disp_drv.hor_res = lcd_height;
     disp_drv.ver_res = lcd_width;
@@ -617,6 +490,10 @@ static lv_disp_t *display_init(LCD *lcd)
     disp_drv.full_refresh = 1;
 #elif LVGL_PORT_DIRECT_MODE
     disp_drv.direct_mode = 1;
+#if LVGL_PORT_ROTATION_DEGREE == 0
+    // The LVGL buffers are the LCD frame buffers, so the scrolled pixels can be moved in place
+    disp_drv.scroll_blit = 1;
+#endif
 #endif
 #else                       // Only available when the tearing effect is disabled
     if (lcd->getBasicAttributes().basic_bus_spec.isFunctionValid(LCD::BasicBusSpecification::FUNC_SWAP_XY) &&
@@ -710,10 +587,14 @@ static bool tick_deinit(void)
 static void lvgl_port_task(void *arg)
 {
     ESP_UTILS_LOGD("Starting LVGL task");
+#if ESP_UTILS_CONF_TRACE_ENABLE
+    esp_utils_trace_set_thread_name("lvgl");
+#endif
 
     uint32_t task_delay_ms = LVGL_PORT_TASK_MAX_DELAY_MS;
     while (1) {
         if (lvgl_port_lock(-1)) {
+            ESP_UTILS_PERF_HISTOGRAM_SCOPE_US("port.timer_handler_us");
             task_delay_ms = lv_timer_handler();
             lvgl_port_unlock();
         }
@@ -812,7 +693,15 @@ bool lvgl_port_lock(int timeout_ms)
     ESP_UTILS_CHECK_NULL_RETURN(lvgl_mux, false, "LVGL mutex is not initialized");
 
     const TickType_t timeout_ticks = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+#if ESP_UTILS_CONF_PERF_ENABLE
+    int64_t start_us = esp_utils_perf_get_time_us();
+    bool ret = (xSemaphoreTakeRecursive(lvgl_mux, timeout_ticks) == pdTRUE);
+    ESP_UTILS_PERF_HISTOGRAM_RECORD("port.lock_wait_us", static_cast<uint32_t>(esp_utils_perf_get_time_us() - start_us));
+
+    return ret;
+#else
     return (xSemaphoreTakeRecursive(lvgl_mux, timeout_ticks) == pdTRUE);
+#endif
 }
 
 bool lvgl_port_unlock(void)
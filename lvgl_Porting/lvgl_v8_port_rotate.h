@@ -0,0 +1,186 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+/**
+ * Pixel rotation kernels used by the port when `LVGL_PORT_ROTATION_DEGREE` is not 0.
+ *
+ * This header only depends on LVGL, so it is also built by the host benchmark in `lvgl/tests/bench`.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "lvgl.h"
+
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+#ifndef LVGL_PORT_ENABLE_ROTATION_OPTIMIZED
+#define LVGL_PORT_ENABLE_ROTATION_OPTIMIZED     (1)
+#endif
+
+__attribute__((always_inline))
+static inline void copy_pixel_8bpp(uint8_t *to, const uint8_t *from)
+{
+    *to++ = *from++;
+}
+
+__attribute__((always_inline))
+static inline void copy_pixel_16bpp(uint8_t *to, const uint8_t *from)
+{
+    *(uint16_t *)to++ = *(const uint16_t *)from++;
+}
+
+__attribute__((always_inline))
+static inline void copy_pixel_24bpp(uint8_t *to, const uint8_t *from)
+{
+    *to++ = *from++;
+    *to++ = *from++;
+    *to++ = *from++;
+}
+
+#define _COPY_PIXEL(_bpp, to, from) copy_pixel_##_bpp##bpp(to, from)
+#define COPY_PIXEL(_bpp, to, from)  _COPY_PIXEL(_bpp, to, from)
+
+#define ROTATE_90_ALL_BPP() \
+    { \
+        to_bytes_per_line = h * to_bytes_per_piexl; \
+        to_index_const = (w - x_start - 1) * to_bytes_per_line; \
+        for (int from_y = y_start; from_y < y_end + 1; from_y++) { \
+            from_index = from_y * from_bytes_per_line + x_start * from_bytes_per_piexl; \
+            to_index = to_index_const + from_y * to_bytes_per_piexl; \
+            for (int from_x = x_start; from_x < x_end + 1; from_x++) { \
+                COPY_PIXEL(LV_COLOR_DEPTH, to + to_index, from + from_index); \
+                from_index += from_bytes_per_piexl; \
+                to_index -= to_bytes_per_line; \
+            } \
+        } \
+    }
+
+/**
+ * @brief Optimized transpose function for RGB565 format.
+ *
+ * @note  ESP32-P4 1024x600 full-screen: 738ms -> 34ms
+ * @note  ESP32-S3 480x480  full-screen: 380ms -> 37ms
+ */
+#define ROTATE_90_OPTIMIZED_16BPP(block_w, block_h) \
+    { \
+        for (int i = 0; i < h; i += block_h) { \
+            max_height = (i + block_h > h) ? h : (i + block_h); \
+            for (int j = 0; j < w; j += block_w) { \
+                max_width = (j + block_w > w) ? w : (j + block_w); \
+                start_y = w - 1 - j;   \
+                for (int x = i; x < max_height; x++) { \
+                    from_next = (uint16_t *)from + x * w; \
+                    for (int y = j, mirrored_y = start_y; y < max_width; y += 4, mirrored_y -= 4) { \
+                        ((uint16_t *)to)[(mirrored_y) * h + x] = *((uint32_t *)(from_next + y)) & 0xFFFF; \
+                        ((uint16_t *)to)[(mirrored_y - 1) * h + x] = (*((uint32_t *)(from_next + y)) >> 16) & 0xFFFF; \
+                        ((uint16_t *)to)[(mirrored_y - 2) * h + x] = *((uint32_t *)(from_next + y + 2)) & 0xFFFF; \
+                        ((uint16_t *)to)[(mirrored_y - 3) * h + x] = (*((uint32_t *)(from_next + y + 2)) >> 16) & 0xFFFF; \
+                    } \
+                } \
+            } \
+        } \
+    }
+
+#define ROTATE_180_ALL_BPP() \
+    { \
+        to_bytes_per_line = w * to_bytes_per_piexl; \
+        to_index_const = (h - 1) * to_bytes_per_line + (w - x_start - 1) * to_bytes_per_piexl; \
+        for (int from_y = y_start; from_y < y_end + 1; from_y++) { \
+            from_index = from_y * from_bytes_per_line + x_start * from_bytes_per_piexl; \
+            to_index = to_index_const - from_y * to_bytes_per_line; \
+            for (int from_x = x_start; from_x < x_end + 1; from_x++) { \
+                COPY_PIXEL(LV_COLOR_DEPTH, to + to_index, from + from_index); \
+                from_index += from_bytes_per_piexl; \
+                to_index -= to_bytes_per_piexl; \
+            } \
+        } \
+    }
+
+#define ROTATE_270_OPTIMIZED_16BPP(block_w, block_h) \
+    { \
+        for (int i = 0; i < h; i += block_h) { \
+            max_height = i + block_h > h ? h : i + block_h; \
+            for (int j = 0; j < w; j += block_w) { \
+                max_width = j + block_w > w ? w : j + block_w; \
+                for (int x = i; x < max_height; x++) { \
+                    from_next = (uint16_t *)from + x * w; \
+                    for (int y = j; y < max_width; y += 4) { \
+                        ((uint16_t *)to)[y * h + (h - 1 - x)] = *((uint32_t *)(from_next + y)) & 0xFFFF; \
+                        ((uint16_t *)to)[(y + 1) * h + (h - 1 - x)] = (*((uint32_t *)(from_next + y)) >> 16) & 0xFFFF; \
+                        ((uint16_t *)to)[(y + 2) * h + (h - 1 - x)] = *((uint32_t *)(from_next + y + 2)) & 0xFFFF; \
+                        ((uint16_t *)to)[(y + 3) * h + (h - 1 - x)] = (*((uint32_t *)(from_next + y + 2)) >> 16) & 0xFFFF; \
+                    } \
+                } \
+            } \
+        } \
+    }
+
+#define ROTATE_270_ALL_BPP() \
+    { \
+        to_bytes_per_line = h * to_bytes_per_piexl; \
+        from_index_const = x_start * from_bytes_per_piexl; \
+        to_index_const = x_start * to_bytes_per_line + (h - 1) * to_bytes_per_piexl; \
+        for (int from_y = y_start; from_y < y_end + 1; from_y++) { \
+            from_index = from_y * from_bytes_per_line + from_index_const; \
+            to_index = to_index_const - from_y * to_bytes_per_piexl; \
+            for (int from_x = x_start; from_x < x_end + 1; from_x++) { \
+                COPY_PIXEL(LV_COLOR_DEPTH, to + to_index, from + from_index); \
+                from_index += from_bytes_per_piexl; \
+                to_index += to_bytes_per_line; \
+            } \
+        } \
+    }
+
+__attribute__((always_inline))
+IRAM_ATTR static inline void rotate_copy_pixel(
+    const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, uint16_t w,
+    uint16_t h, uint16_t rotate
+)
+{
+    int from_bytes_per_piexl = sizeof(lv_color_t);
+    int from_bytes_per_line = w * from_bytes_per_piexl;
+    int from_index = 0;
+
+    int to_bytes_per_piexl = LV_COLOR_DEPTH >> 3;
+    int to_bytes_per_line;
+    int to_index = 0;
+    int to_index_const = 0;
+
+#if (LV_COLOR_DEPTH == 16) && LVGL_PORT_ENABLE_ROTATION_OPTIMIZED
+    int max_height = 0;
+    int max_width = 0;
+    int start_y = 0;
+    uint16_t *from_next = NULL;
+#else
+    int from_index_const = 0;
+#endif
+
+    // uint32_t time = esp_log_timestamp();
+    switch (rotate) {
+    case 90:
+#if (LV_COLOR_DEPTH == 16) && LVGL_PORT_ENABLE_ROTATION_OPTIMIZED
+        ROTATE_90_OPTIMIZED_16BPP(32, 256);
+#else
+        ROTATE_90_ALL_BPP();
+#endif
+        break;
+    case 180:
+        ROTATE_180_ALL_BPP();
+        break;
+    case 270:
+#if (LV_COLOR_DEPTH == 16) && LVGL_PORT_ENABLE_ROTATION_OPTIMIZED
+        ROTATE_270_OPTIMIZED_16BPP(32, 256);
+#else
+        ROTATE_270_ALL_BPP();
+#endif
+        break;
+    default:
+        break;
+    }
+    // ESP_LOGI(TAG, "rotate: end, time used:%d", (int)(esp_log_timestamp() - time));
+}